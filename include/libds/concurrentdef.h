@@ -0,0 +1,525 @@
+/**
+ * @file    concurrentdef.h
+ * @brief   Type-safe thread-safe container generator macros.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ *
+ * This module provides containers that several threads may use at once
+ * without external locking. They follow the same `Prefix_` naming and
+ * @ref ds_error returns as the single-threaded generators, but only expose
+ * operations that stay meaningful under concurrency: no indexed access, no
+ * peeking (the element could be gone by the time it is read) and no copy.
+ *
+ * Key features:
+ * - Lock-free MPMC queue (see @ref LIBDS_DEF_CONCURRENT_QUEUE)
+ * - Wait-free SPSC ring queue with batch calls (see @ref LIBDS_DEF_SPSC_QUEUE)
+ * - Lock-free ABA-safe stack with batch detach (see @ref LIBDS_DEF_CONCURRENT_STACK)
+ * - Nodes recycled through a lock-free pool, no allocation in steady state
+ * - Ownership transfer via dequeue and pop operations
+ *
+ * @note Requires C11 or later with `<stdatomic.h>` and lock-free 64-bit atomics
+ * @warning `create` and `delete` are NOT thread-safe, every other operation is
+ * (SPSC queues additionally restrict each side to a single thread).
+ * @warning Direct manipulation of the `_nodes` member causes undefined behavior.
+ *
+ * @see queuedef.h, stackdef.h, core.h, impl/concurrentqueue.h, impl/spscring.h,
+ * impl/concurrentstack.h
+ */
+
+#ifndef LIBDS_CONCURRENTDEF_H
+#define LIBDS_CONCURRENTDEF_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "core.h"
+#include "impl/concurrentqueue.h"
+#include "impl/spscring.h"
+#include "impl/concurrentstack.h"
+
+/**
+ * @defgroup ConcurrentContainer Concurrent Containers
+ * @brief   Containers safe to share between threads.
+ * @{
+ */
+
+/**
+ * @def     LIBDS_DEF_CONCURRENT_HANDLE
+ * @brief   Generates the container type, `delete` and the queries of a
+ * concurrent container, leaving `create` to the caller.
+ *
+ * @param   Engine      Function prefix of the engine (e.g. `ds_cq`).
+ * @param   EngineType  Struct tag of the engine state (e.g. `ds_concurrent_queue`).
+ *
+ * An engine must provide `free`, `length`, `bytes` and `is_empty` with the
+ * same contracts as the ones declared in impl/nodechain.h, the queries being
+ * safe to call concurrently.
+ */
+#define LIBDS_DEF_CONCURRENT_HANDLE(Type, ContainerType, Prefix,                \
+    Engine, EngineType)                                                         \
+                                                                                \
+    typedef struct ContainerType                                                \
+    {                                                                           \
+        const ds_copier_fn      copy;                                           \
+        const ds_destructor_fn  destroy;                                        \
+        struct EngineType       *_nodes; /* must NOT be modified directly */    \
+    } ContainerType;                                                            \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_delete(ContainerType *cont)                                        \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            Engine##_free(&cont->_nodes, cont->destroy)                         \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    /* support of both `#_length` and `#_size` */                               \
+    static inline size_t                                                        \
+    Prefix##_length(const ContainerType cont)                                   \
+    {                                                                           \
+        return Engine##_length(cont._nodes);                                    \
+    }                                                                           \
+    static inline size_t                                                        \
+    Prefix##_size(const ContainerType cont)                                     \
+    {                                                                           \
+        return Engine##_length(cont._nodes);                                    \
+    }                                                                           \
+                                                                                \
+    static inline size_t                                                        \
+    Prefix##_bytes(const ContainerType cont)                                    \
+    {                                                                           \
+        return Engine##_bytes(cont._nodes);                                     \
+    }                                                                           \
+                                                                                \
+    static inline bool                                                          \
+    Prefix##_is_empty(const ContainerType cont)                                 \
+    {                                                                           \
+        return Engine##_is_empty(cont._nodes);                                  \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_CONCURRENT_BASE
+ * @brief   Generates the functions shared by every unbounded concurrent container.
+ *
+ * Same as @ref LIBDS_DEF_CONCURRENT_HANDLE, plus a `create(void)` calling the
+ * `alloc` of the engine.
+ */
+#define LIBDS_DEF_CONCURRENT_BASE(Type, ContainerType, Prefix,                  \
+    CopyFunc, DestroyFunc, Engine, EngineType)                                  \
+                                                                                \
+    LIBDS_DEF_CONCURRENT_HANDLE(Type, ContainerType, Prefix,                    \
+        Engine, EngineType)                                                     \
+                                                                                \
+    static inline ContainerType                                                 \
+    Prefix##_create(void)                                                       \
+    {                                                                           \
+        size_t value_size  = sizeof(Type);                                      \
+        size_t value_align = alignof(Type);                                     \
+                                                                                \
+        ContainerType cont = {                                                  \
+            .copy    = (CopyFunc),                                              \
+            .destroy = (DestroyFunc),                                           \
+            ._nodes  = Engine##_alloc(value_size, value_align)                  \
+        };                                                                      \
+                                                                                \
+        if (!cont._nodes)                                                       \
+            LIBDS_HANDLE_ERR(                                                   \
+                DS_ERR_ALLOCATION_FAILED,                                       \
+                LIBDS_STRINGIFY(Engine##_alloc(value_size, value_align)),       \
+                __FILE__, __LINE__, __func__                                    \
+            );                                                                  \
+                                                                                \
+        return cont;                                                            \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def LIBDS_DEF_CONCURRENT_QUEUE
+ * @brief   Generate a type-safe lock-free MPMC queue container interface
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   QueueType   Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for simple assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * Any number of producer and consumer threads may call `enqueue` and
+ * `dequeue` on the same queue at once (Michael–Scott algorithm, see
+ * impl/concurrentqueue.h). Elements dequeue in the order their enqueue
+ * calls took effect, so the elements of a single producer keep their order.
+ *
+ * @par Ownership Transfer
+ * The `dequeue` function transfers ownership of the payload to the caller when a
+ * valid `out` pointer is provided. Passing NULL triggers automatic destruction.
+ *
+ * @par Example: Worker Pool
+ * @code
+ *  #include <stdio.h>
+ *  #include <pthread.h>
+ *  #include <libds/concurrentdef.h>
+ *
+ *  LIBDS_DEF_CONCURRENT_QUEUE(int, JobQueue, jq, NULL, NULL)
+ *
+ *  static JobQueue jobs;
+ *
+ *  static void *worker(void *arg)
+ *  {
+ *      int job;
+ *      while (jq_dequeue(jobs, &job) == DS_ERR_NONE)
+ *          printf("job %d\n", job);
+ *      return NULL;
+ *  }
+ *
+ *  int main()
+ *  {
+ *      jobs = jq_create();
+ *      for (int i = 0; i < 100; i++) jq_enqueue(jobs, i);
+ *
+ *      pthread_t threads[4];
+ *      for (int i = 0; i < 4; i++) pthread_create(&threads[i], NULL, worker, NULL);
+ *      for (int i = 0; i < 4; i++) pthread_join(threads[i], NULL);
+ *
+ *      jq_delete(&jobs);
+ *      return 0;
+ *  }
+ * @endcode
+ *
+ * @par Generated Functions (All prefixed with `Prefix_`)
+ *
+ * **Creation & Destruction (not thread-safe):**
+ * - `create(void)` - Allocate and initialize new container
+ * - `delete(QueueType*)` - Free all nodes and nullify reference
+ *
+ * **Queue Operations:**
+ * - `enqueue(QueueType, Type)` - Insert element at the back O(1) lock-free
+ * - `dequeue(QueueType, Type*)` - Remove element from the front with ownership
+ * transfer O(1) lock-free
+ *
+ * **Query:**
+ * - `length(QueueType)` / `size(QueueType)` - Element count snapshot O(1)
+ * - `bytes(QueueType)` - Total allocated memory O(1)
+ * - `is_empty(QueueType)` - Check if empty O(1)
+ *
+ * @note All operations that return @ref ds_error will report failures via stderr
+ * if @ref LIBDS_ENABLE_ERROR_PRINT is enabled.
+ */
+#define LIBDS_DEF_CONCURRENT_QUEUE(Type, QueueType, Prefix,                     \
+    CopyFunc, DestroyFunc)                                                      \
+                                                                                \
+    LIBDS_DEF_CONCURRENT_BASE(Type, QueueType, Prefix, CopyFunc, DestroyFunc,   \
+        ds_cq, ds_concurrent_queue)                                             \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_enqueue(QueueType queue, Type value)                               \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_cq_enqueue(queue._nodes, &value, queue.copy)                     \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_dequeue(QueueType queue, Type *out)                                \
+    {                                                                           \
+        Type value;                                                             \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_cq_dequeue(queue._nodes, &value)                                 \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!out && queue.destroy)                                              \
+            queue.destroy(&value);                                              \
+                                                                                \
+        else if (out)                                                           \
+            *out = value;                                                       \
+                                                                                \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def LIBDS_DEF_SPSC_QUEUE
+ * @brief   Generate a type-safe wait-free single-producer/single-consumer queue
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   QueueType   Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for simple assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * A bounded ring buffer (see impl/spscring.h) for pipelines where exactly one
+ * thread enqueues and exactly one other thread dequeues. Every operation
+ * completes in a bounded number of steps, and the producer and consumer only
+ * touch each other's cache line when their cached view of the other side
+ * runs out.
+ *
+ * @warning `enqueue` / `try_enqueue_n` must only be called by the producer
+ * thread, and `dequeue` / `try_dequeue_n` by the consumer thread.
+ *
+ * @par Example: Pipeline Stage
+ * @code
+ *  #include <pthread.h>
+ *  #include <libds/concurrentdef.h>
+ *
+ *  LIBDS_DEF_SPSC_QUEUE(int, Pipe, pipe, NULL, NULL)
+ *
+ *  static Pipe stage;
+ *
+ *  static void *producer(void *arg)
+ *  {
+ *      int batch[64];
+ *      for (int i = 0; i < 64; i++) batch[i] = i;
+ *
+ *      size_t sent = 0, pushed;
+ *      while (sent < 64)
+ *          if (pipe_try_enqueue_n(stage, batch + sent, 64 - sent, &pushed) == DS_ERR_NONE)
+ *              sent += pushed;
+ *      return NULL;
+ *  }
+ *
+ *  int main()
+ *  {
+ *      stage = pipe_create(1024);
+ *
+ *      pthread_t thread;
+ *      pthread_create(&thread, NULL, producer, NULL);
+ *
+ *      int values[64];
+ *      size_t received = 0, popped;
+ *      while (received < 64)
+ *          if (pipe_try_dequeue_n(stage, values + received, 64 - received, &popped) == DS_ERR_NONE)
+ *              received += popped;
+ *
+ *      pthread_join(thread, NULL);
+ *      pipe_delete(&stage);
+ *      return 0;
+ *  }
+ * @endcode
+ *
+ * @par Generated Functions (All prefixed with `Prefix_`)
+ *
+ * **Creation & Destruction (not thread-safe):**
+ * - `create(size_t)` - Allocate a queue bounded to the given capacity
+ * - `delete(QueueType*)` - Free the queue and nullify reference
+ *
+ * **Producer Operations:**
+ * - `enqueue(QueueType, Type)` - Insert element at the back, or fail with
+ * DS_ERR_FULL_STRUCTURE O(1) wait-free
+ * - `try_enqueue_n(QueueType, Type const*, size_t, size_t*)` - Insert as many
+ * elements of an array as fit, reporting how many were inserted O(count)
+ *
+ * **Consumer Operations:**
+ * - `dequeue(QueueType, Type*)` - Remove element from the front with ownership
+ * transfer, or fail with DS_ERR_EMPTY_STRUCTURE O(1) wait-free
+ * - `try_dequeue_n(QueueType, Type*, size_t, size_t*)` - Remove up to `count`
+ * elements into an array, reporting how many were removed O(count)
+ *
+ * **Query:**
+ * - `length(QueueType)` / `size(QueueType)` - Element count snapshot O(1)
+ * - `capacity(QueueType)` - Maximum element count O(1)
+ * - `bytes(QueueType)` - Total allocated memory O(1)
+ * - `is_empty(QueueType)` - Check if empty O(1)
+ *
+ * @note All operations that return @ref ds_error will report failures via stderr
+ * if @ref LIBDS_ENABLE_ERROR_PRINT is enabled.
+ */
+#define LIBDS_DEF_SPSC_QUEUE(Type, QueueType, Prefix, CopyFunc, DestroyFunc)    \
+                                                                                \
+    LIBDS_DEF_CONCURRENT_HANDLE(Type, QueueType, Prefix, ds_sr, ds_spsc_ring)   \
+                                                                                \
+    static inline QueueType                                                     \
+    Prefix##_create(const size_t capacity)                                      \
+    {                                                                           \
+        size_t value_size  = sizeof(Type);                                      \
+        size_t value_align = alignof(Type);                                     \
+                                                                                \
+        QueueType queue = {                                                     \
+            .copy    = (CopyFunc),                                              \
+            .destroy = (DestroyFunc),                                           \
+            ._nodes  = ds_sr_alloc(value_size, value_align, capacity)           \
+        };                                                                      \
+                                                                                \
+        if (!queue._nodes)                                                      \
+            LIBDS_HANDLE_ERR(                                                   \
+                DS_ERR_ALLOCATION_FAILED,                                       \
+                LIBDS_STRINGIFY(ds_sr_alloc(value_size, value_align,            \
+                    capacity)),                                                 \
+                __FILE__, __LINE__, __func__                                    \
+            );                                                                  \
+                                                                                \
+        return queue;                                                           \
+    }                                                                           \
+                                                                                \
+    static inline size_t                                                        \
+    Prefix##_capacity(const QueueType queue)                                    \
+    {                                                                           \
+        return ds_sr_capacity(queue._nodes);                                    \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_enqueue(QueueType queue, Type value)                               \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_sr_try_enqueue(queue._nodes, &value, queue.copy)                 \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_try_enqueue_n(QueueType queue, Type const *values,                 \
+        const size_t count, size_t *pushed)                                     \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_sr_try_enqueue_n(queue._nodes, values, count, sizeof(Type),      \
+                queue.copy, queue.destroy, pushed)                              \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_dequeue(QueueType queue, Type *out)                                \
+    {                                                                           \
+        Type value;                                                             \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_sr_try_dequeue(queue._nodes, &value)                             \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!out && queue.destroy)                                              \
+            queue.destroy(&value);                                              \
+                                                                                \
+        else if (out)                                                           \
+            *out = value;                                                       \
+                                                                                \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_try_dequeue_n(QueueType queue, Type *out, const size_t count,      \
+        size_t *popped)                                                         \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_sr_try_dequeue_n(queue._nodes, out, count, sizeof(Type),         \
+                queue.destroy, popped)                                          \
+        );                                                                      \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def LIBDS_DEF_CONCURRENT_STACK
+ * @brief   Generate a type-safe lock-free stack container interface
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   StackType   Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for simple assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * Any number of threads may push and pop on the same stack at once (Treiber
+ * algorithm with tagged tops against ABA, see impl/concurrentstack.h), which
+ * makes it a natural shared free-list of work items.
+ *
+ * @par Ownership Transfer
+ * `pop` and `pop_all` transfer ownership of the payloads to the caller when a
+ * valid `out` pointer is provided. Passing NULL triggers automatic destruction.
+ *
+ * @par Example: Shared Free-List
+ * @code
+ *  #include <stdlib.h>
+ *  #include <libds/concurrentdef.h>
+ *
+ *  typedef struct { char buffer[4096]; } Work;
+ *
+ *  LIBDS_DEF_CONCURRENT_STACK(Work *, FreeList, fl, NULL, NULL)
+ *
+ *  static FreeList spare;  // shared by every worker thread
+ *
+ *  Work *get_work(void)
+ *  {
+ *      Work *work;
+ *      if (fl_pop(spare, &work) != DS_ERR_NONE)
+ *          work = malloc(sizeof(Work));
+ *      return work;
+ *  }
+ *
+ *  void put_work(Work *work)
+ *  {
+ *      fl_push(spare, work);
+ *  }
+ *
+ *  void shutdown(void)
+ *  {
+ *      Work **all;
+ *      size_t count;
+ *      if (fl_pop_all(spare, &all, &count) == DS_ERR_NONE)
+ *      {
+ *          for (size_t i = 0; i < count; i++) free(all[i]);
+ *          free(all);
+ *      }
+ *      fl_delete(&spare);
+ *  }
+ * @endcode
+ *
+ * @par Generated Functions (All prefixed with `Prefix_`)
+ *
+ * **Creation & Destruction (not thread-safe):**
+ * - `create(void)` - Allocate and initialize new container
+ * - `delete(StackType*)` - Free all nodes and nullify reference
+ *
+ * **Stack Operations:**
+ * - `push(StackType, Type)` - Insert element on top O(1) lock-free
+ * - `pop(StackType, Type*)` - Remove the top element with ownership transfer
+ * O(1) lock-free
+ * - `pop_all(StackType, Type**, size_t*)` - Detach every element with a single
+ * atomic swap and return them, top first, in a heap array to be released with
+ * free() O(N)
+ *
+ * **Query:**
+ * - `length(StackType)` / `size(StackType)` - Element count snapshot O(1)
+ * - `bytes(StackType)` - Total allocated memory O(1)
+ * - `is_empty(StackType)` - Check if empty O(1)
+ *
+ * @note All operations that return @ref ds_error will report failures via stderr
+ * if @ref LIBDS_ENABLE_ERROR_PRINT is enabled.
+ */
+#define LIBDS_DEF_CONCURRENT_STACK(Type, StackType, Prefix,                     \
+    CopyFunc, DestroyFunc)                                                      \
+                                                                                \
+    LIBDS_DEF_CONCURRENT_BASE(Type, StackType, Prefix, CopyFunc, DestroyFunc,   \
+        ds_cs, ds_concurrent_stack)                                             \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_push(StackType stack, Type value)                                  \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_cs_push(stack._nodes, &value, stack.copy)                        \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_pop(StackType stack, Type *out)                                    \
+    {                                                                           \
+        Type value;                                                             \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_cs_pop(stack._nodes, &value)                                     \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!out && stack.destroy)                                              \
+            stack.destroy(&value);                                              \
+                                                                                \
+        else if (out)                                                           \
+            *out = value;                                                       \
+                                                                                \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_pop_all(StackType stack, Type **out, size_t *count)                \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_cs_pop_all(stack._nodes, (void **)out, count, stack.destroy)     \
+        );                                                                      \
+    }                                                                           \
+/* end of macro */
+
+/** @} */ //end of ConcurrentContainer group
+
+#endif //LIBDS_CONCURRENTDEF_H
@@ -85,6 +85,98 @@
 #endif
 
 
+/**
+ * @def     LIBDS_NC_TRIM_RATIO
+ * @brief   Default share of free slots above which a node chain trims itself.
+ *
+ * When the recycled slots of a chain exceed this fraction of all its slots,
+ * releasing a node also returns the chunks that hold no live node to the
+ * allocator (see ds_nc_trim()). Each chain can override it at run time.
+ *
+ * @note    Must be within [0, 1]. Zero disables automatic trimming.
+ */
+#ifndef LIBDS_NC_TRIM_RATIO
+#define LIBDS_NC_TRIM_RATIO 0.0f
+#endif
+
+
+/**
+ * @def     LIBDS_NC_MAGAZINE_SIZE
+ * @brief   Number of node slots held by one thread cache magazine.
+ *
+ * Chains created with a `_cached` constructor take and return their nodes
+ * through per-thread magazines, and only reach the shared depot once a
+ * magazine runs empty or full. Larger magazines mean fewer depot exchanges
+ * at the cost of more idle slots per thread.
+ *
+ * @note    Must be a strictly positive integer.
+ */
+#ifndef LIBDS_NC_MAGAZINE_SIZE
+#define LIBDS_NC_MAGAZINE_SIZE 32
+#endif
+
+
+/**
+ * @def     LIBDS_NC_DESTROY_BATCH_SIZE
+ * @brief   Number of values handed over at once to a batch destructor.
+ *
+ * Node chains freed or cleared with a @ref ds_batch_destructor_fn gather the
+ * addresses of their values on the stack, and call the destructor once per
+ * full batch.
+ *
+ * @note    Must be a strictly positive integer.
+ */
+#ifndef LIBDS_NC_DESTROY_BATCH_SIZE
+#define LIBDS_NC_DESTROY_BATCH_SIZE 64
+#endif
+
+
+/**
+ * @def     LIBDS_HUGE_PAGE_SIZE
+ * @brief   Assumed size (in bytes) of a transparent huge page.
+ *
+ * Mappings of the page allocator (see @ref ds_page_allocator) created with
+ * @ref DS_PAGES_HUGE that are at least this large are aligned and rounded to
+ * it, so the kernel can back them with huge pages.
+ *
+ * @note    Must be a power of two, multiple of the base page size.
+ * @note    Defaults to 2 MiB, the PMD size of x86-64 and most ARM64 kernels.
+ */
+#ifndef LIBDS_HUGE_PAGE_SIZE
+#define LIBDS_HUGE_PAGE_SIZE ((size_t)2 << 20)
+#endif
+
+
+/**
+ * @def     LIBDS_CACHE_LINE_SIZE
+ * @brief   Assumed size (in bytes) of a CPU cache line.
+ *
+ * Used to size the nodes of cache-conscious engines.
+ *
+ * @note    Must be a power of two.
+ * @note    Defaults to 64, the line size of most x86-64 and ARM cores.
+ */
+#ifndef LIBDS_CACHE_LINE_SIZE
+#define LIBDS_CACHE_LINE_SIZE 64
+#endif
+
+
+/**
+ * @def     LIBDS_UC_NODE_BYTES
+ * @brief   Target size (in bytes) of a node in the unrolled engine.
+ *
+ * Each unrolled node packs as many elements as fit in this many bytes,
+ * next to its header. Types too large to fit a few elements get the
+ * smallest multiple of LIBDS_CACHE_LINE_SIZE that holds them.
+ *
+ * @note    Should be a multiple of LIBDS_CACHE_LINE_SIZE.
+ * @note    Defaults to two cache lines.
+ */
+#ifndef LIBDS_UC_NODE_BYTES
+#define LIBDS_UC_NODE_BYTES (2 * LIBDS_CACHE_LINE_SIZE)
+#endif
+
+
 #if LIBDS_ENABLE_ERROR_PRINT || LIBDS_ENABLE_EXIT_ON_FAIL
 #define LIBDS_CHECK(Expr) \
     ds_handle_err((Expr), #Expr, __FILE__, __LINE__, __func__)
@@ -109,6 +201,80 @@
  */
 struct ds_node_chain;
 
+/**
+ * @struct  ds_node_pool
+ * @brief   Opaque handle for a node pool shared by several node chains.
+ *
+ * Chains attached to the same pool draw their slots from its chunks and hand
+ * them back to it, so freed nodes flow between containers of the same type.
+ */
+struct ds_node_pool;
+
+/**
+ * @struct  ds_nc_snapshot
+ * @brief   Opaque handle for a read-only, reference-counted view of a node chain.
+ *
+ * Shares the nodes of the chain until the chain is modified in a way the
+ * snapshot could see, and keeps the original nodes alive from then on.
+ */
+struct ds_nc_snapshot;
+
+/**
+ * @struct  ds_unrolled_chain
+ * @brief   Opaque handle for the unrolled node engine.
+ *
+ * Stores several elements per node to cut pointer chasing and link overhead.
+ */
+struct ds_unrolled_chain;
+
+/**
+ * @struct  ds_skip_list
+ * @brief   Opaque handle for the indexable skip list engine.
+ *
+ * Links elements on several levels with span counts for O(log N) positional access.
+ */
+struct ds_skip_list;
+
+/**
+ * @struct  ds_ring_buffer
+ * @brief   Opaque handle for the contiguous ring buffer engine.
+ *
+ * Stores elements in a single power-of-two array, optionally bounded.
+ */
+struct ds_ring_buffer;
+
+/**
+ * @struct  ds_segmented_stack
+ * @brief   Opaque handle for the segmented array stack engine.
+ *
+ * Stores elements in contiguous segments that never move on growth.
+ */
+struct ds_segmented_stack;
+
+/**
+ * @struct  ds_concurrent_queue
+ * @brief   Opaque handle for the lock-free MPMC queue engine.
+ *
+ * Lets any number of threads enqueue and dequeue at once without locking.
+ */
+struct ds_concurrent_queue;
+
+/**
+ * @struct  ds_spsc_ring
+ * @brief   Opaque handle for the wait-free single-producer/single-consumer ring.
+ *
+ * Bounded ring shared by exactly one producer and one consumer thread.
+ */
+struct ds_spsc_ring;
+
+/**
+ * @struct  ds_concurrent_stack
+ * @brief   Opaque handle for the lock-free stack engine.
+ *
+ * Lets any number of threads push and pop at once without locking.
+ */
+struct ds_concurrent_stack;
+
 /**
  * @enum    ds_error
  * @brief   Standard error codes returned by library operations.
@@ -124,6 +290,9 @@ enum ds_error
    DS_ERR_INDEX_OUT_OF_BOUNDS, /**< Index exceeds valid range */
    DS_ERR_EMPTY_STRUCTURE,     /**< Operation invalid on empty structure */
    DS_ERR_COPY_FAILED,         /**< User-defined copy operation failed */
+   DS_ERR_FULL_STRUCTURE,      /**< Operation exceeds a fixed capacity */
+   DS_ERR_STALE_CURSOR,        /**< Cursor placed before its nodes were shared or moved */
+   DS_ERR_UNSUPPORTED,         /**< Operation unavailable in the current state */
 };
 
 /**
@@ -141,6 +310,21 @@ enum ds_error
  */
 typedef void (*ds_destructor_fn)(void *data);
 
+/**
+ * @brief   Batch destructor function contract for stored values.
+ *
+ * @param   items Array of pointers to fully initialized elements.
+ * @param   count Number of pointers in `items`, strictly positive.
+ *
+ * Releases the resources owned by every value of `items`, as
+ * @ref ds_destructor_fn would for each one, in a single call: the values
+ * can then be handled in bulk (e.g. returned to an arena at once).
+ *
+ * @note    Neither the memory of the values nor the `items` array belong to
+ *          the function, and none of them may be kept after it returns.
+ */
+typedef void (*ds_batch_destructor_fn)(void **items, size_t count);
+
 /**
  * @brief   Copier function contract for value duplication.
  *
@@ -162,6 +346,102 @@ typedef void (*ds_destructor_fn)(void *data);
  */
 typedef bool (*ds_copier_fn)(void *dst, const void *src);
 
+/**
+ * @brief   Comparator function contract for ordering values (as in qsort).
+ *
+ * @param   a Pointer to a valid value.
+ * @param   b Pointer to a valid value.
+ *
+ * @return  A negative value if `a` goes before `b`, a positive value if it
+ *          goes after, 0 if they are equivalent.
+ */
+typedef int (*ds_comparator_fn)(const void *a, const void *b);
+
+/**
+ * @struct  ds_allocator
+ * @brief   Memory allocator used by the engines for their own heap memory.
+ *
+ * Every call receives @p context first, so one set of functions can serve
+ * several arenas. Sizes are always passed back, for sized deallocation and
+ * accounting.
+ *
+ * - `alloc` returns a block of at least `size` bytes aligned for any object
+ *   (like malloc), or NULL on failure.
+ * - `realloc` resizes a block from `old_size` to `new_size` bytes (like
+ *   realloc, the block is untouched on failure). May be NULL, the library
+ *   then uses `alloc`, a copy and `free`.
+ * - `free` releases a block of `size` bytes (never called with NULL).
+ * - `good_size` returns the usable size the allocator would actually reserve
+ *   for a request of `size` bytes (at least `size`). May be NULL. Chunked
+ *   engines then grow their chunks to fill it, instead of wasting the slack.
+ *
+ * @note    Concurrent containers and the thread cache of cached containers
+ *          always use the C library allocator.
+ */
+struct ds_allocator
+{
+    void *(*alloc)(void *context, size_t size);
+    void *(*realloc)(void *context, void *ptr, size_t old_size, size_t new_size);
+    void (*free)(void *context, void *ptr, size_t size);
+    size_t (*good_size)(void *context, size_t size);
+    void *context;
+};
+
+/**
+ * @brief   Sets the allocator captured by every engine created afterwards.
+ *
+ * @param   allocator  New default allocator (copied), or NULL to restore the
+ *                     C library allocator.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if `alloc` or `free` is missing.
+ *
+ * @details Each engine keeps the allocator it was created with, so changing
+ * the default never affects live containers.
+ *
+ * @warning Not thread-safe: set it before creating containers.
+ */
+enum ds_error
+ds_set_allocator(const struct ds_allocator *allocator);
+
+/**
+ * @brief   Returns the current default allocator (never NULL).
+ */
+const struct ds_allocator *
+ds_get_allocator(void);
+
+/**
+ * @enum    ds_page_flags
+ * @brief   Options of the page allocator.
+ */
+enum ds_page_flags
+{
+    DS_PAGES_DEFAULT  = 0,      /**< Page-rounded anonymous mappings */
+    DS_PAGES_HUGE     = 1 << 0, /**< Align large mappings for transparent huge pages */
+    DS_PAGES_POPULATE = 1 << 1, /**< Pre-fault every page when mapping it */
+};
+
+/**
+ * @brief   Builds an allocator that maps every block straight from the OS.
+ *
+ * @param   flags  Bitwise OR of @ref ds_page_flags.
+ *
+ * @return  An allocator (to pass to @ref ds_set_allocator or a
+ * `create_with_allocator`) whose blocks are anonymous mappings, rounded to
+ * the page size, and released with `munmap` on free or deep clear. Its
+ * `good_size` hook lets node chunks fill whole pages.
+ *
+ * @details With @ref DS_PAGES_HUGE, blocks of at least @ref LIBDS_HUGE_PAGE_SIZE
+ * are rounded and aligned to it and advised for huge pages, which cuts TLB
+ * misses when chasing nodes over a large chain. With @ref DS_PAGES_POPULATE,
+ * pages are faulted in at allocation time instead of on first touch.
+ *
+ * @note    Meant for large, long-lived containers: every chunk costs at least
+ * one page. On systems without `mmap`, the C library allocator is returned.
+ */
+struct ds_allocator
+ds_page_allocator(unsigned flags);
+
 /**
  * @brief   Converts an error code into a string.
  *
@@ -0,0 +1,142 @@
+/**
+ * @file    concurrentqueue.h
+ * @brief   Low-level lock-free MPMC queue management (unsafe for direct use).
+ *
+ * A Michael–Scott queue: a singly-linked chain starting at a dummy node, where
+ * producers link new nodes after the tail and consumers advance the head with
+ * compare-and-swap, so any number of threads may enqueue and dequeue at once
+ * without taking a lock.
+ *
+ * Nodes come from a lock-free pool that uses the node chain slot layout and
+ * recycles dequeued nodes through a tagged free list, so the steady state
+ * allocates nothing.
+ *
+ * @warning THIS HEADER IS NOT A PART OF THE PUBLIC API.
+ * These functions operate on raw bytes and provide NO TYPE-SAFETY.
+ * It is intended for INTERNAL USE ONLY by higher-level type-safe
+ * data structures. Direct use may lead to MEMORY CORRUPTION or
+ * UNDEFINED BEHAVIOR.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_IMPL_CONCURRENTQUEUE_H
+#define LIBDS_IMPL_CONCURRENTQUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "libds/core.h"
+
+/**
+ * @defgroup ConcurrentQueueInternals Concurrent Queue Internals
+ * @brief    Raw memory lock-free queue management (type‑unsafe).
+ *
+ * Only `enqueue`, `dequeue` and the queries are thread-safe; allocating and
+ * freeing the queue must not race with any other call.
+ * @{
+ */
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+/**
+ * @brief   Allocates a new empty queue.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new queue, or NULL if @p value_size / @p value_align
+ * are invalid or on allocation failure.
+ */
+struct ds_concurrent_queue *
+ds_cq_alloc(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Frees the queue, its pool and the elements left in it.
+ * @see     ds_nc_free
+ *
+ * @warning Not thread-safe.
+ */
+enum ds_error
+ds_cq_free(struct ds_concurrent_queue **queue_ref, ds_destructor_fn destroy);
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+/**
+ * @brief   Returns the number of stored elements, or 0 if queue is NULL.
+ *
+ * @note    Under contention the count is a snapshot that may already be stale.
+ */
+size_t
+ds_cq_length(const struct ds_concurrent_queue *queue);
+
+/**
+ * @brief   Calculates the total heap memory footprint of the queue.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+size_t
+ds_cq_bytes(const struct ds_concurrent_queue *queue);
+
+/**
+ * @brief   Checks whether the queue is empty (or NULL).
+ */
+bool
+ds_cq_is_empty(const struct ds_concurrent_queue *queue);
+
+
+//==============================================================================
+// Enqueue / Dequeue Value
+//==============================================================================
+
+/**
+ * @brief   Appends a copy of @p value at the back of the queue.
+ *
+ * @param[in,out] queue  Pointer to the queue.
+ * @param[in]     value  Pointer to the value to store.
+ * @param[in]     copy   Copier called before the node is published,
+ * or NULL for a bitwise copy.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_ALLOCATION_FAILED on memory exhaustion, or
+ * DS_ERR_COPY_FAILED if @p copy fails (the queue is left untouched).
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized, lock-free
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_cq_enqueue(struct ds_concurrent_queue *queue, const void *value, ds_copier_fn copy);
+
+/**
+ * @brief   Removes the front element, moving it into @p out.
+ *
+ * @param[in,out] queue  Pointer to the queue.
+ * @param[out]    out    Buffer of at least `value_size` bytes receiving the
+ * element, whose ownership is transferred to the caller.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_EMPTY_STRUCTURE if the queue is empty.
+ *
+ * @details Unlike `ds_nc_pop_front`, the element is copied out: a node is
+ * recycled as soon as it is unlinked, so no pointer into it can be returned.
+ *
+ * @par Complexity
+ * - Time:  O(1), lock-free
+ * - Space: O(1)
+ */
+enum ds_error
+ds_cq_dequeue(struct ds_concurrent_queue *queue, void *out);
+
+/** @} */ //end of ConcurrentQueueInternals group
+
+#endif //LIBDS_IMPL_CONCURRENTQUEUE_H
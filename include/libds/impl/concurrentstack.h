@@ -0,0 +1,131 @@
+/**
+ * @file    concurrentstack.h
+ * @brief   Low-level lock-free stack management (unsafe for direct use).
+ *
+ * A Treiber stack: a singly-linked chain whose top is swapped with
+ * compare-and-swap, so any number of threads may push and pop at once
+ * without taking a lock. The top is a tagged index advanced on every update,
+ * which makes a node popped and pushed back meanwhile (ABA) fail stale swaps.
+ *
+ * Nodes come from the same lock-free pool as the concurrent queue: chunks of
+ * doubling size carved from a bump counter, refilled concurrently without a
+ * lock, and recycled through a tagged free list.
+ *
+ * @warning THIS HEADER IS NOT A PART OF THE PUBLIC API.
+ * These functions operate on raw bytes and provide NO TYPE-SAFETY.
+ * It is intended for INTERNAL USE ONLY by higher-level type-safe
+ * data structures. Direct use may lead to MEMORY CORRUPTION or
+ * UNDEFINED BEHAVIOR.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_IMPL_CONCURRENTSTACK_H
+#define LIBDS_IMPL_CONCURRENTSTACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "libds/core.h"
+
+/**
+ * @defgroup ConcurrentStackInternals Concurrent Stack Internals
+ * @brief    Raw memory lock-free stack management (type‑unsafe).
+ *
+ * Every function mirrors the contract of its `ds_cq_` counterpart declared
+ * in impl/concurrentqueue.h; only the differences are documented here.
+ * @{
+ */
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+/**
+ * @brief   Allocates a new empty stack.
+ * @see     ds_cq_alloc
+ */
+struct ds_concurrent_stack *
+ds_cs_alloc(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Frees the stack, its pool and the elements left in it.
+ * @see     ds_cq_free
+ */
+enum ds_error
+ds_cs_free(struct ds_concurrent_stack **stack_ref, ds_destructor_fn destroy);
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+/**
+ * @brief   Returns the number of stored elements, or 0 if stack is NULL.
+ * @see     ds_cq_length
+ */
+size_t
+ds_cs_length(const struct ds_concurrent_stack *stack);
+
+/**
+ * @brief   Calculates the total heap memory footprint of the stack.
+ */
+size_t
+ds_cs_bytes(const struct ds_concurrent_stack *stack);
+
+/**
+ * @brief   Checks whether the stack is empty (or NULL).
+ */
+bool
+ds_cs_is_empty(const struct ds_concurrent_stack *stack);
+
+
+//==============================================================================
+// Push / Pop Value
+//==============================================================================
+
+/**
+ * @brief   Pushes a copy of @p value on top of the stack.
+ * @see     ds_cq_enqueue
+ */
+enum ds_error
+ds_cs_push(struct ds_concurrent_stack *stack, const void *value, ds_copier_fn copy);
+
+/**
+ * @brief   Removes the top element, moving it into @p out.
+ * @see     ds_cq_dequeue
+ */
+enum ds_error
+ds_cs_pop(struct ds_concurrent_stack *stack, void *out);
+
+/**
+ * @brief   Detaches every element at once and hands them over in an array.
+ *
+ * @param[in,out] stack    Pointer to the stack.
+ * @param[out]    out      Receives a heap array (to be released with free())
+ * holding the elements from the top down, whose ownership is transferred to
+ * the caller, or NULL if the stack was empty. If @p out itself is NULL, the
+ * elements are destroyed with @p destroy instead.
+ * @param[out]    count    Receives the number of detached elements (may be NULL).
+ * @param[in]     destroy  Destructor used when @p out is NULL, or NULL.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if @p stack is NULL,
+ * DS_ERR_EMPTY_STRUCTURE if the stack is empty, or
+ * DS_ERR_ALLOCATION_FAILED if the array cannot be allocated (the elements
+ * are pushed back, on top of whatever was pushed meanwhile).
+ *
+ * @details The whole chain is taken with a single successful compare-and-swap
+ * of the top, so a batch consumer sees a consistent snapshot and concurrent
+ * pushes simply start a new chain.
+ *
+ * @par Complexity
+ * - Time:  O(N), one atomic swap plus a private walk of the detached chain
+ * - Space: O(N) for the returned array
+ */
+enum ds_error
+ds_cs_pop_all(struct ds_concurrent_stack *stack, void **out, size_t *count, ds_destructor_fn destroy);
+
+/** @} */ //end of ConcurrentStackInternals group
+
+#endif //LIBDS_IMPL_CONCURRENTSTACK_H
@@ -16,14 +16,39 @@
 #include "libds/core.h"
 #include "nodechain.h"
 
-#define LIBDS_DEF_CONTAINER(Type, ContainerType, Prefix,                        \
-    CopyFunc, DestroyFunc)                                                      \
+/**
+ * @def     LIBDS_DEF_CONTAINER_BASE
+ * @brief   Generates the functions shared by every container, on top of any engine.
+ *
+ * @param   Engine      Function prefix of the engine (e.g. `ds_nc`, `ds_uc`).
+ * @param   EngineType  Struct tag of the engine state (e.g. `ds_node_chain`).
+ *
+ * An engine must provide `alloc`, `free`, `clear`, `copy`, `length`, `bytes`,
+ * `is_empty`, `get_front`, `get_back` and `get_at` with the same contracts as
+ * the ones declared in impl/nodechain.h.
+ */
+#define LIBDS_DEF_CONTAINER_BASE(Type, ContainerType, Prefix,                   \
+    CopyFunc, DestroyFunc, Engine, EngineType)                                  \
+                                                                                \
+    LIBDS_DEF_CONTAINER_BASE_ALLOC(Type, ContainerType, Prefix,                 \
+        CopyFunc, DestroyFunc, Engine, EngineType, Engine##_alloc)              \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_CONTAINER_BASE_ALLOC
+ * @brief   Same as @ref LIBDS_DEF_CONTAINER_BASE, with a custom engine constructor.
+ *
+ * @param   AllocFunc   Function called by `create`, with the same signature as
+ *                      the `alloc` of the engine (e.g. `ds_nc_alloc_doubly`).
+ */
+#define LIBDS_DEF_CONTAINER_BASE_ALLOC(Type, ContainerType, Prefix,             \
+    CopyFunc, DestroyFunc, Engine, EngineType, AllocFunc)                       \
                                                                                 \
     typedef struct ContainerType                                                \
     {                                                                           \
         const ds_copier_fn      copy;                                           \
         const ds_destructor_fn  destroy;                                        \
-        struct ds_node_chain    *_nodes; /* must NOT be modified directly */    \
+        struct EngineType       *_nodes; /* must NOT be modified directly */    \
     } ContainerType;                                                            \
                                                                                 \
     static inline ContainerType                                                 \
@@ -35,13 +60,13 @@
         ContainerType cont = {                                                  \
             .copy    = (CopyFunc),                                              \
             .destroy = (DestroyFunc),                                           \
-            ._nodes  = ds_nc_alloc(value_size, value_align)                     \
+            ._nodes  = AllocFunc(value_size, value_align)                       \
         };                                                                      \
                                                                                 \
         if (!cont._nodes)                                                       \
             LIBDS_HANDLE_ERR(                                                   \
                 DS_ERR_ALLOCATION_FAILED,                                       \
-                LIBDS_STRINGIFY(ds_nc_alloc(value_size, value_align)),          \
+                LIBDS_STRINGIFY(AllocFunc(value_size, value_align)),            \
                 __FILE__, __LINE__, __func__                                    \
             );                                                                  \
                                                                                 \
@@ -52,7 +77,7 @@
     Prefix##_delete(ContainerType *cont)                                        \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_free(&cont->_nodes, cont->destroy)                            \
+            Engine##_free(&cont->_nodes, cont->destroy)                         \
         );                                                                      \
     }                                                                           \
                                                                                 \
@@ -60,7 +85,7 @@
     Prefix##_clear(ContainerType cont)                                          \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_clear(cont._nodes, cont.destroy, false)                       \
+            Engine##_clear(cont._nodes, cont.destroy, false)                    \
         );                                                                      \
     }                                                                           \
                                                                                 \
@@ -68,7 +93,7 @@
     Prefix##_deep_clear(ContainerType cont)                                     \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_clear(cont._nodes, cont.destroy, true)                        \
+            Engine##_clear(cont._nodes, cont.destroy, true)                     \
         );                                                                      \
     }                                                                           \
                                                                                 \
@@ -76,7 +101,7 @@
     Prefix##_copy(ContainerType dst_cont, const ContainerType src_cont)         \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_copy(                                                         \
+            Engine##_copy(                                                      \
                 dst_cont._nodes,                                                \
                 src_cont._nodes,                                                \
                 sizeof(Type),                                                   \
@@ -90,24 +115,24 @@
     static inline size_t                                                        \
     Prefix##_length(const ContainerType cont)                                   \
     {                                                                           \
-        return ds_nc_length(cont._nodes);                                       \
+        return Engine##_length(cont._nodes);                                    \
     }                                                                           \
     static inline size_t                                                        \
     Prefix##_size(const ContainerType cont)                                     \
     {                                                                           \
-        return ds_nc_length(cont._nodes);                                       \
+        return Engine##_length(cont._nodes);                                    \
     }                                                                           \
                                                                                 \
     static inline size_t                                                        \
     Prefix##_bytes(const ContainerType cont)                                    \
     {                                                                           \
-        return ds_nc_bytes(cont._nodes);                                        \
+        return Engine##_bytes(cont._nodes);                                     \
     }                                                                           \
                                                                                 \
     static inline bool                                                          \
     Prefix##_is_empty(const ContainerType cont)                                 \
     {                                                                           \
-        return ds_nc_is_empty(cont._nodes);                                     \
+        return Engine##_is_empty(cont._nodes);                                  \
     }                                                                           \
                                                                                 \
     static inline enum ds_error                                                 \
@@ -115,7 +140,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_get_front(cont._nodes, &data)                                 \
+            Engine##_get_front(cont._nodes, &data)                              \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -128,7 +153,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_get_back(cont._nodes, &data)                                  \
+            Engine##_get_back(cont._nodes, &data)                               \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -141,7 +166,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_get_at(cont._nodes, index, &data)                             \
+            Engine##_get_at(cont._nodes, index, &data)                          \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -150,4 +175,262 @@
     }                                                                           \
 /* end of macro */
 
+/**
+ * @def     LIBDS_DEF_CHAIN_CONTAINER
+ * @brief   Base container backed by the node chain engine.
+ *
+ * @param   AllocFunc   Chain constructor, `ds_nc_alloc` or `ds_nc_alloc_doubly`.
+ *
+ * Also generates `create_cached`, which builds the chain with the `_cached`
+ * variant of @p AllocFunc, and `cache_stats`. Likewise, `create_pool` and
+ * `create_in` use its `_pool` and `_with_pool` variants, and
+ * `create_with_allocator` its `_ex` variant. `trim`, `shrink_to_fit` and
+ * `set_auto_trim` release the idle chunks of the chain (see ds_nc_trim()),
+ * and `compact` packs its elements in traversal order (see ds_nc_compact()),
+ * returning DS_ERR_UNSUPPORTED on cached or pooled containers and while a
+ * snapshot reads them.
+ * `reserve` and `capacity` preallocate exact room (see ds_nc_reserve()).
+ * `swap` exchanges the contents of two containers and `move` hands the
+ * content of a container over to another, both in O(1) whatever their
+ * allocators (see ds_nc_swap()).
+ * `concat` moves every element of a container to the end of another, and
+ * `transfer` its first `count` elements, relinking the nodes when the chains
+ * share their slots (see ds_nc_splice() and ds_nc_transfer()).
+ * `delete_batch`, `clear_batch` and `deep_clear_batch` hand the elements to a
+ * @ref ds_batch_destructor_fn, in place of the destructor of the container
+ * (see ds_nc_free_batch() and ds_nc_clear_batch()).
+ */
+#define LIBDS_DEF_CHAIN_CONTAINER(Type, ContainerType, Prefix,                  \
+    CopyFunc, DestroyFunc, AllocFunc)                                           \
+                                                                                \
+    LIBDS_DEF_CONTAINER_BASE_ALLOC(Type, ContainerType, Prefix,                 \
+        CopyFunc, DestroyFunc, ds_nc, ds_node_chain, AllocFunc)                 \
+                                                                                \
+    static inline ContainerType                                                 \
+    Prefix##_create_cached(void)                                                \
+    {                                                                           \
+        size_t value_size  = sizeof(Type);                                      \
+        size_t value_align = alignof(Type);                                     \
+                                                                                \
+        ContainerType cont = {                                                  \
+            .copy    = (CopyFunc),                                              \
+            .destroy = (DestroyFunc),                                           \
+            ._nodes  = AllocFunc##_cached(value_size, value_align)              \
+        };                                                                      \
+                                                                                \
+        if (!cont._nodes)                                                       \
+            LIBDS_HANDLE_ERR(                                                   \
+                DS_ERR_ALLOCATION_FAILED,                                       \
+                LIBDS_STRINGIFY(AllocFunc##_cached(value_size, value_align)),   \
+                __FILE__, __LINE__, __func__                                    \
+            );                                                                  \
+                                                                                \
+        return cont;                                                            \
+    }                                                                           \
+                                                                                \
+    static inline ContainerType                                                 \
+    Prefix##_create_with_allocator(const struct ds_allocator *allocator)        \
+    {                                                                           \
+        size_t value_size  = sizeof(Type);                                      \
+        size_t value_align = alignof(Type);                                     \
+                                                                                \
+        ContainerType cont = {                                                  \
+            .copy    = (CopyFunc),                                              \
+            .destroy = (DestroyFunc),                                           \
+            ._nodes  = AllocFunc##_ex(value_size, value_align, allocator)       \
+        };                                                                      \
+                                                                                \
+        if (!cont._nodes)                                                       \
+            LIBDS_HANDLE_ERR(                                                   \
+                DS_ERR_ALLOCATION_FAILED,                                       \
+                LIBDS_STRINGIFY(                                                \
+                    AllocFunc##_ex(value_size, value_align, allocator)          \
+                ),                                                              \
+                __FILE__, __LINE__, __func__                                    \
+            );                                                                  \
+                                                                                \
+        return cont;                                                            \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_cache_stats(const ContainerType cont, struct ds_cache_stats *out)  \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_cache_stats(cont._nodes, out)                                 \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_delete_batch(ContainerType *cont, ds_batch_destructor_fn destroy)  \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_free_batch(&cont->_nodes, destroy)                            \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_clear_batch(ContainerType cont, ds_batch_destructor_fn destroy)    \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_clear_batch(cont._nodes, destroy, false)                      \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_deep_clear_batch(ContainerType cont,                               \
+                              ds_batch_destructor_fn destroy)                   \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_clear_batch(cont._nodes, destroy, true)                       \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_reserve(const ContainerType cont, size_t capacity)                 \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_reserve(cont._nodes, capacity)                                \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline size_t                                                        \
+    Prefix##_capacity(const ContainerType cont)                                 \
+    {                                                                           \
+        return ds_nc_capacity(cont._nodes);                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_trim(const ContainerType cont, size_t keep_bytes)                  \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_trim(cont._nodes, keep_bytes)                                 \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_shrink_to_fit(const ContainerType cont)                            \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_trim(cont._nodes, 0)                                          \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_set_auto_trim(const ContainerType cont, float ratio)               \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_set_trim_ratio(cont._nodes, ratio)                            \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_compact(const ContainerType cont)                                  \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_compact(cont._nodes)                                          \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline double                                                        \
+    Prefix##_link_distance(const ContainerType cont)                            \
+    {                                                                           \
+        return ds_nc_link_distance(cont._nodes);                                \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_move(const ContainerType dst_cont, const ContainerType src_cont)   \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_move(dst_cont._nodes, src_cont._nodes, dst_cont.destroy)      \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_swap(const ContainerType cont_a, const ContainerType cont_b)       \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_swap(cont_a._nodes, cont_b._nodes)                            \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_concat(const ContainerType dst_cont, const ContainerType src_cont) \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_splice(dst_cont._nodes, src_cont._nodes, sizeof(Type))        \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_transfer(const ContainerType dst_cont,                             \
+        const ContainerType src_cont, size_t count)                             \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_transfer(dst_cont._nodes, src_cont._nodes, count,             \
+                sizeof(Type))                                                   \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline struct ds_node_pool *                                         \
+    Prefix##_create_pool(void)                                                  \
+    {                                                                           \
+        size_t value_size  = sizeof(Type);                                      \
+        size_t value_align = alignof(Type);                                     \
+                                                                                \
+        struct ds_node_pool *pool = AllocFunc##_pool(value_size, value_align);  \
+                                                                                \
+        if (!pool)                                                              \
+            LIBDS_HANDLE_ERR(                                                   \
+                DS_ERR_ALLOCATION_FAILED,                                       \
+                LIBDS_STRINGIFY(AllocFunc##_pool(value_size, value_align)),     \
+                __FILE__, __LINE__, __func__                                    \
+            );                                                                  \
+                                                                                \
+        return pool;                                                            \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_delete_pool(struct ds_node_pool **pool)                            \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_free_pool(pool)                                               \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline ContainerType                                                 \
+    Prefix##_create_in(struct ds_node_pool *pool)                               \
+    {                                                                           \
+        size_t value_size  = sizeof(Type);                                      \
+        size_t value_align = alignof(Type);                                     \
+                                                                                \
+        ContainerType cont = {                                                  \
+            .copy    = (CopyFunc),                                              \
+            .destroy = (DestroyFunc),                                           \
+            ._nodes  = AllocFunc##_with_pool(value_size, value_align, pool)     \
+        };                                                                      \
+                                                                                \
+        if (!cont._nodes)                                                       \
+            LIBDS_HANDLE_ERR(                                                   \
+                DS_ERR_ALLOCATION_FAILED,                                       \
+                LIBDS_STRINGIFY(                                                \
+                    AllocFunc##_with_pool(value_size, value_align, pool)        \
+                ),                                                              \
+                __FILE__, __LINE__, __func__                                    \
+            );                                                                  \
+                                                                                \
+        return cont;                                                            \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_CONTAINER
+ * @brief   Base container backed by the singly-linked node chain engine.
+ */
+#define LIBDS_DEF_CONTAINER(Type, ContainerType, Prefix,                        \
+    CopyFunc, DestroyFunc)                                                      \
+                                                                                \
+    LIBDS_DEF_CHAIN_CONTAINER(Type, ContainerType, Prefix,                      \
+        CopyFunc, DestroyFunc, ds_nc_alloc)                                     \
+/* end of macro */
+
 #endif //LIBDS_IMPL_CONTDEF_H
\ No newline at end of file
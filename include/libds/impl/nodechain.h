@@ -19,6 +19,56 @@
 #include <stdbool.h>
 #include "libds/core.h"
 
+/**
+ * @struct  ds_cache_stats
+ * @brief   Per-thread counters of the node magazine cache.
+ *
+ * A hit is served by the magazines of the thread alone, a miss had to trade
+ * with the shared depot (or carve fresh memory).
+ */
+struct ds_cache_stats
+{
+    size_t alloc_hits;      /**< Nodes taken from a thread magazine */
+    size_t alloc_misses;    /**< Nodes that required the depot */
+    size_t free_hits;       /**< Nodes returned to a thread magazine */
+    size_t free_misses;     /**< Nodes that required the depot */
+};
+
+/**
+ * @struct  ds_nc_cursor
+ * @brief   Position on a node of a chain, for linear walks and in-place edits.
+ *
+ * A cursor stays valid as long as the node it is on is not removed, whatever
+ * is inserted or removed elsewhere. Taking a snapshot of the chain, whose
+ * nodes may then be shared, makes it stale, and so does any operation moving
+ * or freeing the nodes wholesale (clear, copy, swap, move, compact, splice,
+ * transfer, split): the cursor functions refuse it with DS_ERR_STALE_CURSOR,
+ * and it must be placed again. Reading through a cursor never copies a node;
+ * writing copies the nodes still shared with a snapshot up to the current
+ * one only. Its members are opaque.
+ */
+struct ds_nc_cursor
+{
+    struct ds_node_chain *chain;    /**< Chain walked by the cursor */
+    void *node;                     /**< Current node, NULL once past the last one */
+    size_t index;                   /**< Index of the node, checked before copying it */
+    size_t epoch;                   /**< Snapshot count of the chain when placed */
+};
+
+/**
+ * @struct  ds_nc_snapshot_cursor
+ * @brief   Position on a node of a snapshot, for read-only linear walks.
+ *
+ * Only reads the snapshot, so it may be used on any thread holding a
+ * reference to it. Its members are opaque.
+ */
+struct ds_nc_snapshot_cursor
+{
+    const struct ds_nc_snapshot *snapshot;  /**< Snapshot walked by the cursor */
+    const void *node;                       /**< Current node, NULL once past the last one */
+    size_t left;                            /**< Count of nodes from the current one to the end */
+};
+
 /**
  * @defgroup NodeChainInternals Singly-Linked Node Structures Internals
  * @brief    Raw memory node pool management (type‑unsafe).
@@ -44,6 +94,151 @@
 struct ds_node_chain *
 ds_nc_alloc(size_t value_size, size_t value_align);
 
+/**
+ * @brief       Allocates a new empty doubly-linked node chain.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new chain, or NULL if @p value_size / @p value_align
+ * are invalid or on allocation failure.
+ *
+ * @details Same as @ref ds_nc_alloc, but every node also links to its
+ * predecessor, at the cost of one pointer per slot. Every `ds_nc_` function
+ * accepts both kinds of chain; on doubly-linked ones, @ref ds_nc_pop_back and
+ * @ref ds_nc_pop_node run in O(1), and indexed accesses walk from the closest end.
+ */
+struct ds_node_chain *
+ds_nc_alloc_doubly(size_t value_size, size_t value_align);
+
+/**
+ * @brief       Allocates a new empty node chain backed by a custom allocator.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ * @param[in]   allocator    Allocator of the chain and its chunks (copied), or
+ *                           NULL for the default one (see @ref ds_set_allocator).
+ *
+ * @return  Pointer to the new chain, or NULL if @p value_size / @p value_align
+ * are invalid, if @p allocator lacks `alloc` or `free`, or on allocation failure.
+ *
+ * @details Same as @ref ds_nc_alloc, which uses the default allocator. The
+ * chain keeps its own copy of @p allocator until it is freed.
+ */
+struct ds_node_chain *
+ds_nc_alloc_ex(size_t value_size, size_t value_align, const struct ds_allocator *allocator);
+
+/**
+ * @brief   Doubly-linked variant of @ref ds_nc_alloc_ex.
+ */
+struct ds_node_chain *
+ds_nc_alloc_doubly_ex(size_t value_size, size_t value_align, const struct ds_allocator *allocator);
+
+/**
+ * @brief       Allocates a new empty node chain served by the thread cache.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new chain, or NULL if @p value_size / @p value_align
+ * are invalid or on allocation failure.
+ *
+ * @details Same as @ref ds_nc_alloc, but nodes are taken from and returned to
+ * per-thread magazines shared by every cached chain with the same slot size,
+ * instead of chunks private to the chain. Workloads that create and destroy
+ * many short-lived chains, or that move nodes between threads, then reuse
+ * warm slots without touching the heap. Each magazine holds
+ * @ref LIBDS_NC_MAGAZINE_SIZE slots; only when both magazines of a thread run
+ * empty (or full) is a whole magazine traded with a shared depot, under a lock.
+ *
+ * @note    A cached chain may be freed by another thread than the one that
+ * filled it. Slots larger than 512 bytes are not cached, the chain then behaves
+ * like one from @ref ds_nc_alloc.
+ *
+ * @warning The cache memory is never returned to the OS, only recycled.
+ */
+struct ds_node_chain *
+ds_nc_alloc_cached(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Doubly-linked variant of @ref ds_nc_alloc_cached.
+ * @see     ds_nc_alloc_doubly
+ */
+struct ds_node_chain *
+ds_nc_alloc_doubly_cached(size_t value_size, size_t value_align);
+
+/**
+ * @brief       Allocates a new empty node pool, to be shared by several chains.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new pool, holding one reference for the caller, or
+ * NULL if @p value_size / @p value_align are invalid or on allocation failure.
+ *
+ * @details The pool owns the chunks and recycled slots that chains created
+ * with @ref ds_nc_alloc_with_pool would otherwise keep for themselves. Nodes
+ * released by one attached chain are reused by any other, and the chunks grow
+ * with the total number of nodes in use instead of once per chain.
+ *
+ * @warning The pool is not thread-safe, and neither are its attached chains
+ * as a whole: chains sharing a pool must be used from a single thread.
+ */
+struct ds_node_pool *
+ds_nc_alloc_pool(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Allocates a node pool sized for doubly-linked chains.
+ * @see     ds_nc_alloc_pool
+ */
+struct ds_node_pool *
+ds_nc_alloc_doubly_pool(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Drops the reference to the pool taken by its creator.
+ *
+ * @param[in,out] pool_ref  Double pointer to the pool (set to NULL on success).
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details Each attached chain holds its own reference, so the pool may be
+ * dropped while chains still use it; its memory is released when the
+ * last chain is freed.
+ *
+ * @par Complexity
+ * - Time:  O(C) for the last reference, O(1) otherwise
+ * - Space: O(1)
+ * Where C is the number of chunks of the pool.
+ */
+enum ds_error
+ds_nc_free_pool(struct ds_node_pool **pool_ref);
+
+/**
+ * @brief       Allocates a new empty node chain attached to a shared pool.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ * @param[in]   pool         Pool the nodes come from and return to.
+ *
+ * @return  Pointer to the new chain, or NULL if @p pool is NULL, if its slots
+ * do not fit the layout of this chain, or on allocation failure.
+ *
+ * @details Same as @ref ds_nc_alloc, except that the chain owns no chunk: its
+ * nodes are taken from @p pool, and go back to it when released (a plain
+ * @ref ds_nc_clear still keeps them in the chain for reuse). The chain holds a
+ * reference to @p pool until it is freed.
+ */
+struct ds_node_chain *
+ds_nc_alloc_with_pool(size_t value_size, size_t value_align, struct ds_node_pool *pool);
+
+/**
+ * @brief   Doubly-linked variant of @ref ds_nc_alloc_with_pool.
+ * @see     ds_nc_alloc_doubly_pool
+ */
+struct ds_node_chain *
+ds_nc_alloc_doubly_with_pool(size_t value_size, size_t value_align, struct ds_node_pool *pool);
+
 /**
  * @brief   Frees the entire node chain and all its managed memory.
  *
@@ -55,7 +250,8 @@ ds_nc_alloc(size_t value_size, size_t value_align);
  *
  * @note    The pointer is set to NULL on success.
  * @details If @p destroy is provided, it is invoked on every active node's data.
- * All allocated heap blocks are returned to the OS, and @p *chain_ref is nullified.
+ * All allocated heap blocks are returned to the allocator of the chain, and
+ * @p *chain_ref is nullified.
  *
  * @par Complexity
  * - Time:  O(N)
@@ -64,6 +260,29 @@ ds_nc_alloc(size_t value_size, size_t value_align);
 enum ds_error
 ds_nc_free(struct ds_node_chain **chain_ref, ds_destructor_fn destroy);
 
+/**
+ * @brief   Frees the entire node chain, handing its values to a batch destructor.
+ *
+ * @param[in,out] chain_ref Double pointer to the chain (set to NULL on success).
+ * @param[in]     destroy   Optional batch destructor for active elements (may be NULL).
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details Same as @ref ds_nc_free, except that the addresses of the values are
+ * gathered in batches of up to @ref LIBDS_NC_DESTROY_BATCH_SIZE, in list order,
+ * and @p destroy is called once per batch.
+ *
+ * @note    Values still visible to a snapshot are handed over to it instead,
+ *          and later destroyed one by one with the destructor it was taken with.
+ *
+ * @par Complexity
+ * - Time:  O(N)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_free_batch(struct ds_node_chain **chain_ref, ds_batch_destructor_fn destroy);
+
 /**
  * @brief   Removes all active nodes but retains the allocated memory pool.
  *
@@ -85,6 +304,27 @@ ds_nc_free(struct ds_node_chain **chain_ref, ds_destructor_fn destroy);
 enum ds_error
 ds_nc_clear(struct ds_node_chain *chain, ds_destructor_fn destroy, bool is_deep_clear);
 
+/**
+ * @brief   Removes all active nodes, handing their values to a batch destructor.
+ *
+ * @param[in]  chain         Pointer to the chain.
+ * @param[in]  destroy       Optional batch destructor for active elements (may be NULL).
+ * @param[in]  is_deep_clear Flag to allow or not recycling nodes
+ *                           (`true` to free, `false` to recycle).
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details Same as @ref ds_nc_clear, with @p destroy called once per batch of up
+ * to @ref LIBDS_NC_DESTROY_BATCH_SIZE values.
+ *
+ * @par Complexity
+ * - Time:  O(N) with a destructor, O(1) otherwise
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_clear_batch(struct ds_node_chain *chain, ds_batch_destructor_fn destroy, bool is_deep_clear);
+
 /**
  * @brief   Deep copies all nodes from a source chain to a destination chain.
  *
@@ -100,6 +340,9 @@ ds_nc_clear(struct ds_node_chain *chain, ds_destructor_fn destroy, bool is_deep_
  *
  * @note    On failure, the destination chain is safely rolled back to its original state.
  * @details Utilizes @p dst_chain->node_stack to bypass heap allocations whenever possible.
+ * Without @p copy, every node is allocated at once (see @ref ds_nc_push_back_n), and
+ * the slots that are adjacent on both sides are copied in blocks, links included,
+ * which are rewritten in the same pass.
  *
  * @par Complexity
  * - Time:  O(N + M)
@@ -110,6 +353,53 @@ enum ds_error
 ds_nc_copy(struct ds_node_chain *dst_chain, const struct ds_node_chain *src_chain,
            size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
 
+/**
+ * @brief   Exchanges the whole content of two chains.
+ *
+ * @param[in,out] chain_a     Pointer to the first chain.
+ * @param[in,out] chain_b     Pointer to the second chain.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details Swaps the chain states (nodes, chunks with the allocator they go
+ * back to, recycled nodes and pool) field by field, so each handle keeps its
+ * address and the allocator it is freed with, while nodes and payloads stay
+ * where they are: element references follow their element.
+ *
+ * @warning Cursors follow their handle, not their element, and are thus
+ * invalidated.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_swap(struct ds_node_chain *chain_a, struct ds_node_chain *chain_b);
+
+/**
+ * @brief   Moves the content of a source chain into a destination chain.
+ *
+ * @param[in,out] dst_chain   Destination chain, whose elements are discarded.
+ * @param[in,out] src_chain   Source chain, left valid and empty.
+ * @param[in]     destroy     Optional destructor for original destination elements.
+ *
+ * @return  DS_ERR_NONE on success (no-op if both chains are the same), or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details Frees the nodes and chunks of @p dst_chain through its allocator,
+ * then swaps it with @p src_chain (see @ref ds_nc_swap): the destination takes
+ * the whole state of the source, allocator included, and the source is left
+ * with no node. No payload is copied.
+ *
+ * @par Complexity
+ * - Time:  O(1), or O(N) with a destructor
+ * - Space: O(1)
+ * Where N is @p dst_chain->length.
+ */
+enum ds_error
+ds_nc_move(struct ds_node_chain *dst_chain, struct ds_node_chain *src_chain, ds_destructor_fn destroy);
+
 
 //==============================================================================
 // Utilities
@@ -130,6 +420,82 @@ ds_nc_copy(struct ds_node_chain *dst_chain, const struct ds_node_chain *src_chai
 enum ds_error
 ds_nc_reverse(struct ds_node_chain *chain);
 
+/**
+ * @brief   Sorts the chain in-place with a stable bottom-up merge sort.
+ *
+ * @param[in,out] chain  Pointer to the chain.
+ * @param[in]     cmp    Comparator applied to the payloads (as in qsort).
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details Only the links are rewritten: payloads stay in their slots, so
+ * pointers to stored elements remain valid, and nothing is allocated. Sorted
+ * runs of 2^i nodes are merged like the digits of a binary counter, keeping
+ * the run heads in a fixed array of one slot per bit of `size_t`. Equivalent
+ * elements keep their relative order.
+ *
+ * @par Complexity
+ * - Time:  O(N log N)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_sort(struct ds_node_chain *chain, ds_comparator_fn cmp);
+
+/**
+ * @brief   Sorts the chain in-place on several threads, relinking the nodes.
+ *
+ * @param[in,out] chain    Pointer to the chain.
+ * @param[in]     cmp      Comparator applied to the payloads, called concurrently.
+ * @param[in]     threads  Number of threads, the calling one included.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details The chain is cut in up to @p threads runs, each sorted by its own
+ * thread as in @ref ds_nc_sort, then the runs are merged pairwise, one round
+ * per level of a binary tree. Parts shorter than a few thousand nodes are not
+ * worth a thread, so short chains sort on the calling thread only. Threads
+ * that cannot be started leave their share to the calling thread. The sort
+ * stays stable and allocation free.
+ *
+ * @par Complexity
+ * - Time:  O(N log N / T + N), the last merge being sequential
+ * - Space: O(T)
+ */
+enum ds_error
+ds_nc_parallel_sort(struct ds_node_chain *chain, ds_comparator_fn cmp, size_t threads);
+
+/**
+ * @brief   Sorts the payloads of the chain on several threads, through a buffer.
+ *
+ * @param[in,out] chain       Pointer to the chain.
+ * @param[in]     cmp         Comparator applied to the payloads, called concurrently.
+ * @param[in]     threads     Number of threads, the calling one included.
+ * @param[in]     value_size  Size of the payload copied for each element.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_ALLOCATION_FAILED if the buffer could not be allocated, leaving
+ * @p chain untouched.
+ *
+ * @details Gathers the payloads into a contiguous buffer, sorts it with a
+ * stable merge sort split as in @ref ds_nc_parallel_sort, and scatters them
+ * back: the nodes and their links stay, the values move between them. Sorting
+ * an array avoids the cache misses of the relinking merges, at the cost of a
+ * buffer twice the size of the payloads.
+ *
+ * @warning Only for values that stay valid when moved with memcpy. References
+ * to stored elements keep their node, not their value.
+ *
+ * @par Complexity
+ * - Time:  O(N log N / T + N)
+ * - Space: O(N)
+ */
+enum ds_error
+ds_nc_parallel_sort_values(struct ds_node_chain *chain, ds_comparator_fn cmp, size_t threads,
+                           size_t value_size);
+
 /**
  * @brief   Returns the number of active nodes currently holding data.
  *
@@ -172,107 +538,272 @@ ds_nc_bytes(const struct ds_node_chain *chain);
 bool
 ds_nc_is_empty(const struct ds_node_chain *chain);
 
-
-//==============================================================================
-// Get Value
-//==============================================================================
+/**
+ * @brief   Calculates the total heap memory footprint of a node pool.
+ *
+ * @return  Size in bytes of the pool and its chunks (0 if @p pool is NULL),
+ * including the slots currently held by the attached chains.
+ *
+ * @par Complexity
+ * - Time:  O(C), where C is the number of chunks
+ * - Space: O(1)
+ */
+size_t
+ds_nc_pool_bytes(const struct ds_node_pool *pool);
 
 /**
- * @brief   Retrieves a pointer to the data payload of the first node.
+ * @brief   Reads the thread cache counters of the calling thread.
  *
- * @param[in]   chain  Pointer to the chain.
- * @param[out]  out    Pointer updated to point at the target data segment.
+ * @param[in]  chain  Pointer to the chain.
+ * @param[out] out    Receives the counters of the magazines serving @p chain.
  *
- * @return  DS_ERR_NONE on success,
- * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
- * DS_ERR_EMPTY_STRUCTURE if chain has no elements.
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details The counters cover every cached chain sharing the slot size of
+ * @p chain that the calling thread used. They are all zero for chains that
+ * are not cached.
  *
  * @par Complexity
  * - Time:  O(1)
  * - Space: O(1)
  */
 enum ds_error
-ds_nc_get_front(const struct ds_node_chain *chain, void **out);
+ds_nc_cache_stats(const struct ds_node_chain *chain, struct ds_cache_stats *out);
 
 /**
- * @brief   Retrieves a pointer to the data payload of the last node.
+ * @brief   Makes room for at least @p capacity nodes in total.
  *
- * @param[in]   chain  Pointer to the chain.
- * @param[out]  out    Pointer updated to point at the target data segment.
+ * @param[in,out] chain     Pointer to the chain.
+ * @param[in]     capacity  Number of nodes the chain must hold without allocating.
  *
- * @return  DS_ERR_NONE on success,
- * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
- * DS_ERR_EMPTY_STRUCTURE if chain has no elements.
+ * @return  DS_ERR_NONE on success (also if the capacity is already reached),
+ * DS_ERR_NULL_POINTER if @p chain is NULL, or
+ * DS_ERR_ALLOCATION_FAILED if allocation fails, leaving @p chain untouched.
+ *
+ * @details The missing slots are carved from a single chunk sized exactly for
+ * them, unlike the geometric batches of regular growth, and the following
+ * insertions fill them in ascending address order. On cached or pooled
+ * chains, they are taken from the thread cache or pool one by one instead.
  *
  * @par Complexity
- * - Time:  O(1)
- * - Space: O(1)
+ * - Time:  O(K), where K is the number of missing slots
+ * - Space: O(K)
  */
 enum ds_error
-ds_nc_get_back(const struct ds_node_chain *chain, void **out);
+ds_nc_reserve(struct ds_node_chain *chain, size_t capacity);
 
 /**
- * @brief   Retrieves a pointer to the data payload of the node at a given index.
+ * @brief   Returns the number of nodes the chain holds without allocating.
  *
- * @param[in]   chain  Pointer to the chain.
- * @param[in]   index  Zero‑based position. Range: [0, length -1].
- * @param[out]  out    Pointer updated to point at the target data segment.
+ * @param[in]  chain  Pointer to the chain.
  *
- * @return  DS_ERR_NONE on success,
- * DS_ERR_NULL_POINTER if pointer arguments are invalid,
- * DS_ERR_EMPTY_STRUCTURE if chain has no elements, or
- * DS_ERR_INDEX_OUT_OF_BOUNDS if index is invalid.
+ * @return  Active nodes plus recycled slots, or 0 if chain is NULL.
  *
  * @par Complexity
- * - Time:  O(N) linked list traversal
+ * - Time:  O(1)
  * - Space: O(1)
  */
-enum ds_error
-ds_nc_get_at(const struct ds_node_chain *chain, size_t index, void **out);
-
-
-//==============================================================================
-// Push Value
-//==============================================================================
+size_t
+ds_nc_capacity(const struct ds_node_chain *chain);
 
 /**
- * @brief   Allocates and inserts a new node at the front of the chain.
+ * @brief   Returns the memory chunks holding no live node to the allocator.
  *
- * @param[in,out] chain  Pointer to the chain.
- * @param[out]    out    Pointer updated to the newly allocated data payload area.
+ * @param[in,out] chain       Pointer to the chain.
+ * @param[in]     keep_bytes  Bytes of idle chunks to keep for future growth.
  *
- * @return  DS_ERR_NONE on success,
- * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
- * DS_ERR_ALLOCATION_FAILED on memory exhaustion/fragmentation.
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if @p chain is NULL.
  *
- * @details The returned @p out pointer must be used to write the value directly.
- * The node is already securely linked into the chain's active state.
+ * @details Live nodes stay in place, so pointers to their payloads remain
+ * valid. A chunk partially used is never released, whatever the number of
+ * its free slots. The recycled slots are sorted by address in place, and
+ * handed out in that order afterwards. On cached or pooled chains, the
+ * recycled slots beyond @p keep_bytes go back to the thread cache or pool
+ * instead.
  *
  * @par Complexity
- * - Time:  O(1) amortized
- * - Space: O(1) amortized
- * Worst case during pool growth
+ * - Time:  O(S log S + C log C), where S is the number of recycled slots and C of chunks
+ * - Space: O(1)
  */
 enum ds_error
-ds_nc_push_front(struct ds_node_chain *chain, void **out);
+ds_nc_trim(struct ds_node_chain *chain, size_t keep_bytes);
 
 /**
- * @brief   Allocates and appends a new node at the back of the chain.
+ * @brief   Moves the elements into one chunk, in traversal order.
  *
  * @param[in,out] chain  Pointer to the chain.
- * @param[out]    out    Pointer updated to the newly allocated data payload area.
  *
  * @return  DS_ERR_NONE on success,
- * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
- * DS_ERR_ALLOCATION_FAILED on memory exhaustion/fragmentation.
+ * DS_ERR_NULL_POINTER if @p chain is NULL,
+ * DS_ERR_UNSUPPORTED if @p chain is cached or pooled, or a snapshot still
+ * reads some of its nodes, or
+ * DS_ERR_ALLOCATION_FAILED if the new chunk could not be allocated. The chain
+ * is left untouched on any error.
+ *
+ * @details Recycling slots in LIFO order scatters neighbouring elements over
+ * the chunks after heavy churn. Compacting copies every payload into
+ * consecutive slots of a fresh chunk, so that a traversal sweeps memory
+ * sequentially, then frees the old chunks along with the recycled slots.
+ * Cached and pooled chains do not own their slots, and the nodes a snapshot
+ * reads cannot move: both are refused.
+ *
+ * @warning Invalidates every pointer to the elements of @p chain.
  *
  * @par Complexity
- * - Time:  O(1) amortized
- * - Space: O(1) amortized
- * Worst case during pool growth
+ * - Time:  O(N + C), where C is the number of chunks
+ * - Space: O(N), the old and the new slots coexist during the copy
  */
 enum ds_error
-ds_nc_push_back(struct ds_node_chain *chain, void **out);
+ds_nc_compact(struct ds_node_chain *chain);
+
+/**
+ * @brief   Measures the memory locality of a traversal.
+ *
+ * @param[in]  chain  Pointer to the chain.
+ *
+ * @return  Average distance in bytes between the slots of two consecutive
+ * nodes, or 0 if @p chain is NULL or has less than two nodes. It equals the
+ * slot stride right after ds_nc_compact().
+ *
+ * @par Complexity
+ * - Time:  O(N)
+ * - Space: O(1)
+ */
+double
+ds_nc_link_distance(const struct ds_node_chain *chain);
+
+/**
+ * @brief   Sets the share of recycled slots above which the chain trims itself.
+ *
+ * @param[in,out] chain  Pointer to the chain.
+ * @param[in]     ratio  Threshold within [0, 1], clamped. Zero disables it.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if @p chain is NULL.
+ *
+ * @details Once the recycled slots exceed @p ratio of all slots, releasing a
+ * node calls ds_nc_trim() with no bytes kept. A new trim then waits for the
+ * recycled slots to double, so the amortized cost per release stays
+ * O(log C). Defaults to @ref LIBDS_NC_TRIM_RATIO.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_set_trim_ratio(struct ds_node_chain *chain, float ratio);
+
+
+//==============================================================================
+// Get Value
+//==============================================================================
+
+/**
+ * @brief   Retrieves a pointer to the data payload of the first node.
+ *
+ * @param[in]   chain  Pointer to the chain.
+ * @param[out]  out    Pointer updated to point at the target data segment.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_EMPTY_STRUCTURE if chain has no elements.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_get_front(const struct ds_node_chain *chain, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the data payload of the last node.
+ *
+ * @param[in]   chain  Pointer to the chain.
+ * @param[out]  out    Pointer updated to point at the target data segment.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_EMPTY_STRUCTURE if chain has no elements.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_get_back(const struct ds_node_chain *chain, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the data payload of the node at a given index.
+ *
+ * @param[in,out] chain  Pointer to the chain, whose finger moves.
+ * @param[in]     index  Zero‑based position. Range: [0, length -1].
+ * @param[out]    out    Pointer updated to point at the target data segment.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_EMPTY_STRUCTURE if chain has no elements, or
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if index is invalid.
+ *
+ * @details Indexed accesses leave a finger on the node they reach, and the
+ * next one resumes from it when it is closer. Insertions and removals at the
+ * front shift the finger, other edits whose position is unknown drop it.
+ *
+ * @warning The finger makes this a write to @p chain: concurrent calls on the
+ * same chain must be synchronized like any other modification.
+ *
+ * @par Complexity
+ * - Time:  O(D), D being the distance from the closest of the head, the
+ *   tail (doubly-linked only) and the finger, i.e. O(1) for sequential indices
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_get_at(struct ds_node_chain *chain, size_t index, void **out);
+
+
+//==============================================================================
+// Push Value
+//==============================================================================
+
+/**
+ * @brief   Allocates and inserts a new node at the front of the chain.
+ *
+ * @param[in,out] chain  Pointer to the chain.
+ * @param[out]    out    Pointer updated to the newly allocated data payload area.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_ALLOCATION_FAILED on memory exhaustion/fragmentation.
+ *
+ * @details The returned @p out pointer must be used to write the value directly.
+ * The node is already securely linked into the chain's active state.
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized
+ * - Space: O(1) amortized
+ * Worst case during pool growth
+ */
+enum ds_error
+ds_nc_push_front(struct ds_node_chain *chain, void **out);
+
+/**
+ * @brief   Allocates and appends a new node at the back of the chain.
+ *
+ * @param[in,out] chain  Pointer to the chain.
+ * @param[out]    out    Pointer updated to the newly allocated data payload area.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_ALLOCATION_FAILED on memory exhaustion/fragmentation.
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized
+ * - Space: O(1) amortized
+ * Worst case during pool growth
+ */
+enum ds_error
+ds_nc_push_back(struct ds_node_chain *chain, void **out);
 
 /**
  * @brief   Allocates and inserts a new node at the specified index.
@@ -289,13 +820,52 @@ ds_nc_push_back(struct ds_node_chain *chain, void **out);
  * @details If @p index == length, it acts as push_back.
  *
  * @par Complexity
- * - Time:  O(N) (O(1) if index is 0 or equals length)
+ * - Time:  O(D) as in @ref ds_nc_get_at (O(1) if index is 0 or equals length)
  * - Space: O(1) amortized
  * Worst case during pool growth
  */
 enum ds_error
 ds_nc_push_at(struct ds_node_chain *chain, size_t index, void **out);
 
+/**
+ * @brief   Appends copies of @p count contiguous values at the back of the chain.
+ *
+ * @param[in,out] chain       Pointer to the chain.
+ * @param[in]     values      Array of @p count values.
+ * @param[in]     count       Number of values to insert.
+ * @param[in]     value_size  Size of each value (used for memcpy if @p copy is NULL).
+ * @param[in]     copy        Optional custom copy routine (if NULL, uses memcpy).
+ * @param[in]     destroy     Optional destructor used to roll back copied values.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_ALLOCATION_FAILED on memory exhaustion/fragmentation, or
+ * DS_ERR_COPY_FAILED if the custom copy function fails.
+ *
+ * @note    Either all values are inserted or, on failure, none of them.
+ * @details All the needed slots are acquired at once, taking recycled nodes
+ * first and carving the rest from a single chunk, then filled and linked in
+ * one pass.
+ *
+ * @par Complexity
+ * - Time:  O(count)
+ * - Space: O(count) worst case during pool expansion
+ */
+enum ds_error
+ds_nc_push_back_n(struct ds_node_chain *chain, const void *values, size_t count,
+                  size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
+/**
+ * @brief   Inserts copies of @p count contiguous values at the front of the chain.
+ *
+ * @details Same as @ref ds_nc_push_back_n, with the result of calling
+ * @ref ds_nc_push_front once per value in order: the last value of @p values
+ * becomes the first node of the chain.
+ */
+enum ds_error
+ds_nc_push_front_n(struct ds_node_chain *chain, const void *values, size_t count,
+                   size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
 
 //==============================================================================
 // Pop Value
@@ -321,6 +891,31 @@ ds_nc_push_at(struct ds_node_chain *chain, size_t index, void **out);
 enum ds_error
 ds_nc_pop_front(struct ds_node_chain *chain, void **out, ds_destructor_fn destroy);
 
+/**
+ * @brief   Removes up to @p count nodes from the front of the chain.
+ *
+ * @param[in,out] chain       Pointer to the chain.
+ * @param[out]    out         Optional array receiving the removed values (may be NULL).
+ * @param[in]     count       Maximum number of values to remove.
+ * @param[in]     value_size  Size of each value.
+ * @param[in]     destroy     Optional destructor, used only when @p out is NULL.
+ * @param[out]    popped      Optional, updated to the number of removed values.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_EMPTY_STRUCTURE if chain has no elements and @p count is not 0.
+ *
+ * @details The values are moved into @p out in chain order, transferring their
+ * ownership. The removed nodes are recycled as a single run.
+ *
+ * @par Complexity
+ * - Time:  O(count)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_pop_front_n(struct ds_node_chain *chain, void *out, size_t count, size_t value_size,
+                  ds_destructor_fn destroy, size_t *popped);
+
 /**
  * @brief   Removes the last node and returns it to the recycling pool.
  *
@@ -333,7 +928,7 @@ ds_nc_pop_front(struct ds_node_chain *chain, void **out, ds_destructor_fn destro
  * DS_ERR_EMPTY_STRUCTURE if chain has no elements.
  *
  * @par Complexity
- * - Time:  O(N), traversal required to update the new tail
+ * - Time:  O(N), traversal required to update the new tail, O(1) if doubly-linked
  * - Space: O(1)
  */
 enum ds_error
@@ -353,12 +948,431 @@ ds_nc_pop_back(struct ds_node_chain *chain, void **out, ds_destructor_fn destroy
  * DS_ERR_INDEX_OUT_OF_BOUNDS if index is invalid.
  *
  * @par Complexity
- * - Time:  O(N)
+ * - Time:  O(D) as in @ref ds_nc_get_at
  * - Space: O(1)
  */
 enum ds_error
 ds_nc_pop_at(struct ds_node_chain *chain, size_t index, void **out, ds_destructor_fn destroy);
 
+/**
+ * @brief   Removes the node owning a given data payload and returns it to the recycling pool.
+ *
+ * @param[in,out]   chain   Pointer to the chain.
+ * @param[in]       data    Data payload of an active node, as given by the get and push functions.
+ * @param[out]      out     Optional output pointer to view data before destruction (may be NULL).
+ * @param[in]       destroy Optional destructor for the removed element (may be NULL).
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_EMPTY_STRUCTURE if chain has no elements, or
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if a singly-linked or snapshotted chain does not
+ * hold @p data.
+ *
+ * @warning On doubly-linked chains @p data is not validated, passing a payload
+ * that is not active in @p chain causes undefined behavior.
+ *
+ * @par Complexity
+ * - Time:  O(1) if doubly-linked, O(N) otherwise to find the predecessor, or
+ *   if a snapshot still reads the nodes
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_pop_node(struct ds_node_chain *chain, void *data, void **out, ds_destructor_fn destroy);
+
+
+//==============================================================================
+// Splicing
+//==============================================================================
+
+/**
+ * @brief   Moves every element of a source chain to the end of a destination chain.
+ *
+ * @param[in,out] dst_chain   Pointer to the destination chain.
+ * @param[in,out] src_chain   Pointer to the source chain, left empty.
+ * @param[in]     value_size  Size of the payload moved when nodes cannot be.
+ *
+ * @return  DS_ERR_NONE on success (no-op if both chains are the same), or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_ALLOCATION_FAILED if the destination nodes could not be allocated, or
+ * DS_ERR_COPY_FAILED if a value shared with a snapshot could not be copied,
+ * leaving both chains untouched.
+ *
+ * @details The nodes themselves are relinked, without copying any payload,
+ * when both chains draw their slots from the same pool or from the thread
+ * cache. Chains owning their chunks, with the same layout and allocator,
+ * relink their nodes too: the chunks and recycled nodes of @p src_chain are
+ * handed over to @p dst_chain. Any other pair moves the payloads bitwise into
+ * fresh nodes of @p dst_chain, as @ref ds_nc_transfer does. The nodes a
+ * snapshot of @p src_chain reads stay with it: @p dst_chain gets copies of
+ * their values, made once, straight into its own nodes.
+ *
+ * @par Complexity
+ * - Time:  O(1) with shared slots, O(C) handing over C chunks, O(N) moving
+ *          the payloads
+ * - Space: O(1), or O(N) moving the payloads
+ */
+enum ds_error
+ds_nc_splice(struct ds_node_chain *dst_chain, struct ds_node_chain *src_chain, size_t value_size);
+
+/**
+ * @brief   Moves the first elements of a source chain to the end of a destination chain.
+ *
+ * @param[in,out] dst_chain   Pointer to the destination chain.
+ * @param[in,out] src_chain   Pointer to the source chain.
+ * @param[in]     count       Number of elements moved, within [0, length].
+ * @param[in]     value_size  Size of the payload moved when nodes cannot be.
+ *
+ * @return  DS_ERR_NONE on success (no-op if both chains are the same), or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if @p count exceeds the source length, or
+ * DS_ERR_ALLOCATION_FAILED if the destination nodes could not be allocated, or
+ * DS_ERR_COPY_FAILED if a value shared with a snapshot could not be copied,
+ * leaving both chains untouched.
+ *
+ * @details Relinks the nodes when both chains share their slots (see
+ * @ref ds_nc_splice). Otherwise the nodes stay in the chunks of @p src_chain,
+ * so the payloads are moved bitwise, without any copy function, into nodes
+ * of @p dst_chain allocated beforehand. The values a snapshot reads are
+ * copied as in @ref ds_nc_splice, and moving every element behaves like it.
+ *
+ * @par Complexity
+ * - Time:  O(K) for K moved elements
+ * - Space: O(1), or O(K) moving the payloads
+ */
+enum ds_error
+ds_nc_transfer(struct ds_node_chain *dst_chain, struct ds_node_chain *src_chain, size_t count,
+               size_t value_size);
+
+/**
+ * @brief   Moves the elements from an index on to the end of another chain.
+ *
+ * @param[in,out] chain       Pointer to the chain, keeping the first @p index elements.
+ * @param[in]     index       First moved element, within [0, length].
+ * @param[in,out] out_chain   Pointer to the chain receiving the others.
+ * @param[in]     value_size  Size of the payload moved when nodes cannot be.
+ *
+ * @return  DS_ERR_NONE on success (no-op if both chains are the same), or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if @p index exceeds the length, or
+ * DS_ERR_ALLOCATION_FAILED if the destination nodes could not be allocated, or
+ * DS_ERR_COPY_FAILED if a value shared with a snapshot could not be copied,
+ * leaving both chains untouched.
+ *
+ * @details Same node-or-payload rules as @ref ds_nc_transfer. The split point
+ * is found from the closest known node, see @ref ds_nc_get_at. Under a
+ * snapshot, only the nodes up to the split point are copied in @p chain, the
+ * others go to @p out_chain as in @ref ds_nc_splice.
+ *
+ * @par Complexity
+ * - Time:  O(D) with shared slots, O(D + K) moving K payloads
+ * - Space: O(1), or O(K) moving the payloads
+ */
+enum ds_error
+ds_nc_split_at(struct ds_node_chain *chain, size_t index, struct ds_node_chain *out_chain,
+               size_t value_size);
+
+
+//==============================================================================
+// Snapshots
+//==============================================================================
+
+/**
+ * @brief   Takes a read-only snapshot of the current elements of the chain.
+ *
+ * @param[in,out] chain       Pointer to the chain.
+ * @param[in]     value_size  Size of the values, copied if the chain diverges.
+ * @param[in]     copy        Optional copy function of the values (may be NULL).
+ * @param[in]     destroy     Optional destructor of the values (may be NULL).
+ * @param[out]    out         Receives the snapshot, released with @ref ds_nc_snapshot_release.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_ALLOCATION_FAILED if allocation fails.
+ *
+ * @details The snapshot shares the nodes of @p chain instead of copying them.
+ * Pushing at either end of @p chain, and popping the nodes pushed since,
+ * leaves those nodes alone. Any other change copies the shared nodes from
+ * the front up to the one it touches into fresh nodes (through @p copy), and
+ * leaves the former ones to the snapshot: the nodes after it stay shared, as
+ * in a persistent list, so the memory is only paid for the part of the chain
+ * that diverged, and only while a reader still holds the snapshot. Removing
+ * a shared node only writes the link before it: the node is left to the
+ * snapshot as it is, so popping from the front neither copies nor allocates,
+ * except for a value handed out through `out` with a @p copy function. The
+ * chain recycles the nodes left to a snapshot on a later change, once no
+ * reader holds it anymore. Clearing or freeing @p chain hands its nodes over
+ * without copying anything, and the values are destroyed with the last
+ * reference to the snapshot.
+ *
+ * Taking a snapshot again before any change returns the same one.
+ *
+ * @warning References and cursors taken on @p chain before the snapshot
+ * point into the shared nodes: they must not be used anymore, even to read,
+ * as the next change may move the elements of @p chain elsewhere.
+ *
+ * @par Complexity
+ * - Time:  O(1), then O(K) on a change K nodes into the shared ones
+ * - Space: O(1), then O(K) on a change K nodes into the shared ones
+ */
+enum ds_error
+ds_nc_snapshot(struct ds_node_chain *chain, size_t value_size, ds_copier_fn copy,
+               ds_destructor_fn destroy, struct ds_nc_snapshot **out);
+
+/**
+ * @brief   Adds a reference to a snapshot, for another reader.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if @p snapshot is NULL.
+ *
+ * @note    Safe to call from any thread holding a reference.
+ */
+enum ds_error
+ds_nc_snapshot_retain(struct ds_nc_snapshot *snapshot);
+
+/**
+ * @brief   Drops a reference to a snapshot.
+ *
+ * @param[in,out] snapshot_ref  Address of the snapshot pointer, set to NULL.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @details The last reference frees the nodes the chain handed over when it
+ * was cleared or freed, if any, destroying their values. The nodes the chain
+ * only copied away from go back to it instead, on its next change.
+ *
+ * @note    Safe to call from any thread holding a reference. Nodes of a
+ *          pooled chain are only queued into the pool, and given back by the
+ *          thread using it, once it runs out of recycled slots or frees it.
+ *
+ * @warning Nodes of a private chain are freed through its allocator by the
+ * thread dropping the last reference, which must then be thread-safe (the
+ * default one is).
+ */
+enum ds_error
+ds_nc_snapshot_release(struct ds_nc_snapshot **snapshot_ref);
+
+/**
+ * @brief   Stops sharing the node at an index of the chain with its snapshots.
+ *
+ * @param[in,out] chain  Pointer to the chain.
+ * @param[in]     index  Zero-based position of the element to write.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_ALLOCATION_FAILED / DS_ERR_COPY_FAILED if the values could not be
+ * copied, leaving @p chain untouched.
+ *
+ * @details Must be called before writing the payload at @p index in place,
+ * as the getters do not. Copies the shared nodes up to @p index, see
+ * @ref ds_nc_snapshot. A no-op if no snapshot reads the node, or if
+ * @p index is out of range.
+ *
+ * @par Complexity
+ * - Time:  O(1), or O(index) if a snapshot still reads the node
+ * - Space: O(1), or O(index) if a snapshot still reads the node
+ */
+enum ds_error
+ds_nc_unshare(struct ds_node_chain *chain, size_t index);
+
+/**
+ * @brief   Gets the number of elements seen by a snapshot.
+ *
+ * @return  The element count, or 0 if @p snapshot is NULL.
+ */
+size_t
+ds_nc_snapshot_length(const struct ds_nc_snapshot *snapshot);
+
+/**
+ * @brief   Gets the payload of the element at an index of a snapshot.
+ *
+ * @param[in]   snapshot  Pointer to the snapshot.
+ * @param[in]   index     Zero-based position.
+ * @param[out]  out       Receives the read-only payload address.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_EMPTY_STRUCTURE if the snapshot is empty, or
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if @p index is out of range.
+ *
+ * @par Complexity
+ * - Time:  O(index), O(1) for the last element
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_snapshot_get_at(const struct ds_nc_snapshot *snapshot, size_t index, const void **out);
+
+/**
+ * @brief   Places a cursor on the first element of a snapshot.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ */
+enum ds_error
+ds_nc_snapshot_begin(const struct ds_nc_snapshot *snapshot, struct ds_nc_snapshot_cursor *cursor);
+
+/**
+ * @brief   Moves a snapshot cursor to the next element.
+ *
+ * @return  DS_ERR_NONE on success (the cursor may now be past the end),
+ * DS_ERR_NULL_POINTER if @p cursor is NULL, or
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if it was already past the end.
+ */
+enum ds_error
+ds_nc_snapshot_next(struct ds_nc_snapshot_cursor *cursor);
+
+/**
+ * @brief   Gets the read-only payload of the current element of a snapshot cursor.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if the cursor is past the end.
+ */
+enum ds_error
+ds_nc_snapshot_get(const struct ds_nc_snapshot_cursor *cursor, const void **out);
+
+
+//==============================================================================
+// Cursor
+//==============================================================================
+
+/**
+ * @brief   Places a cursor on the first node of the chain.
+ *
+ * @param[in]   chain   Pointer to the chain.
+ * @param[out]  cursor  Cursor to initialize, past the end if @p chain is empty.
+ *
+ * @return  DS_ERR_NONE on success, or
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_cursor_begin(struct ds_node_chain *chain, struct ds_nc_cursor *cursor);
+
+/**
+ * @brief   Checks whether the cursor is on a node.
+ *
+ * @return  false if @p cursor is NULL, stale or past the last node, true otherwise.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+bool
+ds_nc_cursor_valid(const struct ds_nc_cursor *cursor);
+
+/**
+ * @brief   Moves the cursor to the next node.
+ *
+ * @param[in,out]   cursor  Pointer to the cursor.
+ *
+ * @return  DS_ERR_NONE on success (the cursor may now be past the end),
+ * DS_ERR_NULL_POINTER if @p cursor is NULL,
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if it was already past the end, or
+ * DS_ERR_STALE_CURSOR if the chain was snapshotted or rebuilt since it was placed.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_cursor_next(struct ds_nc_cursor *cursor);
+
+/**
+ * @brief   Gets the read-only data payload of the current node.
+ *
+ * @param[in]   cursor  Pointer to the cursor.
+ * @param[out]  out     Receives the payload address.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if the cursor is past the end, or
+ * DS_ERR_STALE_CURSOR if the chain was snapshotted or rebuilt since it was placed.
+ *
+ * @details The node may still be shared with a snapshot, see @ref ds_nc_cursor_ref
+ * to write to it.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_nc_cursor_get(const struct ds_nc_cursor *cursor, const void **out);
+
+/**
+ * @brief   Gets the data payload of the current node, for writing.
+ *
+ * @param[in,out]   cursor  Pointer to the cursor, moved to the copy of its node if any.
+ * @param[out]      out     Receives the payload address.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if the cursor is past the end,
+ * DS_ERR_STALE_CURSOR if the chain was snapshotted or rebuilt since it was placed, or
+ * DS_ERR_ALLOCATION_FAILED / DS_ERR_COPY_FAILED if the node could not be
+ * unshared (see @ref ds_nc_unshare).
+ *
+ * @details A node still shared with a snapshot is copied first, with the
+ * shared nodes before it. The index of the node, kept by the cursor, is
+ * checked then, and searched from the head again if the chain was edited
+ * before the node through other functions.
+ *
+ * @par Complexity
+ * - Time:  O(1), or O(K) if a snapshot still reads the K nodes up to it
+ * - Space: O(1), or O(K) if a snapshot still reads the K nodes up to it
+ */
+enum ds_error
+ds_nc_cursor_ref(struct ds_nc_cursor *cursor, void **out);
+
+/**
+ * @brief   Inserts a node right after the current one.
+ *
+ * @param[in,out]   cursor  Pointer to the cursor, left on the same node.
+ * @param[out]      out     Receives the payload address of the new node.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if the cursor is past the end,
+ * DS_ERR_STALE_CURSOR if the chain was snapshotted or rebuilt since it was placed, or
+ * DS_ERR_ALLOCATION_FAILED / DS_ERR_COPY_FAILED if allocation fails, or the
+ * link of the node could not be unshared.
+ *
+ * @details Only writes the link of the current node, see @ref ds_nc_cursor_ref.
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized, or O(K) if a snapshot still reads the K nodes up to it
+ * - Space: O(1) amortized, or O(K) if a snapshot still reads the K nodes up to it
+ */
+enum ds_error
+ds_nc_cursor_insert_after(struct ds_nc_cursor *cursor, void **out);
+
+/**
+ * @brief   Removes the node right after the current one.
+ *
+ * @param[in,out]   cursor  Pointer to the cursor, left on the same node.
+ * @param[out]      out     Optional output pointer to view data before destruction (may be NULL).
+ * @param[in]       destroy Optional destructor for the removed element (may be NULL).
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if @p cursor is NULL,
+ * DS_ERR_INDEX_OUT_OF_BOUNDS if the cursor is past the end or on the last node,
+ * DS_ERR_STALE_CURSOR if the chain was snapshotted or rebuilt since it was placed, or
+ * DS_ERR_ALLOCATION_FAILED / DS_ERR_COPY_FAILED if the link of the node
+ * could not be unshared.
+ *
+ * @details Only writes the link of the current node, see @ref ds_nc_cursor_ref:
+ * a removed node still shared with a snapshot is left to it as it is.
+ *
+ * @par Complexity
+ * - Time:  O(1), or O(K) if a snapshot still reads the K nodes up to it
+ * - Space: O(1), or O(K) if a snapshot still reads the K nodes up to it
+ */
+enum ds_error
+ds_nc_cursor_erase_after(struct ds_nc_cursor *cursor, void **out, ds_destructor_fn destroy);
+
 /** @} */ //end of NodeChainInternals group
 
 #endif //LIBDS_IMPL_NODECHAIN_H
\ No newline at end of file
@@ -0,0 +1,235 @@
+/**
+ * @file    ringbuffer.h
+ * @brief   Low-level contiguous ring buffer management (unsafe for direct use).
+ *
+ * A ring buffer stores its elements back to back in a single power-of-two
+ * array, indexed through a bit mask. Consumers read elements sequentially in
+ * memory, and no per-element allocation or pointer hop is ever performed.
+ *
+ * @warning THIS HEADER IS NOT A PART OF THE PUBLIC API.
+ * These functions operate on raw bytes and provide NO TYPE-SAFETY.
+ * It is intended for INTERNAL USE ONLY by higher-level type-safe
+ * data structures. Direct use may lead to MEMORY CORRUPTION or
+ * UNDEFINED BEHAVIOR.
+ *
+ * @warning Payload pointers handed out by this engine are only valid until
+ * the next insertion, which may overwrite a released slot or move the whole
+ * array during growth.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_IMPL_RINGBUFFER_H
+#define LIBDS_IMPL_RINGBUFFER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "libds/core.h"
+
+/**
+ * @defgroup RingBufferInternals Ring Buffer Internals
+ * @brief    Raw memory ring buffer management (type‑unsafe).
+ *
+ * Every function mirrors the contract of its `ds_nc_` counterpart declared
+ * in impl/nodechain.h; only the differences are documented here.
+ * @{
+ */
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+/**
+ * @brief   Allocates a new empty, growable ring buffer.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new buffer, or NULL if @p value_size / @p value_align
+ * are invalid or on allocation failure.
+ *
+ * @details The array is allocated lazily on the first insertion, and doubles
+ * its capacity every time it gets full.
+ */
+struct ds_ring_buffer *
+ds_rb_alloc(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Allocates a new empty ring buffer bounded to @p capacity elements.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ * @param[in]   capacity     Maximum number of elements (strictly positive).
+ *
+ * @return  Pointer to the new buffer, or NULL if the arguments are invalid or
+ * on allocation failure.
+ *
+ * @details The whole array (rounded up to a power of two) is allocated here,
+ * and insertions into a full buffer fail with DS_ERR_FULL_STRUCTURE.
+ */
+struct ds_ring_buffer *
+ds_rb_alloc_fixed(size_t value_size, size_t value_align, size_t capacity);
+
+/**
+ * @brief   Frees the buffer and all its managed memory.
+ * @see     ds_nc_free
+ */
+enum ds_error
+ds_rb_free(struct ds_ring_buffer **ring_ref, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes all elements.
+ * @see     ds_nc_clear
+ *
+ * @details A deep clear releases the array of growable buffers, fixed ones
+ * keep it since their capacity is guaranteed.
+ *
+ * @par Complexity
+ * - Time:  O(1), O(N) if a destructor is set
+ * - Space: O(1)
+ */
+enum ds_error
+ds_rb_clear(struct ds_ring_buffer *ring, ds_destructor_fn destroy, bool is_deep_clear);
+
+/**
+ * @brief   Deep copies all elements from a source buffer to a destination buffer.
+ * @see     ds_nc_copy
+ *
+ * @return  Same as @ref ds_nc_copy, or DS_ERR_FULL_STRUCTURE if @p dst_ring is
+ * fixed and cannot hold every element of @p src_ring.
+ *
+ * @details The copy is built in a fresh array, which replaces the original one
+ * only on success. Without a custom @p copy, at most two memcpy are performed.
+ */
+enum ds_error
+ds_rb_copy(struct ds_ring_buffer *dst_ring, const struct ds_ring_buffer *src_ring,
+           size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+/**
+ * @brief   Returns the number of stored elements, or 0 if ring is NULL.
+ */
+size_t
+ds_rb_length(const struct ds_ring_buffer *ring);
+
+/**
+ * @brief   Returns how many elements fit without growing (the bound if fixed).
+ */
+size_t
+ds_rb_capacity(const struct ds_ring_buffer *ring);
+
+/**
+ * @brief   Calculates the total heap memory footprint of the buffer.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+size_t
+ds_rb_bytes(const struct ds_ring_buffer *ring);
+
+/**
+ * @brief   Checks whether the buffer is empty (or NULL).
+ */
+bool
+ds_rb_is_empty(const struct ds_ring_buffer *ring);
+
+
+//==============================================================================
+// Get Value
+//==============================================================================
+
+/**
+ * @brief   Retrieves a pointer to the first element.
+ * @see     ds_nc_get_front
+ */
+enum ds_error
+ds_rb_get_front(const struct ds_ring_buffer *ring, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the last element.
+ * @see     ds_nc_get_back
+ */
+enum ds_error
+ds_rb_get_back(const struct ds_ring_buffer *ring, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the element at a given index.
+ * @see     ds_nc_get_at
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_rb_get_at(const struct ds_ring_buffer *ring, size_t index, void **out);
+
+
+//==============================================================================
+// Push / Pop Value
+//==============================================================================
+
+/**
+ * @brief   Reserves a slot for a new last element.
+ * @see     ds_nc_push_back
+ *
+ * @return  Same as @ref ds_nc_push_back, or DS_ERR_FULL_STRUCTURE if the
+ * buffer is fixed and full.
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized, O(N) when the array doubles
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_rb_push_back(struct ds_ring_buffer *ring, void **out);
+
+/**
+ * @brief   Appends copies of @p count contiguous values.
+ * @see     ds_nc_push_back_n
+ *
+ * @return  Same as @ref ds_nc_push_back_n, or DS_ERR_FULL_STRUCTURE if the
+ * buffer is fixed and cannot hold all the values.
+ *
+ * @details Grows at most once per doubling, and without a custom @p copy the
+ * values are written with at most two memcpy.
+ */
+enum ds_error
+ds_rb_push_back_n(struct ds_ring_buffer *ring, const void *values, size_t count,
+                  size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes the first element.
+ * @see     ds_nc_pop_front
+ */
+enum ds_error
+ds_rb_pop_front(struct ds_ring_buffer *ring, void **out, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes up to @p count elements from the front.
+ * @see     ds_nc_pop_front_n
+ *
+ * @details The values are moved into @p out with at most two memcpy.
+ */
+enum ds_error
+ds_rb_pop_front_n(struct ds_ring_buffer *ring, void *out, size_t count, size_t value_size,
+                  ds_destructor_fn destroy, size_t *popped);
+
+/**
+ * @brief   Removes the last element.
+ * @see     ds_nc_pop_back
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_rb_pop_back(struct ds_ring_buffer *ring, void **out, ds_destructor_fn destroy);
+
+/** @} */ //end of RingBufferInternals group
+
+#endif //LIBDS_IMPL_RINGBUFFER_H
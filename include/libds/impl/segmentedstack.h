@@ -0,0 +1,215 @@
+/**
+ * @file    segmentedstack.h
+ * @brief   Low-level segmented array stack management (unsafe for direct use).
+ *
+ * A segmented stack stores its elements in a directory of contiguous arrays
+ * (segments). Consecutive pushes land on consecutive addresses, and when a
+ * segment is full a new one is appended, leaving the previous segments in
+ * place: pointers to stored elements stay valid for as long as the elements
+ * remain in the stack.
+ *
+ * The front of the stack is its top, matching the node chain engine where
+ * stacks push and pop at the front.
+ *
+ * @warning THIS HEADER IS NOT A PART OF THE PUBLIC API.
+ * These functions operate on raw bytes and provide NO TYPE-SAFETY.
+ * It is intended for INTERNAL USE ONLY by higher-level type-safe
+ * data structures. Direct use may lead to MEMORY CORRUPTION or
+ * UNDEFINED BEHAVIOR.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_IMPL_SEGMENTEDSTACK_H
+#define LIBDS_IMPL_SEGMENTEDSTACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "libds/core.h"
+
+/**
+ * @defgroup SegmentedStackInternals Segmented Stack Internals
+ * @brief    Raw memory segmented stack management (type‑unsafe).
+ *
+ * Every function mirrors the contract of its `ds_nc_` counterpart declared
+ * in impl/nodechain.h; only the differences are documented here.
+ * @{
+ */
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+/**
+ * @brief   Allocates a new empty segmented stack.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new stack, or NULL if @p value_size / @p value_align
+ * are invalid or on allocation failure.
+ *
+ * @details No segment is allocated until the first push or reserve.
+ */
+struct ds_segmented_stack *
+ds_ss_alloc(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Frees the stack and all its segments.
+ * @see     ds_nc_free
+ */
+enum ds_error
+ds_ss_free(struct ds_segmented_stack **stack_ref, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes all elements, optionally releasing the segments.
+ * @see     ds_nc_clear
+ *
+ * @par Complexity
+ * - Time:  O(log N), O(N) if a destructor is set
+ * - Space: O(1)
+ */
+enum ds_error
+ds_ss_clear(struct ds_segmented_stack *stack, ds_destructor_fn destroy, bool is_deep_clear);
+
+/**
+ * @brief   Deep copies all elements from a source stack to a destination stack.
+ * @see     ds_nc_copy
+ *
+ * @details The copy is built in a single segment sized to the source, which
+ * replaces the destination segments only on success.
+ */
+enum ds_error
+ds_ss_copy(struct ds_segmented_stack *dst_stack, const struct ds_segmented_stack *src_stack,
+           size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
+/**
+ * @brief   Ensures the stack can hold @p capacity elements without growing.
+ *
+ * @param[in,out] stack     Pointer to the stack.
+ * @param[in]     capacity  Total number of elements to make room for.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_ALLOCATION_FAILED on memory exhaustion.
+ *
+ * @details The missing room is allocated as exactly one new segment.
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized
+ * - Space: O(capacity)
+ */
+enum ds_error
+ds_ss_reserve(struct ds_segmented_stack *stack, size_t capacity);
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+/**
+ * @brief   Returns the number of stored elements, or 0 if stack is NULL.
+ */
+size_t
+ds_ss_length(const struct ds_segmented_stack *stack);
+
+/**
+ * @brief   Returns how many elements fit in the allocated segments.
+ */
+size_t
+ds_ss_capacity(const struct ds_segmented_stack *stack);
+
+/**
+ * @brief   Calculates the total heap memory footprint of the stack.
+ *
+ * @par Complexity
+ * - Time:  O(1)
+ * - Space: O(1)
+ */
+size_t
+ds_ss_bytes(const struct ds_segmented_stack *stack);
+
+/**
+ * @brief   Checks whether the stack is empty (or NULL).
+ */
+bool
+ds_ss_is_empty(const struct ds_segmented_stack *stack);
+
+
+//==============================================================================
+// Get Value
+//==============================================================================
+
+/**
+ * @brief   Retrieves a pointer to the top element.
+ * @see     ds_nc_get_front
+ */
+enum ds_error
+ds_ss_get_front(const struct ds_segmented_stack *stack, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the bottom element.
+ * @see     ds_nc_get_back
+ */
+enum ds_error
+ds_ss_get_back(const struct ds_segmented_stack *stack, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the element at a given depth (0 is the top).
+ * @see     ds_nc_get_at
+ *
+ * @par Complexity
+ * - Time:  O(log N), walks the segments down from the top
+ * - Space: O(1)
+ */
+enum ds_error
+ds_ss_get_at(const struct ds_segmented_stack *stack, size_t index, void **out);
+
+
+//==============================================================================
+// Push / Pop Value
+//==============================================================================
+
+/**
+ * @brief   Reserves a slot for a new top element.
+ * @see     ds_nc_push_front
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized
+ * - Space: O(1) amortized, segments double the total capacity
+ */
+enum ds_error
+ds_ss_push_front(struct ds_segmented_stack *stack, void **out);
+
+/**
+ * @brief   Pushes copies of @p count contiguous values, the last one on top.
+ * @see     ds_nc_push_front_n
+ *
+ * @details Allocates at most one segment, and without a custom @p copy the
+ * values are written with one memcpy per segment they span.
+ */
+enum ds_error
+ds_ss_push_front_n(struct ds_segmented_stack *stack, const void *values, size_t count,
+                   size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes the top element.
+ * @see     ds_nc_pop_front
+ *
+ * @details Emptied segments are kept for the next pushes.
+ */
+enum ds_error
+ds_ss_pop_front(struct ds_segmented_stack *stack, void **out, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes up to @p count elements from the top.
+ * @see     ds_nc_pop_front_n
+ */
+enum ds_error
+ds_ss_pop_front_n(struct ds_segmented_stack *stack, void *out, size_t count, size_t value_size,
+                  ds_destructor_fn destroy, size_t *popped);
+
+/** @} */ //end of SegmentedStackInternals group
+
+#endif //LIBDS_IMPL_SEGMENTEDSTACK_H
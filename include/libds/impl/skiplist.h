@@ -0,0 +1,235 @@
+/**
+ * @file    skiplist.h
+ * @brief   Low-level indexable skip list management (unsafe for direct use).
+ *
+ * Every element lives in its own node, linked on a random number of levels.
+ * Each link records how many positions it skips, so positional accesses,
+ * insertions and removals descend from the top level in expected O(log N)
+ * instead of walking the chain.
+ *
+ * @warning THIS HEADER IS NOT A PART OF THE PUBLIC API.
+ * These functions operate on raw bytes and provide NO TYPE-SAFETY.
+ * It is intended for INTERNAL USE ONLY by higher-level type-safe
+ * data structures. Direct use may lead to MEMORY CORRUPTION or
+ * UNDEFINED BEHAVIOR.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_IMPL_SKIPLIST_H
+#define LIBDS_IMPL_SKIPLIST_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "libds/core.h"
+
+/**
+ * @defgroup SkipListInternals Skip List Structures Internals
+ * @brief    Raw memory indexable skip list management (type‑unsafe).
+ *
+ * Every function mirrors the contract of its `ds_nc_` counterpart declared
+ * in impl/nodechain.h; only the differences are documented here.
+ * @{
+ */
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+/**
+ * @brief   Allocates a new empty skip list.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new list, or NULL if @p value_size / @p value_align
+ * are invalid or on allocation failure.
+ *
+ * @details Nodes are drawn from one internal node chain per tower height,
+ * created on first use, so they are recycled like the nodes of a node chain.
+ */
+struct ds_skip_list *
+ds_sl_alloc(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Frees the entire list and all its managed memory.
+ * @see     ds_nc_free
+ */
+enum ds_error
+ds_sl_free(struct ds_skip_list **list_ref, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes all elements, optionally releasing the recycled nodes.
+ * @see     ds_nc_clear
+ *
+ * @par Complexity
+ * - Time:  O(N)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sl_clear(struct ds_skip_list *list, ds_destructor_fn destroy, bool is_deep_clear);
+
+/**
+ * @brief   Deep copies all elements from a source list to a destination list.
+ * @see     ds_nc_copy
+ *
+ * @details The copies are appended on the bottom level first, and the upper
+ * levels are linked in one final pass.
+ *
+ * @par Complexity
+ * - Time:  O(N + M)
+ * - Space: O(M) worst case during pool expansion
+ */
+enum ds_error
+ds_sl_copy(struct ds_skip_list *dst_list, const struct ds_skip_list *src_list,
+           size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+/**
+ * @brief   Reverses the order of the elements in-place.
+ * @see     ds_nc_reverse
+ *
+ * @details Reverses the bottom level, then links the upper levels again.
+ */
+enum ds_error
+ds_sl_reverse(struct ds_skip_list *list);
+
+/**
+ * @brief   Returns the number of stored elements, or 0 if list is NULL.
+ */
+size_t
+ds_sl_length(const struct ds_skip_list *list);
+
+/**
+ * @brief   Calculates the total heap memory footprint of the list.
+ */
+size_t
+ds_sl_bytes(const struct ds_skip_list *list);
+
+/**
+ * @brief   Checks whether the list is empty (or NULL).
+ */
+bool
+ds_sl_is_empty(const struct ds_skip_list *list);
+
+
+//==============================================================================
+// Get Value
+//==============================================================================
+
+/**
+ * @brief   Retrieves a pointer to the first element.
+ * @see     ds_nc_get_front
+ */
+enum ds_error
+ds_sl_get_front(const struct ds_skip_list *list, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the last element.
+ * @see     ds_nc_get_back
+ */
+enum ds_error
+ds_sl_get_back(const struct ds_skip_list *list, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the element at a given index.
+ * @see     ds_nc_get_at
+ *
+ * @par Complexity
+ * - Time:  O(log N) expected
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sl_get_at(const struct ds_skip_list *list, size_t index, void **out);
+
+/**
+ * @brief   Makes an element safe to write in place, a no-op on skip lists.
+ * @see     ds_nc_unshare
+ */
+enum ds_error
+ds_sl_unshare(struct ds_skip_list *list, size_t index);
+
+
+//==============================================================================
+// Push Value
+//==============================================================================
+
+/**
+ * @brief   Reserves a slot for a new first element.
+ * @see     ds_nc_push_front
+ *
+ * @par Complexity
+ * - Time:  O(log N) expected, every level of the head is updated
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_sl_push_front(struct ds_skip_list *list, void **out);
+
+/**
+ * @brief   Reserves a slot for a new last element.
+ * @see     ds_nc_push_back
+ *
+ * @par Complexity
+ * - Time:  O(log N) expected
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_sl_push_back(struct ds_skip_list *list, void **out);
+
+/**
+ * @brief   Reserves a slot for a new element at the specified index.
+ * @see     ds_nc_push_at
+ *
+ * @par Complexity
+ * - Time:  O(log N) expected
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_sl_push_at(struct ds_skip_list *list, size_t index, void **out);
+
+
+//==============================================================================
+// Pop Value
+//==============================================================================
+
+/**
+ * @brief   Removes the first element.
+ * @see     ds_nc_pop_front
+ *
+ * @par Complexity
+ * - Time:  O(log N) expected, every level of the head is updated
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sl_pop_front(struct ds_skip_list *list, void **out, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes the last element.
+ * @see     ds_nc_pop_back
+ *
+ * @par Complexity
+ * - Time:  O(log N) expected
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sl_pop_back(struct ds_skip_list *list, void **out, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes the element at the specified index.
+ * @see     ds_nc_pop_at
+ *
+ * @par Complexity
+ * - Time:  O(log N) expected
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sl_pop_at(struct ds_skip_list *list, size_t index, void **out, ds_destructor_fn destroy);
+
+/** @} */ //end of SkipListInternals group
+
+#endif //LIBDS_IMPL_SKIPLIST_H
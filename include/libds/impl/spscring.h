@@ -0,0 +1,194 @@
+/**
+ * @file    spscring.h
+ * @brief   Low-level wait-free single-producer/single-consumer ring (unsafe for direct use).
+ *
+ * A bounded ring buffer shared by exactly one producer thread and one
+ * consumer thread. Each side owns one index and only reads the other one,
+ * so no operation ever retries: every call completes in a bounded number of
+ * steps (wait-free).
+ *
+ * The two indices live on separate cache lines, and each side keeps a private
+ * copy of the opposite index, reloading it only when the copy says the ring
+ * is full (producer) or empty (consumer). In a steady stream, the shared
+ * lines change hands once per batch instead of once per element.
+ *
+ * @warning THIS HEADER IS NOT A PART OF THE PUBLIC API.
+ * These functions operate on raw bytes and provide NO TYPE-SAFETY.
+ * It is intended for INTERNAL USE ONLY by higher-level type-safe
+ * data structures. Direct use may lead to MEMORY CORRUPTION or
+ * UNDEFINED BEHAVIOR.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_IMPL_SPSCRING_H
+#define LIBDS_IMPL_SPSCRING_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "libds/core.h"
+
+/**
+ * @defgroup SpscRingInternals SPSC Ring Internals
+ * @brief    Raw memory single-producer/single-consumer ring management (type‑unsafe).
+ *
+ * `enqueue` functions may only be called by the producer thread, `dequeue`
+ * functions by the consumer thread, and the queries by any thread.
+ * Allocating and freeing the ring must not race with any other call.
+ * @{
+ */
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+/**
+ * @brief   Allocates a new empty ring bounded to @p capacity elements.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ * @param[in]   capacity     Maximum number of stored elements (non-zero).
+ *
+ * @return  Pointer to the new ring, or NULL if the arguments are invalid or
+ * on allocation failure.
+ *
+ * @details The array is rounded up to a power of two slots, but the ring
+ * never holds more than @p capacity elements.
+ */
+struct ds_spsc_ring *
+ds_sr_alloc(size_t value_size, size_t value_align, size_t capacity);
+
+/**
+ * @brief   Frees the ring and the elements left in it.
+ * @see     ds_nc_free
+ *
+ * @warning Not thread-safe.
+ */
+enum ds_error
+ds_sr_free(struct ds_spsc_ring **ring_ref, ds_destructor_fn destroy);
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+/**
+ * @brief   Returns the number of stored elements, or 0 if ring is NULL.
+ *
+ * @note    Called from a third thread, the count is a snapshot that may
+ * already be stale.
+ */
+size_t
+ds_sr_length(const struct ds_spsc_ring *ring);
+
+/**
+ * @brief   Returns the maximum number of stored elements.
+ */
+size_t
+ds_sr_capacity(const struct ds_spsc_ring *ring);
+
+/**
+ * @brief   Calculates the total heap memory footprint of the ring.
+ */
+size_t
+ds_sr_bytes(const struct ds_spsc_ring *ring);
+
+/**
+ * @brief   Checks whether the ring is empty (or NULL).
+ */
+bool
+ds_sr_is_empty(const struct ds_spsc_ring *ring);
+
+
+//==============================================================================
+// Enqueue / Dequeue Value
+//==============================================================================
+
+/**
+ * @brief   Appends a copy of @p value at the back of the ring (producer only).
+ *
+ * @param[in,out] ring   Pointer to the ring.
+ * @param[in]     value  Pointer to the value to store.
+ * @param[in]     copy   Copier called before the slot is published,
+ * or NULL for a bitwise copy.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_FULL_STRUCTURE if the ring is full, or
+ * DS_ERR_COPY_FAILED if @p copy fails (the ring is left untouched).
+ *
+ * @par Complexity
+ * - Time:  O(1), wait-free
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sr_try_enqueue(struct ds_spsc_ring *ring, const void *value, ds_copier_fn copy);
+
+/**
+ * @brief   Appends copies of up to @p count contiguous values (producer only).
+ *
+ * @param[in,out] ring        Pointer to the ring.
+ * @param[in]     values      Pointer to the first value.
+ * @param[in]     count       Number of values to append.
+ * @param[in]     value_size  Size of each value.
+ * @param[in]     copy        Copier, or NULL for bitwise copies.
+ * @param[in]     destroy     Destructor used to roll back the copies made if
+ * @p copy fails, or NULL.
+ * @param[out]    pushed      Receives the number of appended values (may be NULL).
+ *
+ * @return  DS_ERR_NONE if at least one value was appended,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid,
+ * DS_ERR_FULL_STRUCTURE if the ring is full, or
+ * DS_ERR_COPY_FAILED if @p copy fails (nothing is appended).
+ *
+ * @details Appends as many values as fit and publishes them at once. Without a
+ * custom @p copy, they are written with at most two memcpy.
+ *
+ * @par Complexity
+ * - Time:  O(count), wait-free
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sr_try_enqueue_n(struct ds_spsc_ring *ring, const void *values, size_t count, size_t value_size,
+                    ds_copier_fn copy, ds_destructor_fn destroy, size_t *pushed);
+
+/**
+ * @brief   Removes the front element, moving it into @p out (consumer only).
+ *
+ * @param[in,out] ring  Pointer to the ring.
+ * @param[out]    out   Buffer of at least `value_size` bytes receiving the
+ * element, whose ownership is transferred to the caller.
+ *
+ * @return  DS_ERR_NONE on success,
+ * DS_ERR_NULL_POINTER if pointer arguments are invalid, or
+ * DS_ERR_EMPTY_STRUCTURE if the ring is empty.
+ *
+ * @details As in ds_cq_dequeue(), the element is copied out: its slot may be
+ * reused by the producer as soon as it is released.
+ *
+ * @par Complexity
+ * - Time:  O(1), wait-free
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sr_try_dequeue(struct ds_spsc_ring *ring, void *out);
+
+/**
+ * @brief   Removes up to @p count elements from the front (consumer only).
+ * @see     ds_nc_pop_front_n
+ *
+ * @details The elements are released to the producer at once, and copied out
+ * with at most two memcpy.
+ *
+ * @par Complexity
+ * - Time:  O(count), wait-free
+ * - Space: O(1)
+ */
+enum ds_error
+ds_sr_try_dequeue_n(struct ds_spsc_ring *ring, void *out, size_t count, size_t value_size,
+                    ds_destructor_fn destroy, size_t *popped);
+
+/** @} */ //end of SpscRingInternals group
+
+#endif //LIBDS_IMPL_SPSCRING_H
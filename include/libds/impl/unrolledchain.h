@@ -0,0 +1,251 @@
+/**
+ * @file    unrolledchain.h
+ * @brief   Low-level unrolled node chain management (unsafe for direct use).
+ *
+ * An unrolled chain stores up to K elements contiguously inside every node,
+ * where K is chosen so that a node spans @ref LIBDS_UC_NODE_BYTES bytes.
+ * Traversals and indexed accesses chase one pointer per K elements instead
+ * of one per element, and the per-element `next` pointer overhead vanishes.
+ *
+ * @warning THIS HEADER IS NOT A PART OF THE PUBLIC API.
+ * These functions operate on raw bytes and provide NO TYPE-SAFETY.
+ * It is intended for INTERNAL USE ONLY by higher-level type-safe
+ * data structures. Direct use may lead to MEMORY CORRUPTION or
+ * UNDEFINED BEHAVIOR.
+ *
+ * @warning Payload pointers handed out by this engine are only valid until
+ * the next operation on the chain, since insertions and removals shift the
+ * elements stored in the same node.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_IMPL_UNROLLEDCHAIN_H
+#define LIBDS_IMPL_UNROLLEDCHAIN_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "libds/core.h"
+
+/**
+ * @defgroup UnrolledChainInternals Unrolled Node Structures Internals
+ * @brief    Raw memory unrolled node management (type‑unsafe).
+ *
+ * Every function mirrors the contract of its `ds_nc_` counterpart declared
+ * in impl/nodechain.h; only the differences are documented here.
+ * @{
+ */
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+/**
+ * @brief   Allocates a new empty unrolled chain.
+ *
+ * @param[in]   value_size   Size (in bytes) of each stored value.
+ * @param[in]   value_align  Alignment requirement of the stored value.
+ *
+ * @return  Pointer to the new chain, or NULL if @p value_size / @p value_align
+ * are invalid or on allocation failure.
+ *
+ * @details The node capacity K is computed once here, so that the whole node
+ * (header, element count and K payloads) fits in @ref LIBDS_UC_NODE_BYTES, or
+ * in the smallest multiple of @ref LIBDS_CACHE_LINE_SIZE able to hold a few
+ * elements for large types. Nodes start on a cache line boundary, so each
+ * one spans exactly that many cache lines.
+ */
+struct ds_unrolled_chain *
+ds_uc_alloc(size_t value_size, size_t value_align);
+
+/**
+ * @brief   Frees the entire chain and all its managed memory.
+ * @see     ds_nc_free
+ *
+ * @par Complexity
+ * - Time:  O(N) with a destructor, O(N / K) otherwise
+ * - Space: O(1)
+ */
+enum ds_error
+ds_uc_free(struct ds_unrolled_chain **chain_ref, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes all elements, optionally releasing the recycled nodes.
+ * @see     ds_nc_clear
+ *
+ * @par Complexity
+ * - Time:  O(N) with a destructor, O(1) otherwise
+ * - Space: O(1)
+ */
+enum ds_error
+ds_uc_clear(struct ds_unrolled_chain *chain, ds_destructor_fn destroy, bool is_deep_clear);
+
+/**
+ * @brief   Deep copies all elements from a source chain to a destination chain.
+ * @see     ds_nc_copy
+ *
+ * @details Without a custom @p copy, every node is copied with a single memcpy.
+ *
+ * @par Complexity
+ * - Time:  O(N + M)
+ * - Space: O(M / K) worst case during pool expansion
+ */
+enum ds_error
+ds_uc_copy(struct ds_unrolled_chain *dst_chain, const struct ds_unrolled_chain *src_chain,
+           size_t value_size, ds_copier_fn copy, ds_destructor_fn destroy);
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+/**
+ * @brief   Reverses the order of the elements in-place.
+ * @see     ds_nc_reverse
+ */
+enum ds_error
+ds_uc_reverse(struct ds_unrolled_chain *chain);
+
+/**
+ * @brief   Returns the number of stored elements, or 0 if chain is NULL.
+ */
+size_t
+ds_uc_length(const struct ds_unrolled_chain *chain);
+
+/**
+ * @brief   Calculates the total heap memory footprint of the chain.
+ */
+size_t
+ds_uc_bytes(const struct ds_unrolled_chain *chain);
+
+/**
+ * @brief   Checks whether the chain is empty (or NULL).
+ */
+bool
+ds_uc_is_empty(const struct ds_unrolled_chain *chain);
+
+
+//==============================================================================
+// Get Value
+//==============================================================================
+
+/**
+ * @brief   Retrieves a pointer to the first element.
+ * @see     ds_nc_get_front
+ */
+enum ds_error
+ds_uc_get_front(const struct ds_unrolled_chain *chain, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the last element.
+ * @see     ds_nc_get_back
+ */
+enum ds_error
+ds_uc_get_back(const struct ds_unrolled_chain *chain, void **out);
+
+/**
+ * @brief   Retrieves a pointer to the element at a given index.
+ * @see     ds_nc_get_at
+ *
+ * @par Complexity
+ * - Time:  O(N / K), skips whole nodes using their element count
+ * - Space: O(1)
+ */
+enum ds_error
+ds_uc_get_at(const struct ds_unrolled_chain *chain, size_t index, void **out);
+
+/**
+ * @brief   Makes an element safe to write in place, a no-op on unrolled chains.
+ * @see     ds_nc_unshare
+ */
+enum ds_error
+ds_uc_unshare(struct ds_unrolled_chain *chain, size_t index);
+
+
+//==============================================================================
+// Push Value
+//==============================================================================
+
+/**
+ * @brief   Reserves a slot for a new first element.
+ * @see     ds_nc_push_front
+ *
+ * @par Complexity
+ * - Time:  O(K) amortized, shifts the elements of the first node
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_uc_push_front(struct ds_unrolled_chain *chain, void **out);
+
+/**
+ * @brief   Reserves a slot for a new last element.
+ * @see     ds_nc_push_back
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_uc_push_back(struct ds_unrolled_chain *chain, void **out);
+
+/**
+ * @brief   Reserves a slot for a new element at the specified index.
+ * @see     ds_nc_push_at
+ *
+ * @details A full node is split in two halves before the insertion.
+ *
+ * @par Complexity
+ * - Time:  O(N / K + K)
+ * - Space: O(1) amortized
+ */
+enum ds_error
+ds_uc_push_at(struct ds_unrolled_chain *chain, size_t index, void **out);
+
+
+//==============================================================================
+// Pop Value
+//==============================================================================
+
+/**
+ * @brief   Removes the first element.
+ * @see     ds_nc_pop_front
+ *
+ * @details When @p out is provided, the element is moved into an internal
+ * scratch slot and @p *out points to it until the next operation.
+ *
+ * @par Complexity
+ * - Time:  O(K)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_uc_pop_front(struct ds_unrolled_chain *chain, void **out, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes the last element.
+ * @see     ds_nc_pop_back
+ *
+ * @par Complexity
+ * - Time:  O(1), or O(N / K) when the last node becomes empty
+ * - Space: O(1)
+ */
+enum ds_error
+ds_uc_pop_back(struct ds_unrolled_chain *chain, void **out, ds_destructor_fn destroy);
+
+/**
+ * @brief   Removes the element at the specified index.
+ * @see     ds_nc_pop_at
+ *
+ * @details A node that drops to half of its capacity together with its
+ * successor is merged with it, keeping the nodes densely populated.
+ *
+ * @par Complexity
+ * - Time:  O(N / K + K)
+ * - Space: O(1)
+ */
+enum ds_error
+ds_uc_pop_at(struct ds_unrolled_chain *chain, size_t index, void **out, ds_destructor_fn destroy);
+
+/** @} */ //end of UnrolledChainInternals group
+
+#endif //LIBDS_IMPL_UNROLLEDCHAIN_H
@@ -0,0 +1,93 @@
+/**
+ * @file    indexedlistdef.h
+ * @brief   Type-safe indexable list generator macro.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ *
+ * This module provides a list implementation through the
+ * @ref LIBDS_DEF_INDEXED_LIST macro. It generates exactly the same `Prefix_`
+ * API as @ref LIBDS_DEF_LIST, but runs on the skip list engine, whose links
+ * skip a recorded number of positions (see impl/skiplist.h).
+ *
+ * Key features:
+ * - Drop-in replacement for lists generated by @ref LIBDS_DEF_LIST
+ * - Expected O(log N) `get_at`, `set_at`, `push_at` and `pop_at`
+ * - Nodes recycled through the chunked pools of the node engine
+ *
+ * @note Requires C11 or later due to _Alignof() usage
+ * @warning This implementation does NOT PROVIDE THREAD-SAFETY.
+ * @warning Direct manipulation of the `_nodes` member causes undefined behavior.
+ *
+ * @see listdef.h, core.h, impl/skiplist.h
+ */
+
+#ifndef LIBDS_INDEXEDLISTDEF_H
+#define LIBDS_INDEXEDLISTDEF_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "core.h"
+#include "impl/skiplist.h"
+#include "impl/contdef.h"
+#include "listdef.h"
+
+/**
+ * @defgroup IndexedList Indexed List Container
+ * @brief   List backed by a skip list, with O(log N) positional access
+ * @{
+ */
+
+/**
+ * @def LIBDS_DEF_INDEXED_LIST
+ * @brief   Generate a type-safe list container backed by the skip list engine
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   ListType    Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for bitwise assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * The generated functions are the same as the ones of @ref LIBDS_DEF_LIST, so
+ * switching a list over only requires changing the generator macro.
+ *
+ * @par Complexity Differences
+ * - `get_at`, `set_at` - O(log N) expected
+ * - `push_at`, `pop_at`, `drop_at` - O(log N) expected
+ * - `push_front`, `push_back`, `pop_front`, `pop_back` - O(log N) expected
+ *
+ * @par Example
+ * @code
+ *  #include <libds/indexedlistdef.h>
+ *
+ *  LIBDS_DEF_INDEXED_LIST(int, IListInt, ili, NULL, NULL)
+ *
+ *  int main()
+ *  {
+ *      IListInt list = ili_create();
+ *
+ *      for (int i = 0; i < 1000; i++)
+ *          ili_push_at(list, ili_length(list) / 2, i);
+ *
+ *      int value;
+ *      ili_get_at(list, 500, &value); // descends the levels
+ *
+ *      ili_delete(&list);
+ *      return 0;
+ *  }
+ * @endcode
+ *
+ * @note Every element costs its payload plus two words per level, about
+ * 1.33 levels on average, in exchange for the logarithmic positional access.
+ */
+#define LIBDS_DEF_INDEXED_LIST(Type, ListType, Prefix, CopyFunc, DestroyFunc)   \
+                                                                                \
+    LIBDS_DEF_CONTAINER_BASE(Type, ListType, Prefix, CopyFunc, DestroyFunc,     \
+        ds_sl, ds_skip_list)                                                    \
+    LIBDS_DEF_LIST_OPS(Type, ListType, Prefix, ds_sl)                           \
+/* end of macro */
+
+/** @} */ //end of IndexedList group
+
+#endif //LIBDS_INDEXEDLISTDEF_H
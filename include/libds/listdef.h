@@ -1,6 +1,6 @@
 /**
  * @file    listdef.h
- * @brief   Type-safe singly-linked list generator macro.
+ * @brief   Type-safe singly and doubly-linked list generator macros.
  *
  * @author  Gabriel Souza
  * @date    2026-04-09
@@ -15,6 +15,9 @@
  * - Node recycling for O(1) reuse of deleted elements
  * - Custom copy/destroy functions for complex data types
  * - Ownership transfer via pop operations
+ * - Optional doubly-linked layout (@ref LIBDS_DEF_DLIST) for O(1) back removal
+ * - O(1) removal given a reference to a stored element (doubly-linked lists)
+ * - O(1) copy-on-write snapshots for read-only views on other threads
  *
  * @note Requires C11 or later due to _Alignof() usage
  * @warning This implementation does NOT PROVIDE THREAD-SAFETY.
@@ -41,175 +44,22 @@
  */
 
 /**
- * @def LIBDS_DEF_LIST
- * @brief   Generate a complete type-safe list container interface
- * @param   Type        The data type to store (must be a complete type)
- * @param   ListType    Name of the generated container structure
- * @param   Prefix      Function prefix for all generated operations
- * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for bitwise assignment
- * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
- *
- * This macro expands to define:
- * - A container structure type `ListType` wrapping @ref ds_node_chain
- * - A complete set of operations prefixed with `Prefix_`
- * - Automatic memory management with geometric growth
- * - Type-safe insertion/removal with custom copy/destroy semantics
- *
- * @par Memory Management
- * The generated container manages two aspects of memory:
- * - Node memory (handled automatically by the library)
- * - Payload memory (handled by CopyFunc and DestroyFunc)
- *
- * @par Custom Copy Function
- * The CopyFunc (type @ref ds_copier_fn) is called during insertion operations.
- * It must copy data from `src` into uninitialized memory at `dst`.
- *
- * @par Custom Destroy Function
- * The DestroyFunc (type @ref ds_destructor_fn) is called when removing elements.
- * It must free any dynamically allocated resources within the payload.
- *
- * @par Ownership Transfer
- * Functions that perform a pop (`pop_front`, `pop_back`, and `pop_at`) transfer
- * ownership of the payload to the caller, who must free it. Passing NULL as the
- * output parameter triggers automatic destruction.
- *
- * @par Example: Basic Usage with Integers
- * @code
- *  #include <stdio.h>
- *  #include <libds/listdef.h>
- *
- *  LIBDS_DEF_LIST(int, ListInt, li, NULL, NULL)
- *
- *  int main()
- *  {
- *      ListInt list = li_create();
- *
- *      li_push_back(list, 10);
- *      li_push_front(list, 5);
- *      li_push_at(list, 1, 7);
- *
- *      int value;
- *      li_pop_front(list, &value);
- *      printf("Value: %d\n", value); // Output: 5
- *
- *      printf("Length: %zu\n", li_length(list)); // Output: 2
- *      li_delete(&list);
- *
- *      return 0;
- *  }
- * @endcode
- *
- * @par Example: Storing Strings with Custom Copy/Destroy
- * @code
- *  #include <stdio.h>
- *  #include <stdlib.h>
- *  #include <string.h>
- *  #include <libds/listdef.h>
- *
- *  bool copy_str(void *dst, const void *src)
- *  {
- *      if (!dst || !src) return false;
- *      const size_t len = strlen(*(const char **)src);
- *
- *      char *new_str = malloc(len + 1);
- *      if (!new_str) return false;
- *      new_str[len] = '\0';
- *
- *      strncpy(new_str, *(const char **)src, len);
- *      *(char **)dst = new_str;
- *      return true;
- *  }
- *
- *  void destroy_str(void *data)
- *  {
- *      if (!data) return;
- *      free(*(char **)data);
- *      *(char **)data = NULL;
- *  }
- *
- *  LIBDS_DEF_LIST(char *, ListStr, ls, copy_str, destroy_str)
- *
- *  int main()
- *  {
- *      ListStr rock_bands = ls_create();
- *
- *      ls_prepend(rock_bands, "The Beatles");  // or ls_push_front
- *      ls_append(rock_bands, "Queen");         // or ls_push_back
- *      ls_push_at(rock_bands, 1, "AC/DC");
- *
- *      // new order: ["Queen", "AC/DC", "The Beatles"]
- *      ls_reverse(rock_bands);
- *
- *      // remove "The Beatles", destructor is called automatically
- *      ls_drop_at(rock_bands, 2);
- *
- *      char *out;
- *      ls_pop_at(rock_bands, 0, &out);
- *      printf("Band: %s\n", out);              // pops "Queen"
- *      free(out);                              // ownership transferred to 'out'
- *
- *      ls_delete(&rock_bands);                 // automatically frees "AC/DC"
- *      return 0;
- *  }
- * @endcode
- *
- * @par Generated Functions (All prefixed with `Prefix_`)
- *
- * **Creation & Destruction:**
- * - `create(void)` - Allocate and initialize new container
- * - `delete(ListType*)` - Free all nodes and nullify reference
- * - `clear(ListType)` - Remove all elements (preserves capacity)
- * - `deep_clear(ListType)` - Clear and free recycled nodes
- * - `copy(ListType, const ListType)` - Deep copy container
- *
- * **Insertion:**
- * - `push_front(ListType, Type)` / `prepend` - Insert at beginning O(1)
- * - `push_back(ListType, Type)` / `append` - Insert at end O(1)
- * - `push_at(ListType, size_t, Type)` - Insert at index O(N)
- *
- * **Removal (with ownership transfer):**
- * - `pop_front(ListType, Type*)` - Remove first element O(1)
- * - `pop_back(ListType, Type*)` - Remove last element O(N)
- * - `pop_at(ListType, size_t, Type*)` - Remove at index O(N)
- *
- * **Removal (automatic destruction):**
- * - `drop_front(ListType)` - Discard first element O(1)
- * - `drop_back(ListType)` - Discard last element O(N)
- * - `drop_at(ListType, size_t)` - Discard at index O(N)
- *
- * **Access:**
- * - `get_front(ListType, Type*)` - Peek first element O(1)
- * - `get_back(ListType, Type*)` - Peek last element O(1)
- * - `get_at(ListType, size_t, Type*)` - Peek at index O(N)
- *
- * **Modification:**
- * - `set_front(ListType, Type)` - Replace first element O(1)
- * - `set_back(ListType, Type)` - Replace last element O(1)
- * - `set_at(ListType, size_t, Type)` - Replace at index O(N)
- * - `reverse(ListType)` - Reverse list order O(N)
- *
- * **Query:**
- * - `length(ListType)` / `size(ListType)` - Element count O(1)
- * - `bytes(ListType)` - Total allocated memory O(log N)
- * - `is_empty(ListType)` - Check if empty O(1)
- *
- * @note The `prepend` and `append` functions are aliases for `push_front` and
- * `push_back`.
+ * @def     LIBDS_DEF_LIST_OPS
+ * @brief   Generates the list-specific operations on top of any engine.
  *
- * @note All operations that return @ref ds_error will report failures via stderr
- * if @ref LIBDS_ENABLE_ERROR_PRINT is enabled.
+ * @param   Engine  Function prefix of the engine (e.g. `ds_nc`, `ds_uc`).
  *
- * @note The library may call exit() if @ref LIBDS_ENABLE_EXIT_ON_FAIL is enabled.
+ * Besides the base container contract (see @ref LIBDS_DEF_CONTAINER_BASE),
+ * the engine must provide `reverse`, `push_front`, `push_back`, `push_at`,
+ * `pop_front`, `pop_back`, `pop_at`, and `unshare`, called with the index of
+ * an element before it is written in place (see @ref ds_nc_unshare).
  */
-#define LIBDS_DEF_LIST(Type, ListType, Prefix, CopyFunc, DestroyFunc)           \
-                                                                                \
-    LIBDS_DEF_CONTAINER(Type, ListType, Prefix, CopyFunc, DestroyFunc)          \
-                                                                                \
+#define LIBDS_DEF_LIST_OPS(Type, ListType, Prefix, Engine)                      \
     static inline enum ds_error                                                 \
     Prefix##_reverse(ListType list)                                             \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_reverse(list._nodes)                                          \
+            Engine##_reverse(list._nodes)                                       \
         );                                                                      \
     }                                                                           \
                                                                                 \
@@ -218,7 +68,12 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_get_front(list._nodes, &data)                                 \
+            Engine##_unshare(list._nodes, 0)                                    \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        error = LIBDS_CHECK(                                                    \
+            Engine##_get_front(list._nodes, &data)                              \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -231,7 +86,12 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_get_back(list._nodes, &data)                                  \
+            Engine##_unshare(list._nodes, Engine##_length(list._nodes) -1)      \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        error = LIBDS_CHECK(                                                    \
+            Engine##_get_back(list._nodes, &data)                               \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -244,7 +104,12 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_get_at(list._nodes, index, &data)                             \
+            Engine##_unshare(list._nodes, index)                                \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        error = LIBDS_CHECK(                                                    \
+            Engine##_get_at(list._nodes, index, &data)                          \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -257,7 +122,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_push_front(list._nodes, &data)                                \
+            Engine##_push_front(list._nodes, &data)                             \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -267,7 +132,7 @@
         {                                                                       \
             if ( !list.copy(data, &value) )                                     \
             {                                                                   \
-                ds_nc_pop_front(list._nodes, NULL, NULL);                       \
+                Engine##_pop_front(list._nodes, NULL, NULL);                    \
                                                                                 \
                 LIBDS_HANDLE_ERR(                                               \
                     DS_ERR_COPY_FAILED,                                         \
@@ -291,7 +156,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_push_back(list._nodes, &data)                                 \
+            Engine##_push_back(list._nodes, &data)                              \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -301,7 +166,7 @@
         {                                                                       \
             if ( !list.copy(data, &value) )                                     \
             {                                                                   \
-                ds_nc_pop_back(list._nodes, NULL, NULL);                        \
+                Engine##_pop_back(list._nodes, NULL, NULL);                     \
                                                                                 \
                 LIBDS_HANDLE_ERR(                                               \
                     DS_ERR_COPY_FAILED,                                         \
@@ -325,7 +190,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_push_at(list._nodes, index, &data)                            \
+            Engine##_push_at(list._nodes, index, &data)                         \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -335,7 +200,7 @@
         {                                                                       \
             if (!list.copy(data, &value))                                       \
             {                                                                   \
-                ds_nc_pop_at(list._nodes, index, NULL, NULL);                   \
+                Engine##_pop_at(list._nodes, index, NULL, NULL);                \
                                                                                 \
                 LIBDS_HANDLE_ERR(                                               \
                     DS_ERR_COPY_FAILED,                                         \
@@ -352,7 +217,7 @@
     Prefix##_drop_front(ListType list)                                          \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_pop_front(list._nodes, NULL, list.destroy)                    \
+            Engine##_pop_front(list._nodes, NULL, list.destroy)                 \
         );                                                                      \
     }                                                                           \
                                                                                 \
@@ -360,7 +225,7 @@
     Prefix##_drop_back(ListType list)                                           \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_pop_back(list._nodes, NULL, list.destroy)                     \
+            Engine##_pop_back(list._nodes, NULL, list.destroy)                  \
         );                                                                      \
     }                                                                           \
                                                                                 \
@@ -368,7 +233,7 @@
     Prefix##_drop_at(ListType list, const size_t index)                         \
     {                                                                           \
         return LIBDS_CHECK(                                                     \
-            ds_nc_pop_at(list._nodes, index, NULL, list.destroy)                \
+            Engine##_pop_at(list._nodes, index, NULL, list.destroy)             \
         );                                                                      \
     }                                                                           \
     static inline enum ds_error                                                 \
@@ -376,7 +241,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_pop_front(list._nodes, &data, list.destroy)                   \
+            Engine##_pop_front(list._nodes, &data, list.destroy)                \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -389,7 +254,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_pop_back(list._nodes, &data, list.destroy)                    \
+            Engine##_pop_back(list._nodes, &data, list.destroy)                 \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -402,7 +267,7 @@
     {                                                                           \
         void *data = NULL;                                                      \
         enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_pop_at(list._nodes, index, &data, list.destroy)               \
+            Engine##_pop_at(list._nodes, index, &data, list.destroy)            \
         );                                                                      \
         if (error) return error;                                                \
                                                                                 \
@@ -416,6 +281,611 @@
     }                                                                           \
 /* end of macro */
 
+/**
+ * @def     LIBDS_DEF_LIST_REF_OPS
+ * @brief   Generates the element reference operations of node chain lists.
+ *
+ * A reference is a pointer to an element stored in the list. Nodes never move,
+ * so it stays valid until the element is removed, the list is cleared, or a
+ * snapshot of the list is taken.
+ */
+#define LIBDS_DEF_LIST_REF_OPS(Type, ListType, Prefix)                          \
+    static inline enum ds_error                                                 \
+    Prefix##_ref_at(ListType list, const size_t index, Type **out)              \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_nc_unshare(list._nodes, index)                                   \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        error = LIBDS_CHECK(                                                    \
+            ds_nc_get_at(list._nodes, index, &data)                             \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (out) *out = (Type *)data;                                           \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_drop_ref(ListType list, Type *ref)                                 \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_pop_node(list._nodes, ref, NULL, list.destroy)                \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_pop_ref(ListType list, Type *ref, Type *out)                       \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_nc_pop_node(list._nodes, ref, out ? &data : NULL, list.destroy)  \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (out) *out = *((Type *)data);                                        \
+                                                                                \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_LIST_CURSOR_OPS
+ * @brief   Generates the cursor operations of node chain lists.
+ *
+ * A cursor (`struct ds_nc_cursor`) walks the list one node at a time, and
+ * inserts or removes right after its node in O(1), without walking from the
+ * head again. It stays valid until its own node is removed, or the list is
+ * snapshotted, cleared, copied, swapped, moved, compacted or split: the
+ * cursor functions then return DS_ERR_STALE_CURSOR. Reading through it never
+ * copies the nodes a snapshot shares; `cursor_ref`, `insert_after` and
+ * `erase_after` copy them up to the cursor only.
+ */
+#define LIBDS_DEF_LIST_CURSOR_OPS(Type, ListType, Prefix)                       \
+    static inline struct ds_nc_cursor                                           \
+    Prefix##_cursor(ListType list)                                              \
+    {                                                                           \
+        struct ds_nc_cursor cursor = {                                          \
+            .chain = NULL, .node = NULL, .index = 0, .epoch = 0                 \
+        };                                                                      \
+        LIBDS_CHECK(                                                            \
+            ds_nc_cursor_begin(list._nodes, &cursor)                            \
+        );                                                                      \
+        return cursor;                                                          \
+    }                                                                           \
+                                                                                \
+    static inline Type *                                                        \
+    Prefix##_cursor_ref(struct ds_nc_cursor *cursor)                            \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        if (ds_nc_cursor_ref(cursor, &data)) return NULL;                       \
+        return (Type *)data;                                                    \
+    }                                                                           \
+                                                                                \
+    static inline Type const *                                                  \
+    Prefix##_cursor_peek(const struct ds_nc_cursor *cursor)                     \
+    {                                                                           \
+        const void *data = NULL;                                                \
+        if (ds_nc_cursor_get(cursor, &data)) return NULL;                       \
+        return (Type const *)data;                                              \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_cursor_get(const struct ds_nc_cursor *cursor, Type *out)           \
+    {                                                                           \
+        const void *data = NULL;                                                \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_nc_cursor_get(cursor, &data)                                     \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (out) *out = *((Type const *)data);                                  \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_cursor_next(struct ds_nc_cursor *cursor)                           \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_cursor_next(cursor)                                           \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_insert_after(ListType list, struct ds_nc_cursor *cursor,           \
+        Type value)                                                             \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_nc_cursor_insert_after(cursor, &data)                            \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!list.copy)                                                         \
+            *((Type *)data) = value;                                            \
+        else                                                                    \
+        {                                                                       \
+            if (!list.copy(data, &value))                                       \
+            {                                                                   \
+                ds_nc_cursor_erase_after(cursor, NULL, NULL);                   \
+                                                                                \
+                LIBDS_HANDLE_ERR(                                               \
+                    DS_ERR_COPY_FAILED,                                         \
+                    LIBDS_STRINGIFY(list.copy(data, &value)),                   \
+                    __FILE__, __LINE__, __func__                                \
+                );                                                              \
+                return DS_ERR_COPY_FAILED;                                      \
+            }                                                                   \
+        }                                                                       \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_erase_after(ListType list, struct ds_nc_cursor *cursor,            \
+        Type *out)                                                              \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_nc_cursor_erase_after(cursor, out ? &data : NULL, list.destroy)  \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (out) *out = *((Type *)data);                                        \
+                                                                                \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline void                                                          \
+    Prefix##_foreach(ListType list,                                             \
+        void (*visit)(Type const *value, void *context), void *context)         \
+    {                                                                           \
+        struct ds_nc_cursor cursor = Prefix##_cursor(list);                     \
+        for (Type const *ref = Prefix##_cursor_peek(&cursor); ref != NULL;      \
+             ds_nc_cursor_next(&cursor), ref = Prefix##_cursor_peek(&cursor))   \
+            visit(ref, context);                                                \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_LIST_FOREACH
+ * @brief   Loops over the elements of a node chain list, in order.
+ *
+ * @param   Prefix  Function prefix of the list.
+ * @param   cursor  Name of the `struct ds_nc_cursor` declared for the loop.
+ * @param   ref     Variable of type `Type const *`, set to each element in turn.
+ * @param   list    The list.
+ *
+ * Each step follows one link, so a whole scan is O(N). `break` and `continue`
+ * behave as in any loop, and @p cursor can be given to `insert_after` and
+ * `erase_after` to edit the list in place, or to `cursor_ref` to write to the
+ * element: the loop itself only reads, and copies nothing a snapshot shares.
+ *
+ * @code
+ *  const int *value;
+ *  LIBDS_LIST_FOREACH(li, it, value, list)
+ *      if (*value < 0) li_insert_after(list, &it, 0);
+ * @endcode
+ */
+#define LIBDS_LIST_FOREACH(Prefix, cursor, ref, list)                           \
+    for (struct ds_nc_cursor cursor = Prefix##_cursor(list),                    \
+         *cursor##_once_ = &cursor; cursor##_once_; cursor##_once_ = NULL)      \
+        for ((ref) = Prefix##_cursor_peek(&cursor); (ref) != NULL;              \
+             ds_nc_cursor_next(&cursor), (ref) = Prefix##_cursor_peek(&cursor)) \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_LIST_BULK_OPS
+ * @brief   Generates the bulk insertion operations of node chain lists.
+ */
+#define LIBDS_DEF_LIST_BULK_OPS(Type, ListType, Prefix)                         \
+    static inline enum ds_error                                                 \
+    Prefix##_push_back_array(ListType list, Type const *values,                 \
+        const size_t count)                                                     \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_push_back_n(list._nodes, values, count, sizeof(Type),         \
+                list.copy, list.destroy)                                        \
+        );                                                                      \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_LIST_SPLIT_OPS
+ * @brief   Generates the splitting operation of node chain lists.
+ */
+#define LIBDS_DEF_LIST_SPLIT_OPS(Type, ListType, Prefix)                        \
+    static inline enum ds_error                                                 \
+    Prefix##_split(ListType list, const size_t index, ListType out)             \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_split_at(list._nodes, index, out._nodes, sizeof(Type))        \
+        );                                                                      \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_LIST_SORT_OPS
+ * @brief   Generates the in-place sorting operations of node chain lists.
+ */
+#define LIBDS_DEF_LIST_SORT_OPS(Type, ListType, Prefix)                         \
+    static inline enum ds_error                                                 \
+    Prefix##_sort(ListType list, const ds_comparator_fn cmp)                    \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_sort(list._nodes, cmp)                                        \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_parallel_sort(ListType list, const ds_comparator_fn cmp,           \
+        const size_t threads)                                                   \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_parallel_sort(list._nodes, cmp, threads)                      \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_parallel_sort_values(ListType list, const ds_comparator_fn cmp,    \
+        const size_t threads)                                                   \
+    {                                                                           \
+        /* values with a copy function may own resources, keep them in place */ \
+        if (list.copy)                                                          \
+            return Prefix##_parallel_sort(list, cmp, threads);                  \
+                                                                                \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_parallel_sort_values(list._nodes, cmp, threads, sizeof(Type)) \
+        );                                                                      \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_LIST_SNAPSHOT_OPS
+ * @brief   Generates the snapshot operations of node chain lists.
+ *
+ * A snapshot (`struct ds_nc_snapshot`) is a read-only view of the elements a
+ * list held when it was taken, shared by reference counting. Taking one costs
+ * O(1): it reads the nodes of the list in place. Pushing at either end of the
+ * list keeps sharing them, while any other change first copies the elements
+ * up to the one it touches, leaving the former nodes to the snapshot and
+ * sharing the rest (see @ref ds_nc_snapshot). The
+ * snapshot functions only read it, so other threads may use a snapshot while
+ * the list keeps changing, as long as each one holds a reference.
+ *
+ * @code
+ *  struct ds_nc_snapshot *view = NULL;
+ *  li_snapshot(list, &view);
+ *  li_snapshot_retain(view);           // one reference for the reader thread
+ *  li_push_back(list, 42);             // still shared
+ *  li_pop_front(list, NULL);           // leaves the first node to the view as it is
+ *  li_snapshot_release(&view);
+ * @endcode
+ */
+#define LIBDS_DEF_LIST_SNAPSHOT_OPS(Type, ListType, Prefix)                     \
+    static inline enum ds_error                                                 \
+    Prefix##_snapshot(ListType list, struct ds_nc_snapshot **out)               \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_snapshot(list._nodes, sizeof(Type), list.copy, list.destroy, out) \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_snapshot_retain(struct ds_nc_snapshot *snapshot)                   \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_snapshot_retain(snapshot)                                     \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_snapshot_release(struct ds_nc_snapshot **snapshot_ref)             \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            ds_nc_snapshot_release(snapshot_ref)                                \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline size_t                                                        \
+    Prefix##_snapshot_length(const struct ds_nc_snapshot *snapshot)             \
+    {                                                                           \
+        return ds_nc_snapshot_length(snapshot);                                 \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_snapshot_get_at(const struct ds_nc_snapshot *snapshot,             \
+        const size_t index, Type *out)                                          \
+    {                                                                           \
+        const void *data = NULL;                                                \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            ds_nc_snapshot_get_at(snapshot, index, &data)                       \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (out) *out = *((Type const *)data);                                  \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline void                                                          \
+    Prefix##_snapshot_foreach(const struct ds_nc_snapshot *snapshot,            \
+        void (*visit)(Type const *value, void *context), void *context)         \
+    {                                                                           \
+        struct ds_nc_snapshot_cursor cursor;                                    \
+        if (ds_nc_snapshot_begin(snapshot, &cursor)) return;                    \
+                                                                                \
+        const void *data = NULL;                                                \
+        while (!ds_nc_snapshot_get(&cursor, &data))                             \
+        {                                                                       \
+            visit((Type const *)data, context);                                 \
+            ds_nc_snapshot_next(&cursor);                                       \
+        }                                                                       \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def LIBDS_DEF_LIST
+ * @brief   Generate a complete type-safe list container interface
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   ListType    Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for bitwise assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * This macro expands to define:
+ * - A container structure type `ListType` wrapping @ref ds_node_chain
+ * - A complete set of operations prefixed with `Prefix_`
+ * - Automatic memory management with geometric growth
+ * - Type-safe insertion/removal with custom copy/destroy semantics
+ *
+ * @par Memory Management
+ * The generated container manages two aspects of memory:
+ * - Node memory (handled automatically by the library)
+ * - Payload memory (handled by CopyFunc and DestroyFunc)
+ *
+ * @par Custom Copy Function
+ * The CopyFunc (type @ref ds_copier_fn) is called during insertion operations.
+ * It must copy data from `src` into uninitialized memory at `dst`.
+ *
+ * @par Custom Destroy Function
+ * The DestroyFunc (type @ref ds_destructor_fn) is called when removing elements.
+ * It must free any dynamically allocated resources within the payload.
+ *
+ * @par Ownership Transfer
+ * Functions that perform a pop (`pop_front`, `pop_back`, and `pop_at`) transfer
+ * ownership of the payload to the caller, who must free it. Passing NULL as the
+ * output parameter triggers automatic destruction.
+ *
+ * @par Example: Basic Usage with Integers
+ * @code
+ *  #include <stdio.h>
+ *  #include <libds/listdef.h>
+ *
+ *  LIBDS_DEF_LIST(int, ListInt, li, NULL, NULL)
+ *
+ *  int main()
+ *  {
+ *      ListInt list = li_create();
+ *
+ *      li_push_back(list, 10);
+ *      li_push_front(list, 5);
+ *      li_push_at(list, 1, 7);
+ *
+ *      int value;
+ *      li_pop_front(list, &value);
+ *      printf("Value: %d\n", value); // Output: 5
+ *
+ *      printf("Length: %zu\n", li_length(list)); // Output: 2
+ *      li_delete(&list);
+ *
+ *      return 0;
+ *  }
+ * @endcode
+ *
+ * @par Example: Storing Strings with Custom Copy/Destroy
+ * @code
+ *  #include <stdio.h>
+ *  #include <stdlib.h>
+ *  #include <string.h>
+ *  #include <libds/listdef.h>
+ *
+ *  bool copy_str(void *dst, const void *src)
+ *  {
+ *      if (!dst || !src) return false;
+ *      const size_t len = strlen(*(const char **)src);
+ *
+ *      char *new_str = malloc(len + 1);
+ *      if (!new_str) return false;
+ *      new_str[len] = '\0';
+ *
+ *      strncpy(new_str, *(const char **)src, len);
+ *      *(char **)dst = new_str;
+ *      return true;
+ *  }
+ *
+ *  void destroy_str(void *data)
+ *  {
+ *      if (!data) return;
+ *      free(*(char **)data);
+ *      *(char **)data = NULL;
+ *  }
+ *
+ *  LIBDS_DEF_LIST(char *, ListStr, ls, copy_str, destroy_str)
+ *
+ *  int main()
+ *  {
+ *      ListStr rock_bands = ls_create();
+ *
+ *      ls_prepend(rock_bands, "The Beatles");  // or ls_push_front
+ *      ls_append(rock_bands, "Queen");         // or ls_push_back
+ *      ls_push_at(rock_bands, 1, "AC/DC");
+ *
+ *      // new order: ["Queen", "AC/DC", "The Beatles"]
+ *      ls_reverse(rock_bands);
+ *
+ *      // remove "The Beatles", destructor is called automatically
+ *      ls_drop_at(rock_bands, 2);
+ *
+ *      char *out;
+ *      ls_pop_at(rock_bands, 0, &out);
+ *      printf("Band: %s\n", out);              // pops "Queen"
+ *      free(out);                              // ownership transferred to 'out'
+ *
+ *      ls_delete(&rock_bands);                 // automatically frees "AC/DC"
+ *      return 0;
+ *  }
+ * @endcode
+ *
+ * @par Generated Functions (All prefixed with `Prefix_`)
+ *
+ * **Creation & Destruction:**
+ * - `create(void)` - Allocate and initialize new container
+ * - `delete(ListType*)` - Free all nodes and nullify reference
+ * - `clear(ListType)` - Remove all elements (preserves capacity)
+ * - `deep_clear(ListType)` - Clear and free recycled nodes
+ * - `copy(ListType, const ListType)` - Deep copy container
+ *
+ * **Insertion:**
+ * - `push_front(ListType, Type)` / `prepend` - Insert at beginning O(1)
+ * - `push_back(ListType, Type)` / `append` - Insert at end O(1)
+ * - `push_at(ListType, size_t, Type)` - Insert at index O(N)
+ * - `push_back_array(ListType, Type const*, size_t)` - Append an array O(count),
+ * all or nothing, with a single pool allocation
+ *
+ * **Removal (with ownership transfer):**
+ * - `pop_front(ListType, Type*)` - Remove first element O(1)
+ * - `pop_back(ListType, Type*)` - Remove last element O(N)
+ * - `pop_at(ListType, size_t, Type*)` - Remove at index O(N)
+ *
+ * **Removal (automatic destruction):**
+ * - `drop_front(ListType)` - Discard first element O(1)
+ * - `drop_back(ListType)` - Discard last element O(N)
+ * - `drop_at(ListType, size_t)` - Discard at index O(N)
+ *
+ * **Access:**
+ * - `get_front(ListType, Type*)` - Peek first element O(1)
+ * - `get_back(ListType, Type*)` - Peek last element O(1)
+ * - `get_at(ListType, size_t, Type*)` - Peek at index O(N)
+ *
+ * **Modification:**
+ * - `set_front(ListType, Type)` - Replace first element O(1)
+ * - `set_back(ListType, Type)` - Replace last element O(1)
+ * - `set_at(ListType, size_t, Type)` - Replace at index O(N)
+ * - `reverse(ListType)` - Reverse list order O(N)
+ * - `sort(ListType, ds_comparator_fn)` - Stable in-place merge sort O(N log N),
+ * relinks the nodes without moving or allocating
+ * - `parallel_sort(ListType, ds_comparator_fn, size_t)` - Same sort on up to
+ * `threads` threads O(N log N / T + N)
+ * - `parallel_sort_values(ListType, ds_comparator_fn, size_t)` - Sorts the values
+ * through a temporary buffer O(N log N / T + N), relinks instead when the list has
+ * a copy function
+ *
+ * **References:**
+ * - `ref_at(ListType, size_t, Type**)` - Pointer to the stored element O(N)
+ * - `pop_ref(ListType, Type*, Type*)` - Remove the referenced element O(N)
+ * - `drop_ref(ListType, Type*)` - Discard the referenced element O(N)
+ *
+ * **Cursors:**
+ * - `cursor(ListType)` - Cursor on the first element O(1)
+ * - `cursor_ref(struct ds_nc_cursor*)` - Writable pointer to the element, NULL past the end O(1)
+ * - `cursor_peek(const struct ds_nc_cursor*)` - Read-only pointer to the element, NULL past the end O(1)
+ * - `cursor_get(const struct ds_nc_cursor*, Type*)` - Peek the element O(1)
+ * - `cursor_next(struct ds_nc_cursor*)` - Move to the next element O(1)
+ * - `insert_after(ListType, struct ds_nc_cursor*, Type)` - Insert after the cursor O(1)
+ * - `erase_after(ListType, struct ds_nc_cursor*, Type*)` - Remove after the cursor O(1),
+ * with ownership transfer unless the output is NULL
+ * - `foreach(ListType, visit, context)` - Call `visit` on every element, read-only O(N),
+ * see also @ref LIBDS_LIST_FOREACH
+ *
+ * **Splicing:**
+ * - `concat(ListType, ListType)` - Move every element of the second list to the
+ * end of the first O(1) when the nodes can be relinked
+ * - `transfer(ListType, ListType, size_t)` - Move the first `count` elements of
+ * the second list to the end of the first O(count)
+ * - `split(ListType, size_t, ListType)` - Move the elements from an index on to
+ * the end of another list O(N)
+ *
+ * **Query:**
+ * - `length(ListType)` / `size(ListType)` - Element count O(1)
+ * - `bytes(ListType)` - Total allocated memory O(log N)
+ * - `is_empty(ListType)` - Check if empty O(1)
+ *
+ * @note The `prepend` and `append` functions are aliases for `push_front` and
+ * `push_back`.
+ *
+ * @note All operations that return @ref ds_error will report failures via stderr
+ * if @ref LIBDS_ENABLE_ERROR_PRINT is enabled.
+ *
+ * @note The library may call exit() if @ref LIBDS_ENABLE_EXIT_ON_FAIL is enabled.
+ */
+#define LIBDS_DEF_LIST(Type, ListType, Prefix, CopyFunc, DestroyFunc)           \
+                                                                                \
+    LIBDS_DEF_CONTAINER(Type, ListType, Prefix, CopyFunc, DestroyFunc)          \
+    LIBDS_DEF_LIST_OPS(Type, ListType, Prefix, ds_nc)                           \
+    LIBDS_DEF_LIST_REF_OPS(Type, ListType, Prefix)                              \
+    LIBDS_DEF_LIST_CURSOR_OPS(Type, ListType, Prefix)                           \
+    LIBDS_DEF_LIST_SORT_OPS(Type, ListType, Prefix)                             \
+    LIBDS_DEF_LIST_SPLIT_OPS(Type, ListType, Prefix)                            \
+    LIBDS_DEF_LIST_BULK_OPS(Type, ListType, Prefix)                             \
+    LIBDS_DEF_LIST_SNAPSHOT_OPS(Type, ListType, Prefix)                         \
+/* end of macro */
+
+/**
+ * @def LIBDS_DEF_DLIST
+ * @brief   Generate a type-safe doubly-linked list container interface
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   ListType    Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for bitwise assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * Generates the same functions as @ref LIBDS_DEF_LIST, on a chain allocated by
+ * @ref ds_nc_alloc_doubly. Each node carries an extra `prev` pointer, so only
+ * the lists that remove from the back or by reference should pay for it.
+ *
+ * @par Complexity Differences
+ * - `pop_back`, `drop_back` - O(1)
+ * - `pop_ref`, `drop_ref` - O(1)
+ * - `get_at`, `set_at`, `push_at`, `pop_at`, `drop_at`, `ref_at` - O(N / 2),
+ * walking from the closest end
+ *
+ * @par Example: LRU Order
+ * @code
+ *  #include <libds/listdef.h>
+ *
+ *  LIBDS_DEF_DLIST(int, DListInt, dli, NULL, NULL)
+ *
+ *  int main()
+ *  {
+ *      DListInt lru = dli_create();
+ *
+ *      int *entry;
+ *      dli_push_front(lru, 42);
+ *      dli_ref_at(lru, 0, &entry);     // keep the reference of the entry
+ *      dli_push_front(lru, 7);
+ *
+ *      dli_drop_ref(lru, entry);       // O(1), wherever it is
+ *      dli_drop_back(lru);             // O(1) eviction
+ *
+ *      dli_delete(&lru);
+ *      return 0;
+ *  }
+ * @endcode
+ */
+#define LIBDS_DEF_DLIST(Type, ListType, Prefix, CopyFunc, DestroyFunc)          \
+                                                                                \
+    LIBDS_DEF_CHAIN_CONTAINER(Type, ListType, Prefix, CopyFunc, DestroyFunc,    \
+        ds_nc_alloc_doubly)                                                     \
+    LIBDS_DEF_LIST_OPS(Type, ListType, Prefix, ds_nc)                           \
+    LIBDS_DEF_LIST_REF_OPS(Type, ListType, Prefix)                              \
+    LIBDS_DEF_LIST_CURSOR_OPS(Type, ListType, Prefix)                           \
+    LIBDS_DEF_LIST_SORT_OPS(Type, ListType, Prefix)                             \
+    LIBDS_DEF_LIST_SPLIT_OPS(Type, ListType, Prefix)                            \
+    LIBDS_DEF_LIST_BULK_OPS(Type, ListType, Prefix)                             \
+    LIBDS_DEF_LIST_SNAPSHOT_OPS(Type, ListType, Prefix)                         \
+/* end of macro */
+
 /** @} */ //end of SinglyLinkedList group
 
 #endif //LIBDS_LISTDEF_H
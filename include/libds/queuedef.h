@@ -15,12 +15,13 @@
  * - Type-safe code generation (no void* casting required)
  * - Intrusive memory layout for cache efficiency
  * - Ownership transfer via dequeue operation
+ * - Optional contiguous ring buffer backend, growable or fixed-capacity
  *
  * @note Requires C11 or later due to _Alignof() usage
  * @warning This implementation does NOT PROVIDE THREAD-SAFETY.
  * @warning Direct manipulation of the `_nodes` member causes undefined behavior.
  *
- * @see listdef.h, stackdef.h, core.h, impl/nodechain.h
+ * @see listdef.h, stackdef.h, core.h, impl/nodechain.h, impl/ringbuffer.h
  */
 
 #ifndef LIBDS_QUEUEDEF_H
@@ -32,6 +33,7 @@
 
 #include "core.h"
 #include "impl/nodechain.h"
+#include "impl/ringbuffer.h"
 #include "impl/contdef.h"
 
 /**
@@ -40,6 +42,91 @@
  * @{
  */
 
+/**
+ * @def     LIBDS_DEF_QUEUE_OPS
+ * @brief   Generates the queue-specific operations on top of any engine.
+ *
+ * @param   Engine  Function prefix of the engine (e.g. `ds_nc`, `ds_rb`).
+ *
+ * Besides the base container contract (see @ref LIBDS_DEF_CONTAINER_BASE),
+ * the engine must provide `push_back`, `pop_front` and `pop_back`.
+ */
+#define LIBDS_DEF_QUEUE_OPS(Type, QueueType, Prefix, Engine)                    \
+    static inline enum ds_error                                                 \
+    Prefix##_enqueue(QueueType queue, Type value)                               \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            Engine##_push_back(queue._nodes, &data)                             \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!queue.copy)                                                        \
+            *((Type *)data) = value;                                            \
+        else                                                                    \
+        {                                                                       \
+            if ( !queue.copy(data, &value) )                                    \
+            {                                                                   \
+                Engine##_pop_back(queue._nodes, NULL, NULL);                    \
+                                                                                \
+                LIBDS_HANDLE_ERR(                                               \
+                    DS_ERR_COPY_FAILED,                                         \
+                    LIBDS_STRINGIFY(queue.copy(data, &value)),                  \
+                    __FILE__, __LINE__, __func__                                \
+                );                                                              \
+                return DS_ERR_COPY_FAILED;                                      \
+            }                                                                   \
+        }                                                                       \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_dequeue(QueueType queue, Type *out)                                \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            Engine##_pop_front(queue._nodes, &data, queue.destroy)              \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!out && queue.destroy)                                              \
+            queue.destroy(data);                                                \
+                                                                                \
+        else if (out)                                                           \
+            *out = *((Type *)data);                                             \
+                                                                                \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_QUEUE_BULK_OPS
+ * @brief   Generates the bulk queue operations on top of any engine.
+ *
+ * The engine must provide `push_back_n` and `pop_front_n`, with the same
+ * contracts as the ones declared in impl/nodechain.h.
+ */
+#define LIBDS_DEF_QUEUE_BULK_OPS(Type, QueueType, Prefix, Engine)               \
+    static inline enum ds_error                                                 \
+    Prefix##_enqueue_n(QueueType queue, Type const *values, const size_t count) \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            Engine##_push_back_n(queue._nodes, values, count, sizeof(Type),     \
+                queue.copy, queue.destroy)                                      \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_dequeue_n(QueueType queue, Type *out, const size_t count,          \
+        size_t *popped)                                                         \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            Engine##_pop_front_n(queue._nodes, out, count, sizeof(Type),        \
+                queue.destroy, popped)                                          \
+        );                                                                      \
+    }                                                                           \
+/* end of macro */
+
 /**
  * @def LIBDS_DEF_QUEUE
  * @brief   Generate a complete type-safe queue container interface
@@ -100,6 +187,10 @@
  * - `enqueue(QueueType, Type)` - Insert element at the back O(1)
  * - `dequeue(QueueType, Type*)` - Remove element from the front with ownership
  * transfer O(1)
+ * - `enqueue_n(QueueType, Type const*, size_t)` - Insert an array at the back,
+ * all or nothing, with a single pool allocation O(count)
+ * - `dequeue_n(QueueType, Type*, size_t, size_t*)` - Remove up to `count`
+ * elements into an array, reporting how many were removed O(count)
  *
  * **Access (Common):**
  * - `get_front(QueueType, Type*)` - Peek the front element O(1)
@@ -117,51 +208,88 @@
 #define LIBDS_DEF_QUEUE(Type, QueueType, Prefix, CopyFunc, DestroyFunc)         \
                                                                                 \
     LIBDS_DEF_CONTAINER(Type, QueueType, Prefix, CopyFunc, DestroyFunc)         \
+    LIBDS_DEF_QUEUE_OPS(Type, QueueType, Prefix, ds_nc)                         \
+    LIBDS_DEF_QUEUE_BULK_OPS(Type, QueueType, Prefix, ds_nc)                    \
+/* end of macro */
+
+/**
+ * @def LIBDS_DEF_RING_QUEUE
+ * @brief   Generate a type-safe queue container backed by a contiguous ring buffer
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   QueueType   Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for simple assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * Generates the same functions as @ref LIBDS_DEF_QUEUE, but elements are stored
+ * back to back in a power-of-two array (see impl/ringbuffer.h). Enqueue and
+ * dequeue never allocate per element, and the consumer streams through memory
+ * sequentially.
+ *
+ * @par Additional Functions (All prefixed with `Prefix_`)
+ * - `create_fixed(size_t)` - Allocate a queue bounded to the given capacity.
+ * `enqueue` then fails with DS_ERR_FULL_STRUCTURE when the queue is full.
+ * - `capacity(QueueType)` - Elements that fit without growing O(1)
+ *
+ * @par Complexity Differences
+ * - `enqueue` - O(1) amortized, the array doubles when full
+ * - `get_at` - O(1)
+ * - `clear` - O(1), O(N) if a destructor is set
+ *
+ * @par Example: Bounded Queue
+ * @code
+ *  #include <libds/queuedef.h>
+ *
+ *  LIBDS_DEF_RING_QUEUE(int, RingInt, rq, NULL, NULL)
+ *
+ *  int main()
+ *  {
+ *      RingInt queue = rq_create_fixed(1024);
+ *
+ *      while (rq_enqueue(queue, 42) != DS_ERR_FULL_STRUCTURE) {}
+ *
+ *      int value;
+ *      rq_dequeue(queue, &value);
+ *
+ *      rq_delete(&queue);
+ *      return 0;
+ *  }
+ * @endcode
+ */
+#define LIBDS_DEF_RING_QUEUE(Type, QueueType, Prefix, CopyFunc, DestroyFunc)    \
                                                                                 \
-    static inline enum ds_error                                                 \
-    Prefix##_enqueue(QueueType queue, Type value)                               \
+    LIBDS_DEF_CONTAINER_BASE(Type, QueueType, Prefix, CopyFunc, DestroyFunc,    \
+        ds_rb, ds_ring_buffer)                                                  \
+    LIBDS_DEF_QUEUE_OPS(Type, QueueType, Prefix, ds_rb)                         \
+    LIBDS_DEF_QUEUE_BULK_OPS(Type, QueueType, Prefix, ds_rb)                    \
+                                                                                \
+    static inline QueueType                                                     \
+    Prefix##_create_fixed(const size_t capacity)                                \
     {                                                                           \
-        void *data = NULL;                                                      \
-        enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_push_back(queue._nodes, &data)                                \
-        );                                                                      \
-        if (error) return error;                                                \
+        size_t value_size  = sizeof(Type);                                      \
+        size_t value_align = alignof(Type);                                     \
                                                                                 \
-        if (!queue.copy)                                                        \
-            *((Type *)data) = value;                                            \
-        else                                                                    \
-        {                                                                       \
-            if ( !queue.copy(data, &value) )                                    \
-            {                                                                   \
-                ds_nc_pop_back(queue._nodes, NULL, NULL);                       \
+        QueueType queue = {                                                     \
+            .copy    = (CopyFunc),                                              \
+            .destroy = (DestroyFunc),                                           \
+            ._nodes  = ds_rb_alloc_fixed(value_size, value_align, capacity)     \
+        };                                                                      \
                                                                                 \
-                LIBDS_HANDLE_ERR(                                               \
-                    DS_ERR_COPY_FAILED,                                         \
-                    LIBDS_STRINGIFY(queue.copy(data, &value)),                  \
-                    __FILE__, __LINE__, __func__                                \
-                );                                                              \
-                return DS_ERR_COPY_FAILED;                                      \
-            }                                                                   \
-        }                                                                       \
-        return DS_ERR_NONE;                                                     \
+        if (!queue._nodes)                                                      \
+            LIBDS_HANDLE_ERR(                                                   \
+                DS_ERR_ALLOCATION_FAILED,                                       \
+                LIBDS_STRINGIFY(ds_rb_alloc_fixed(value_size, value_align,      \
+                    capacity)),                                                 \
+                __FILE__, __LINE__, __func__                                    \
+            );                                                                  \
+                                                                                \
+        return queue;                                                           \
     }                                                                           \
                                                                                 \
-    static inline enum ds_error                                                 \
-    Prefix##_dequeue(QueueType queue, Type *out)                                \
+    static inline size_t                                                        \
+    Prefix##_capacity(const QueueType queue)                                    \
     {                                                                           \
-        void *data = NULL;                                                      \
-        enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_pop_front(queue._nodes, &data, queue.destroy)                 \
-        );                                                                      \
-        if (error) return error;                                                \
-                                                                                \
-        if (!out && queue.destroy)                                              \
-            queue.destroy(data);                                                \
-                                                                                \
-        else if (out)                                                           \
-            *out = *((Type *)data);                                             \
-                                                                                \
-        return DS_ERR_NONE;                                                     \
+        return ds_rb_capacity(queue._nodes);                                    \
     }                                                                           \
 /* end of macro */    
 
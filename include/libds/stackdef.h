@@ -16,12 +16,13 @@
  * - Type-safe code generation (no void* casting required)
  * - Intrusive memory layout for cache efficiency
  * - Ownership transfer via pop operation
+ * - Optional contiguous segmented array backend with pre-sizing
  *
  * @note Requires C11 or later due to _Alignof() usage
  * @warning This implementation does NOT PROVIDE THREAD-SAFETY.
  * @warning Direct manipulation of the `_nodes` member causes undefined behavior.
  *
- * @see listdef.h, queuedef.h, core.h, impl/nodechain.h
+ * @see listdef.h, queuedef.h, core.h, impl/nodechain.h, impl/segmentedstack.h
  */
 
 #ifndef LIBDS_STACKDEF_H
@@ -33,6 +34,7 @@
 
 #include "core.h"
 #include "impl/nodechain.h"
+#include "impl/segmentedstack.h"
 #include "impl/contdef.h"
 
 /**
@@ -41,6 +43,92 @@
  * @{
  */
 
+/**
+ * @def     LIBDS_DEF_STACK_OPS
+ * @brief   Generates the stack-specific operations on top of any engine.
+ *
+ * @param   Engine  Function prefix of the engine (e.g. `ds_nc`, `ds_ss`).
+ *
+ * Besides the base container contract (see @ref LIBDS_DEF_CONTAINER_BASE),
+ * the engine must provide `push_front` and `pop_front`, the front being the
+ * top of the stack.
+ */
+#define LIBDS_DEF_STACK_OPS(Type, StackType, Prefix, Engine)                    \
+    static inline enum ds_error                                                 \
+    Prefix##_push(StackType stack, Type value)                                  \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            Engine##_push_front(stack._nodes, &data)                            \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!stack.copy)                                                        \
+            *((Type *)data) = value;                                            \
+        else                                                                    \
+        {                                                                       \
+            if ( !stack.copy(data, &value) )                                    \
+            {                                                                   \
+                Engine##_pop_front(stack._nodes, NULL, NULL);                   \
+                                                                                \
+                LIBDS_HANDLE_ERR(                                               \
+                    DS_ERR_COPY_FAILED,                                         \
+                    LIBDS_STRINGIFY(stack.copy(data, &value)),                  \
+                    __FILE__, __LINE__, __func__                                \
+                );                                                              \
+                return DS_ERR_COPY_FAILED;                                      \
+            }                                                                   \
+        }                                                                       \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_pop(StackType stack, Type *out)                                    \
+    {                                                                           \
+        void *data = NULL;                                                      \
+        enum ds_error error = LIBDS_CHECK(                                      \
+            Engine##_pop_front(stack._nodes, &data, stack.destroy)              \
+        );                                                                      \
+        if (error) return error;                                                \
+                                                                                \
+        if (!out && stack.destroy)                                              \
+            stack.destroy(data);                                                \
+                                                                                \
+        else if (out)                                                           \
+            *out = *((Type *)data);                                             \
+                                                                                \
+        return DS_ERR_NONE;                                                     \
+    }                                                                           \
+/* end of macro */
+
+/**
+ * @def     LIBDS_DEF_STACK_BULK_OPS
+ * @brief   Generates the bulk stack operations on top of any engine.
+ *
+ * The engine must provide `push_front_n` and `pop_front_n`, with the same
+ * contracts as the ones declared in impl/nodechain.h.
+ */
+#define LIBDS_DEF_STACK_BULK_OPS(Type, StackType, Prefix, Engine)               \
+    static inline enum ds_error                                                 \
+    Prefix##_push_n(StackType stack, Type const *values, const size_t count)    \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            Engine##_push_front_n(stack._nodes, values, count, sizeof(Type),    \
+                stack.copy, stack.destroy)                                      \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static inline enum ds_error                                                 \
+    Prefix##_pop_n(StackType stack, Type *out, const size_t count,              \
+        size_t *popped)                                                         \
+    {                                                                           \
+        return LIBDS_CHECK(                                                     \
+            Engine##_pop_front_n(stack._nodes, out, count, sizeof(Type),        \
+                stack.destroy, popped)                                          \
+        );                                                                      \
+    }                                                                           \
+/* end of macro */
+
 /**
  * @def LIBDS_DEF_STACK
  * @brief   Generate a complete type-safe stack container interface
@@ -93,6 +181,10 @@
  * **Stack Operations:**
  * - `push(StackType, Type)` - Push element to top of stack O(1)
  * - `pop(StackType, Type*)` - Pop element from top with ownership transfer O(1)
+ * - `push_n(StackType, Type const*, size_t)` - Push an array, the last element
+ * ending on top, all or nothing, with a single pool allocation O(count)
+ * - `pop_n(StackType, Type*, size_t, size_t*)` - Pop up to `count` elements
+ * into an array, top first, reporting how many were popped O(count)
  *
  * **Access (Common):**
  * - `get_front(StackType, Type*)` - Peek the top element O(1)
@@ -110,51 +202,73 @@
 #define LIBDS_DEF_STACK(Type, StackType, Prefix, CopyFunc, DestroyFunc)         \
                                                                                 \
     LIBDS_DEF_CONTAINER(Type, StackType, Prefix, CopyFunc, DestroyFunc)         \
+    LIBDS_DEF_STACK_OPS(Type, StackType, Prefix, ds_nc)                         \
+    LIBDS_DEF_STACK_BULK_OPS(Type, StackType, Prefix, ds_nc)                    \
+/* end of macro */
+
+/**
+ * @def LIBDS_DEF_SEGMENTED_STACK
+ * @brief   Generate a type-safe stack container backed by a segmented array
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   StackType   Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for bitwise assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * Generates the same functions as @ref LIBDS_DEF_STACK, but elements are stored
+ * back to back in a directory of contiguous segments (see impl/segmentedstack.h).
+ * Consecutive pushes land on consecutive addresses and carry no link pointer.
+ * Segments never move on growth, so pointers to the stored elements stay valid
+ * while the elements remain in the stack.
+ *
+ * @par Additional Functions (All prefixed with `Prefix_`)
+ * - `reserve(StackType, size_t)` - Pre-size the stack for the given total
+ * number of elements, so that pushes below it never allocate
+ * - `capacity(StackType)` - Elements that fit without growing O(1)
+ *
+ * @par Complexity Differences
+ * - `push` - O(1) amortized, a new segment doubles the capacity when full
+ * - `get_at` - O(log N)
+ * - `bytes` - O(1)
+ *
+ * @par Example: Pre-sized Stack
+ * @code
+ *  #include <libds/stackdef.h>
+ *
+ *  LIBDS_DEF_SEGMENTED_STACK(int, SegStackInt, ssi, NULL, NULL)
+ *
+ *  int main()
+ *  {
+ *      SegStackInt stack = ssi_create();
+ *      ssi_reserve(stack, 4096);
+ *
+ *      for (int i = 0; i < 4096; i++)
+ *          ssi_push(stack, i); // never allocates
+ *
+ *      ssi_delete(&stack);
+ *      return 0;
+ *  }
+ * @endcode
+ */
+#define LIBDS_DEF_SEGMENTED_STACK(Type, StackType, Prefix, CopyFunc, DestroyFunc) \
+                                                                                \
+    LIBDS_DEF_CONTAINER_BASE(Type, StackType, Prefix, CopyFunc, DestroyFunc,    \
+        ds_ss, ds_segmented_stack)                                              \
+    LIBDS_DEF_STACK_OPS(Type, StackType, Prefix, ds_ss)                         \
+    LIBDS_DEF_STACK_BULK_OPS(Type, StackType, Prefix, ds_ss)                    \
                                                                                 \
     static inline enum ds_error                                                 \
-    Prefix##_push(StackType stack, Type value)                                  \
+    Prefix##_reserve(StackType stack, const size_t capacity)                    \
     {                                                                           \
-        void *data = NULL;                                                      \
-        enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_push_front(stack._nodes, &data)                               \
+        return LIBDS_CHECK(                                                     \
+            ds_ss_reserve(stack._nodes, capacity)                               \
         );                                                                      \
-        if (error) return error;                                                \
-                                                                                \
-        if (!stack.copy)                                                        \
-            *((Type *)data) = value;                                            \
-        else                                                                    \
-        {                                                                       \
-            if ( !stack.copy(data, &value) )                                    \
-            {                                                                   \
-                ds_nc_pop_front(stack._nodes, NULL, NULL);                      \
-                                                                                \
-                LIBDS_HANDLE_ERR(                                               \
-                    DS_ERR_COPY_FAILED,                                         \
-                    LIBDS_STRINGIFY(stack.copy(data, &value)),                  \
-                    __FILE__, __LINE__, __func__                                \
-                );                                                              \
-                return DS_ERR_COPY_FAILED;                                      \
-            }                                                                   \
-        }                                                                       \
-        return DS_ERR_NONE;                                                     \
     }                                                                           \
                                                                                 \
-    static inline enum ds_error                                                 \
-    Prefix##_pop(StackType stack, Type *out)                                    \
+    static inline size_t                                                        \
+    Prefix##_capacity(const StackType stack)                                    \
     {                                                                           \
-        void *data = NULL;                                                      \
-        enum ds_error error = LIBDS_CHECK(                                      \
-            ds_nc_pop_front(stack._nodes, &data, stack.destroy)                 \
-        );                                                                      \
-        if (error) return error;                                                \
-                                                                                \
-        if (!out && stack.destroy)                                              \
-            stack.destroy(data);                                                \
-                                                                                \
-        else if (out)                                                           \
-            *out = *((Type *)data);                                             \
-                                                                                \
-        return DS_ERR_NONE;                                                     \
+        return ds_ss_capacity(stack._nodes);                                    \
     }                                                                           \
 /* end of macro */
 
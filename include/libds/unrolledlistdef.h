@@ -0,0 +1,96 @@
+/**
+ * @file    unrolledlistdef.h
+ * @brief   Type-safe unrolled list generator macro.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ *
+ * This module provides a list implementation through the
+ * @ref LIBDS_DEF_UNROLLED_LIST macro. It generates exactly the same `Prefix_`
+ * API as @ref LIBDS_DEF_LIST, but runs on the unrolled engine, which stores
+ * several elements per node (see impl/unrolledchain.h).
+ *
+ * Key features:
+ * - Drop-in replacement for lists generated by @ref LIBDS_DEF_LIST
+ * - Up to K elements per node, each node spanning @ref LIBDS_UC_NODE_BYTES
+ * - One pointer chase per K elements on traversals and indexed access
+ * - No per-element `next` pointer, which favours small types like `int`
+ *
+ * @note Requires C11 or later due to _Alignof() usage
+ * @warning This implementation does NOT PROVIDE THREAD-SAFETY.
+ * @warning Direct manipulation of the `_nodes` member causes undefined behavior.
+ *
+ * @see listdef.h, core.h, impl/unrolledchain.h
+ */
+
+#ifndef LIBDS_UNROLLEDLISTDEF_H
+#define LIBDS_UNROLLEDLISTDEF_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "core.h"
+#include "impl/unrolledchain.h"
+#include "impl/contdef.h"
+#include "listdef.h"
+
+/**
+ * @defgroup UnrolledList Unrolled List Container
+ * @brief   List storing K elements per node, with O(N / K) indexed access
+ * @{
+ */
+
+/**
+ * @def LIBDS_DEF_UNROLLED_LIST
+ * @brief   Generate a type-safe list container backed by the unrolled engine
+ * @param   Type        The data type to store (must be a complete type)
+ * @param   ListType    Name of the generated container structure
+ * @param   Prefix      Function prefix for all generated operations
+ * @param   CopyFunc    Copy function (ds_copier_fn) or NULL for bitwise assignment
+ * @param   DestroyFunc Destroy function (ds_destructor_fn) or NULL for no cleanup
+ *
+ * The generated functions are the same as the ones of @ref LIBDS_DEF_LIST, so
+ * switching a list over only requires changing the generator macro.
+ *
+ * @par Complexity Differences
+ * - `get_at`, `set_at` - O(N / K)
+ * - `push_at`, `pop_at`, `drop_at` - O(N / K + K)
+ * - `push_front`, `pop_front`, `drop_front` - O(K), shift inside the first node
+ * - `pop_back`, `drop_back` - O(1), unless the last node becomes empty
+ *
+ * @par Example
+ * @code
+ *  #include <libds/unrolledlistdef.h>
+ *
+ *  LIBDS_DEF_UNROLLED_LIST(int, UListInt, uli, NULL, NULL)
+ *
+ *  int main()
+ *  {
+ *      UListInt list = uli_create();
+ *
+ *      for (int i = 0; i < 1000; i++)
+ *          uli_push_back(list, i);
+ *
+ *      int value;
+ *      uli_get_at(list, 500, &value); // skips whole nodes
+ *
+ *      uli_delete(&list);
+ *      return 0;
+ *  }
+ * @endcode
+ *
+ * @warning Pointers into the payload are never exposed by the generated API,
+ * but custom copy functions must not keep the `dst` address, since elements
+ * move inside their node on insertions and removals.
+ */
+#define LIBDS_DEF_UNROLLED_LIST(Type, ListType, Prefix, CopyFunc, DestroyFunc)  \
+                                                                                \
+    LIBDS_DEF_CONTAINER_BASE(Type, ListType, Prefix, CopyFunc, DestroyFunc,     \
+        ds_uc, ds_unrolled_chain)                                               \
+    LIBDS_DEF_LIST_OPS(Type, ListType, Prefix, ds_uc)                           \
+/* end of macro */
+
+/** @} */ //end of UnrolledList group
+
+#endif //LIBDS_UNROLLEDLISTDEF_H
@@ -0,0 +1,77 @@
+/**
+ * @file    allocator.c
+ * @brief   Default allocator shared by the engines.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+
+#include "libds/core.h"
+
+#include "internal/allocator.h"
+
+static void *
+system_alloc(void *context, const size_t size)
+{
+    (void) context;
+    return malloc(size);
+}
+
+static void *
+system_realloc(void *context, void *ptr, const size_t old_size, const size_t new_size)
+{
+    (void) context;
+    (void) old_size;
+    return realloc(ptr, new_size);
+}
+
+static void
+system_free(void *context, void *ptr, const size_t size)
+{
+    (void) context;
+    (void) size;
+    free(ptr);
+}
+
+const struct ds_allocator system_allocator = {
+    .alloc   = system_alloc,
+    .realloc = system_realloc,
+    .free    = system_free,
+    .context = NULL
+};
+
+static struct ds_allocator default_allocator = {
+    .alloc   = system_alloc,
+    .realloc = system_realloc,
+    .free    = system_free,
+    .context = NULL
+};
+
+
+//==============================================================================
+// Default Allocator
+//==============================================================================
+
+enum ds_error
+ds_set_allocator(const struct ds_allocator *allocator)
+{
+    if (!allocator)
+    {
+        default_allocator = system_allocator;
+        return DS_ERR_NONE;
+    }
+
+    if (!allocator->alloc || !allocator->free) return DS_ERR_NULL_POINTER;
+
+    default_allocator = *allocator;
+    return DS_ERR_NONE;
+}
+
+const struct ds_allocator *
+ds_get_allocator(void)
+{
+    return &default_allocator;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file    atomicpool.c
+ * @brief   Lock-free slot pool backing the concurrent engines.
+ *
+ * Free slots form a Treiber stack threaded through `free_next`, whose top is
+ * a tagged index: every successful push or pop advances the tag, so a thread
+ * that read a stale top fails its compare-and-swap even if the same index
+ * was popped and pushed back meanwhile (ABA).
+ *
+ * When the free list is empty, fresh slots are carved from a bump counter.
+ * The chunk holding the next fresh slot is allocated before the counter is
+ * advanced, and published with a compare-and-swap: racing threads may each
+ * allocate it, but only one copy is kept.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "libds/core.h"
+
+#include "internal/utils.h"
+#include "internal/node.h"
+#include "internal/atomicpool.h"
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+/**
+ * @brief   Makes sure the chunk holding the 1-based slot @p index is published.
+ */
+static bool
+ensure_chunk(AtomicPool *pool, const uint64_t index)
+{
+    const unsigned k = floor_log2(((index - 1) >> APOOL_BASE_SHIFT) + 1);
+
+    if (atomic_load_explicit(&pool->chunks[k], memory_order_acquire)) return true;
+
+    const size_t slots = (size_t) 1 << (APOOL_BASE_SHIFT + k);
+
+    // integer overflow check
+    if (slots > SIZE_MAX / pool->stride) return false;
+
+    byte *chunk = (byte *) malloc(slots * pool->stride);
+    if (!chunk) return false;
+
+    byte *expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&pool->chunks[k], &expected, chunk,
+            memory_order_acq_rel, memory_order_acquire))
+    {
+        // another thread published it first
+        free(chunk);
+        return true;
+    }
+
+    atomic_fetch_add_explicit(&pool->chunk_bytes, slots * pool->stride, memory_order_relaxed);
+    return true;
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+bool
+apool_init(AtomicPool *pool, const size_t value_size, const size_t value_align)
+{
+    size_t offset, stride;
+    if (!node_layout(value_size, value_align, sizeof(AtomicSlot), alignof(AtomicSlot), &offset, &stride))
+        return false;
+
+    for (size_t k = 0; k < APOOL_MAX_CHUNKS; k++)
+        atomic_init(&pool->chunks[k], NULL);
+
+    atomic_init(&pool->free_head, 0);
+    atomic_init(&pool->bump, 1);
+    atomic_init(&pool->chunk_bytes, 0);
+
+    pool->offset = offset;
+    pool->stride = stride;
+    return true;
+}
+
+void
+apool_destroy(AtomicPool *pool)
+{
+    for (size_t k = 0; k < APOOL_MAX_CHUNKS; k++)
+    {
+        free(atomic_load_explicit(&pool->chunks[k], memory_order_relaxed));
+        atomic_store_explicit(&pool->chunks[k], NULL, memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&pool->free_head, 0, memory_order_relaxed);
+    atomic_store_explicit(&pool->bump, 1, memory_order_relaxed);
+    atomic_store_explicit(&pool->chunk_bytes, 0, memory_order_relaxed);
+}
+
+
+//==============================================================================
+// Acquire / Release
+//==============================================================================
+
+uint32_t
+apool_acquire(AtomicPool *pool)
+{
+    uint64_t head = atomic_load_explicit(&pool->free_head, memory_order_acquire);
+    while (tag_index(head))
+    {
+        // `free_next` may be stale if the slot was taken meanwhile, the tag catches it
+        const uint32_t next = atomic_load_explicit(
+            &apool_slot(pool, tag_index(head))->free_next, memory_order_relaxed);
+
+        if (atomic_compare_exchange_weak_explicit(&pool->free_head, &head, tagged(tag_next(head), next),
+                memory_order_acquire, memory_order_acquire))
+            return tag_index(head);
+    }
+
+    // free list empty: carve a fresh slot
+    uint64_t index = atomic_load_explicit(&pool->bump, memory_order_relaxed);
+    do
+    {
+        if (index > APOOL_MAX_INDEX) return 0;
+        if (!ensure_chunk(pool, index)) return 0;
+    }
+    while (!atomic_compare_exchange_weak_explicit(&pool->bump, &index, index + 1,
+               memory_order_relaxed, memory_order_relaxed));
+
+    return (uint32_t) index;
+}
+
+void
+apool_release(AtomicPool *pool, const uint32_t index)
+{
+    AtomicSlot *slot = apool_slot(pool, index);
+
+    uint64_t head = atomic_load_explicit(&pool->free_head, memory_order_relaxed);
+    do
+        atomic_store_explicit(&slot->free_next, tag_index(head), memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&pool->free_head, &head, tagged(tag_next(head), index),
+               memory_order_release, memory_order_relaxed));
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+apool_bytes(AtomicPool *pool)
+{
+    return atomic_load_explicit(&pool->chunk_bytes, memory_order_relaxed);
+}
@@ -0,0 +1,247 @@
+/**
+ * @file    concurrentqueue.c
+ * @brief   Core implementation of the lock-free MPMC queue engine.
+ *
+ * Michael–Scott queue over the slots of an atomic pool. The head always points
+ * at a dummy node whose successor is the front element; dequeuing copies that
+ * element out, swings the head to it (making it the new dummy) and recycles
+ * the old dummy. The tail may lag one node behind, and any thread noticing
+ * it helps by swinging it forward.
+ *
+ * `head`, `tail` and every node `link` are tagged indices (see atomicpool.h):
+ * the tag changes on every update, so a recycled node cannot make a stale
+ * compare-and-swap succeed.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "libds/core.h"
+#include "libds/impl/concurrentqueue.h"
+
+#include "internal/utils.h"
+#include "internal/atomicpool.h"
+
+/**
+ * @struct  ds_concurrent_queue
+ * @brief   State controller for the lock-free queue engine.
+ *
+ * Producers and consumers hammer different fields, so each hot one sits on
+ * its own cache line.
+ */
+struct ds_concurrent_queue
+{
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic uint64_t head;      /**< Tagged index of the dummy node */
+
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic uint64_t tail;      /**< Tagged index of the last node (or its predecessor) */
+
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic size_t length;      /**< Total count of stored elements */
+
+    AtomicPool pool;            /**< Recycling pool of the nodes */
+    size_t value_size;          /**< Size of a single element */
+};
+typedef struct ds_concurrent_queue ConcurrentQueue;
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+static inline _Atomic uint64_t *
+link_of(ConcurrentQueue *queue, const uint32_t index)
+{
+    return &apool_slot(&queue->pool, index)->link;
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+ConcurrentQueue *
+ds_cq_alloc(const size_t value_size, const size_t value_align)
+{
+    // the cache line alignment exceeds what malloc guarantees
+    ConcurrentQueue *queue = (ConcurrentQueue *) aligned_alloc(alignof(ConcurrentQueue),
+        align_value(sizeof(ConcurrentQueue), alignof(ConcurrentQueue)));
+    if (!queue) return NULL;
+
+    if (!apool_init(&queue->pool, value_size, value_align))
+    {
+        free(queue);
+        return NULL;
+    }
+
+    const uint32_t dummy = apool_acquire(&queue->pool);
+    if (!dummy)
+    {
+        apool_destroy(&queue->pool);
+        free(queue);
+        return NULL;
+    }
+    atomic_init(link_of(queue, dummy), 0);
+
+    atomic_init(&queue->head, tagged(0, dummy));
+    atomic_init(&queue->tail, tagged(0, dummy));
+    atomic_init(&queue->length, 0);
+    queue->value_size = value_size;
+
+    return queue;
+}
+
+enum ds_error
+ds_cq_free(ConcurrentQueue **queue_ref, const ds_destructor_fn destroy)
+{
+    if (!queue_ref || !*queue_ref) return DS_ERR_NULL_POINTER;
+
+    ConcurrentQueue *queue = *queue_ref;
+
+    if (destroy)
+    {
+        const uint64_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        uint32_t index = tag_index(atomic_load_explicit(link_of(queue, tag_index(head)), memory_order_acquire));
+
+        for (; index; index = tag_index(atomic_load_explicit(link_of(queue, index), memory_order_acquire)))
+            destroy(apool_data(&queue->pool, index));
+    }
+
+    apool_destroy(&queue->pool);
+    free(queue);
+
+    *queue_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_cq_length(const ConcurrentQueue *queue)
+{
+    return queue ? atomic_load_explicit(&queue->length, memory_order_relaxed) : 0;
+}
+
+size_t
+ds_cq_bytes(const ConcurrentQueue *queue)
+{
+    if (!queue) return 0;
+    return sizeof(ConcurrentQueue) + apool_bytes((AtomicPool *) &queue->pool);
+}
+
+bool
+ds_cq_is_empty(const ConcurrentQueue *queue)
+{
+    return ds_cq_length(queue) == 0;
+}
+
+
+//==============================================================================
+// Enqueue / Dequeue Value
+//==============================================================================
+
+enum ds_error
+ds_cq_enqueue(ConcurrentQueue *queue, const void *value, const ds_copier_fn copy)
+{
+    if (!queue || !value) return DS_ERR_NULL_POINTER;
+
+    const uint32_t node = apool_acquire(&queue->pool);
+    if (!node) return DS_ERR_ALLOCATION_FAILED;
+
+    void *data = apool_data(&queue->pool, node);
+    if (!copy)
+        memcpy(data, value, queue->value_size);
+
+    else if (!copy(data, value))
+    {
+        apool_release(&queue->pool, node);
+        return DS_ERR_COPY_FAILED;
+    }
+
+    // counted before it is published, so concurrent dequeues never underflow the length
+    atomic_fetch_add_explicit(&queue->length, 1, memory_order_relaxed);
+
+    // terminate the node, keeping its link tag moving
+    _Atomic uint64_t *node_link = link_of(queue, node);
+    atomic_store_explicit(node_link,
+        tagged(tag_next(atomic_load_explicit(node_link, memory_order_relaxed)), 0), memory_order_relaxed);
+
+    for (;;)
+    {
+        uint64_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        uint64_t next = atomic_load_explicit(link_of(queue, tag_index(tail)), memory_order_acquire);
+
+        if (tail != atomic_load_explicit(&queue->tail, memory_order_acquire)) continue;
+
+        if (tag_index(next))
+        {
+            // the tail is lagging: help the other producer before retrying
+            atomic_compare_exchange_strong_explicit(&queue->tail, &tail,
+                tagged(tag_next(tail), tag_index(next)), memory_order_release, memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(link_of(queue, tag_index(tail)), &next,
+                tagged(tag_next(next), node), memory_order_release, memory_order_relaxed))
+        {
+            // linked: swinging the tail may fail if someone already helped
+            atomic_compare_exchange_strong_explicit(&queue->tail, &tail,
+                tagged(tag_next(tail), node), memory_order_release, memory_order_relaxed);
+            break;
+        }
+    }
+
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_cq_dequeue(ConcurrentQueue *queue, void *out)
+{
+    if (!queue || !out) return DS_ERR_NULL_POINTER;
+
+    uint64_t head;
+    for (;;)
+    {
+        head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        uint64_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        const uint64_t next = atomic_load_explicit(link_of(queue, tag_index(head)), memory_order_acquire);
+
+        if (head != atomic_load_explicit(&queue->head, memory_order_acquire)) continue;
+
+        if (!tag_index(next)) return DS_ERR_EMPTY_STRUCTURE;
+
+        if (tag_index(head) == tag_index(tail))
+        {
+            // non-empty but the tail is lagging on the dummy: help it forward
+            atomic_compare_exchange_strong_explicit(&queue->tail, &tail,
+                tagged(tag_next(tail), tag_index(next)), memory_order_release, memory_order_relaxed);
+            continue;
+        }
+
+        // read before unlinking: once the head moves, another consumer may recycle the node.
+        // A copy racing with such a recycle is discarded, as the head tag will have moved.
+        memcpy(out, apool_data(&queue->pool, tag_index(next)), queue->value_size);
+
+        if (atomic_compare_exchange_weak_explicit(&queue->head, &head,
+                tagged(tag_next(head), tag_index(next)), memory_order_acq_rel, memory_order_relaxed))
+            break;
+    }
+
+    // the old dummy is unreachable now, its successor is the new dummy
+    apool_release(&queue->pool, tag_index(head));
+
+    atomic_fetch_sub_explicit(&queue->length, 1, memory_order_relaxed);
+    return DS_ERR_NONE;
+}
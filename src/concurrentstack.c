@@ -0,0 +1,257 @@
+/**
+ * @file    concurrentstack.c
+ * @brief   Core implementation of the lock-free stack engine.
+ *
+ * Treiber stack over the slots of an atomic pool. `top` is a tagged index
+ * (see atomicpool.h) and every node `link` holds the index of the node below
+ * it. A pop reads the link and the payload of the top node before swapping
+ * it out: if the node was popped (and maybe recycled) meanwhile, the tag of
+ * `top` moved and the swap fails, discarding what was read.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "libds/core.h"
+#include "libds/impl/concurrentstack.h"
+
+#include "internal/utils.h"
+#include "internal/atomicpool.h"
+
+/**
+ * @struct  ds_concurrent_stack
+ * @brief   State controller for the lock-free stack engine.
+ */
+struct ds_concurrent_stack
+{
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic uint64_t top;       /**< Tagged index of the top node (0 if empty) */
+
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic size_t length;      /**< Total count of stored elements */
+
+    AtomicPool pool;            /**< Recycling pool of the nodes */
+    size_t value_size;          /**< Size of a single element */
+};
+typedef struct ds_concurrent_stack ConcurrentStack;
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+static inline _Atomic uint64_t *
+link_of(ConcurrentStack *stack, const uint32_t index)
+{
+    return &apool_slot(&stack->pool, index)->link;
+}
+
+static inline uint32_t
+next_of(ConcurrentStack *stack, const uint32_t index)
+{
+    return tag_index(atomic_load_explicit(link_of(stack, index), memory_order_relaxed));
+}
+
+/**
+ * @brief   Pushes the private chain [first, last] on top of the stack at once.
+ */
+static void
+push_chain(ConcurrentStack *stack, const uint32_t first, const uint32_t last)
+{
+    uint64_t top = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    do
+        atomic_store_explicit(link_of(stack, last), tag_index(top), memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&stack->top, &top, tagged(tag_next(top), first),
+               memory_order_release, memory_order_relaxed));
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+ConcurrentStack *
+ds_cs_alloc(const size_t value_size, const size_t value_align)
+{
+    // the cache line alignment exceeds what malloc guarantees
+    ConcurrentStack *stack = (ConcurrentStack *) aligned_alloc(alignof(ConcurrentStack),
+        align_value(sizeof(ConcurrentStack), alignof(ConcurrentStack)));
+    if (!stack) return NULL;
+
+    if (!apool_init(&stack->pool, value_size, value_align))
+    {
+        free(stack);
+        return NULL;
+    }
+
+    atomic_init(&stack->top, 0);
+    atomic_init(&stack->length, 0);
+    stack->value_size = value_size;
+
+    return stack;
+}
+
+enum ds_error
+ds_cs_free(ConcurrentStack **stack_ref, const ds_destructor_fn destroy)
+{
+    if (!stack_ref || !*stack_ref) return DS_ERR_NULL_POINTER;
+
+    ConcurrentStack *stack = *stack_ref;
+
+    if (destroy)
+    {
+        uint32_t index = tag_index(atomic_load_explicit(&stack->top, memory_order_acquire));
+        for (; index; index = next_of(stack, index))
+            destroy(apool_data(&stack->pool, index));
+    }
+
+    apool_destroy(&stack->pool);
+    free(stack);
+
+    *stack_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_cs_length(const ConcurrentStack *stack)
+{
+    return stack ? atomic_load_explicit(&stack->length, memory_order_relaxed) : 0;
+}
+
+size_t
+ds_cs_bytes(const ConcurrentStack *stack)
+{
+    if (!stack) return 0;
+    return sizeof(ConcurrentStack) + apool_bytes((AtomicPool *) &stack->pool);
+}
+
+bool
+ds_cs_is_empty(const ConcurrentStack *stack)
+{
+    return ds_cs_length(stack) == 0;
+}
+
+
+//==============================================================================
+// Push / Pop Value
+//==============================================================================
+
+enum ds_error
+ds_cs_push(ConcurrentStack *stack, const void *value, const ds_copier_fn copy)
+{
+    if (!stack || !value) return DS_ERR_NULL_POINTER;
+
+    const uint32_t node = apool_acquire(&stack->pool);
+    if (!node) return DS_ERR_ALLOCATION_FAILED;
+
+    void *data = apool_data(&stack->pool, node);
+    if (!copy)
+        memcpy(data, value, stack->value_size);
+
+    else if (!copy(data, value))
+    {
+        apool_release(&stack->pool, node);
+        return DS_ERR_COPY_FAILED;
+    }
+
+    // counted before it is published, so concurrent pops never underflow the length
+    atomic_fetch_add_explicit(&stack->length, 1, memory_order_relaxed);
+
+    push_chain(stack, node, node);
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_cs_pop(ConcurrentStack *stack, void *out)
+{
+    if (!stack || !out) return DS_ERR_NULL_POINTER;
+
+    uint64_t top = atomic_load_explicit(&stack->top, memory_order_acquire);
+    for (;;)
+    {
+        if (!tag_index(top)) return DS_ERR_EMPTY_STRUCTURE;
+
+        // both reads may be stale if the node was taken meanwhile, the tag catches it
+        const uint32_t next = next_of(stack, tag_index(top));
+        memcpy(out, apool_data(&stack->pool, tag_index(top)), stack->value_size);
+
+        if (atomic_compare_exchange_weak_explicit(&stack->top, &top, tagged(tag_next(top), next),
+                memory_order_acquire, memory_order_acquire))
+            break;
+    }
+
+    apool_release(&stack->pool, tag_index(top));
+
+    atomic_fetch_sub_explicit(&stack->length, 1, memory_order_relaxed);
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_cs_pop_all(ConcurrentStack *stack, void **out, size_t *count, const ds_destructor_fn destroy)
+{
+    if (count) *count = 0;
+    if (out) *out = NULL;
+    if (!stack) return DS_ERR_NULL_POINTER;
+
+    // detach the whole chain; a CAS rather than a blind exchange keeps the tag moving
+    uint64_t top = atomic_load_explicit(&stack->top, memory_order_acquire);
+    do
+        if (!tag_index(top)) return DS_ERR_EMPTY_STRUCTURE;
+    while (!atomic_compare_exchange_weak_explicit(&stack->top, &top, tagged(tag_next(top), 0),
+               memory_order_acquire, memory_order_acquire));
+
+    // the chain is private now
+    const uint32_t first = tag_index(top);
+    uint32_t last = first;
+    size_t total = 1;
+    for (uint32_t index = next_of(stack, first); index; index = next_of(stack, index), total++)
+        last = index;
+
+    byte *values = NULL;
+    if (out)
+    {
+        values = (total > SIZE_MAX / stack->value_size) ? NULL : (byte *) malloc(total * stack->value_size);
+        if (!values)
+        {
+            push_chain(stack, first, last);
+            return DS_ERR_ALLOCATION_FAILED;
+        }
+    }
+
+    byte *dst = values;
+    for (uint32_t index = first; index;)
+    {
+        void *data = apool_data(&stack->pool, index);
+        const uint32_t next = next_of(stack, index);
+
+        if (values)
+        {
+            memcpy(dst, data, stack->value_size);
+            dst += stack->value_size;
+        }
+        else if (destroy)
+            destroy(data);
+
+        apool_release(&stack->pool, index);
+        index = next;
+    }
+
+    atomic_fetch_sub_explicit(&stack->length, total, memory_order_relaxed);
+
+    if (out) *out = values;
+    if (count) *count = total;
+    return DS_ERR_NONE;
+}
@@ -52,6 +52,18 @@ ds_err_to_string(const enum ds_error err)
             return "Error: Custom copy operation failed - the provided copier "
                    "\nfunction returned false, indicating copy could not complete";
 
+        case DS_ERR_FULL_STRUCTURE:
+            return "Error: Fixed capacity reached - cannot insert into a full "
+                   "\nstructure, remove elements first or use a growable one";
+
+        case DS_ERR_STALE_CURSOR:
+            return "Error: Stale cursor - the list was snapshotted or rebuilt since "
+                   "\nthe cursor was placed, place it again from the start of the list";
+
+        case DS_ERR_UNSUPPORTED:
+            return "Error: Unsupported operation - the structure cannot perform it "
+                   "\nin its current state, nothing was changed";
+
         default:
             return "Unknown error: Unrecognized error code";
     }
@@ -0,0 +1,75 @@
+/**
+ * @file    allocator.h
+ * @brief   Internal helpers to call a @ref ds_allocator.
+ *
+ * @warning This is an internal header and should not be used outside the
+ * library implementation.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_INTERNAL_ALLOCATOR_H
+#define LIBDS_INTERNAL_ALLOCATOR_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include "libds/core.h"
+#include "utils.h"
+
+/**
+ * @var     system_allocator
+ * @brief   Allocator wrapping malloc, realloc and free.
+ */
+extern const struct ds_allocator system_allocator;
+
+/**
+ * @brief   Rounds a request up to what @p allocator would reserve anyway.
+ */
+static inline size_t
+mem_good_size(const struct ds_allocator *allocator, const size_t size)
+{
+    return allocator->good_size ? max(size, allocator->good_size(allocator->context, size)) : size;
+}
+
+/**
+ * @brief   Allocates @p size bytes with @p allocator.
+ */
+static inline void *
+mem_alloc(const struct ds_allocator *allocator, const size_t size)
+{
+    return allocator->alloc(allocator->context, size);
+}
+
+/**
+ * @brief   Releases a block of @p size bytes, no-op if @p ptr is NULL.
+ */
+static inline void
+mem_free(const struct ds_allocator *allocator, void *ptr, const size_t size)
+{
+    if (ptr) allocator->free(allocator->context, ptr, size);
+}
+
+/**
+ * @brief   Resizes a block, emulated with alloc/copy/free if `realloc` is missing.
+ *
+ * @return  The resized block, or NULL on failure (@p ptr is then untouched).
+ */
+static inline void *
+mem_realloc(const struct ds_allocator *allocator, void *ptr, const size_t old_size, const size_t new_size)
+{
+    if (!ptr) return mem_alloc(allocator, new_size);
+
+    if (allocator->realloc)
+        return allocator->realloc(allocator->context, ptr, old_size, new_size);
+
+    void *new_ptr = mem_alloc(allocator, new_size);
+    if (!new_ptr) return NULL;
+
+    memcpy(new_ptr, ptr, min(old_size, new_size));
+    mem_free(allocator, ptr, old_size);
+    return new_ptr;
+}
+
+#endif //LIBDS_INTERNAL_ALLOCATOR_H
@@ -0,0 +1,205 @@
+/**
+ * @file    atomicpool.h
+ * @brief   Internal lock-free node pool shared by the concurrent engines.
+ *
+ * The pool hands out fixed-size slots laid out like the node chain ones
+ * (see node_layout()), but addresses them with 32-bit indices instead of
+ * pointers. An index packed with a 32-bit tag fits a single 64-bit atomic,
+ * which is what lets the free list and the concurrent engines detect ABA
+ * with a plain compare-and-swap.
+ *
+ * Slots live in a fixed directory of chunks whose sizes double, so chunks
+ * never move and are only released with the pool itself: a slot may be read
+ * by a thread that lost a race for it, but it is never unmapped under it.
+ *
+ * @warning This is an internal header and should not be used outside the
+ * library implementation.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_INTERNAL_ATOMICPOOL_H
+#define LIBDS_INTERNAL_ATOMICPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "libds/core.h"
+#include "utils.h"
+
+/**
+ * @def     APOOL_BASE_SHIFT
+ * @brief   log2 of the number of slots in the first chunk.
+ */
+#define APOOL_BASE_SHIFT 6
+
+/**
+ * @def     APOOL_MAX_CHUNKS
+ * @brief   Size of the chunk directory, chunk `k` holding `64 << k` slots.
+ *
+ * 26 chunks cover the whole 32-bit index space.
+ */
+#define APOOL_MAX_CHUNKS 26
+
+/**
+ * @def     APOOL_MAX_INDEX
+ * @brief   Largest slot index, 0 being reserved as the null index.
+ */
+#define APOOL_MAX_INDEX ((((uint64_t) 1 << APOOL_MAX_CHUNKS) - 1) << APOOL_BASE_SHIFT)
+
+
+/**
+ * @brief   Packs a slot index with an ABA tag.
+ */
+static inline uint64_t
+tagged(const uint64_t tag, const uint32_t index)
+{
+    return (tag << 32) | index;
+}
+
+/**
+ * @brief   Index part of a tagged value (0 is the null index).
+ */
+static inline uint32_t
+tag_index(const uint64_t value)
+{
+    return (uint32_t) value;
+}
+
+/**
+ * @brief   Tag part of a tagged value, advanced by one.
+ */
+static inline uint64_t
+tag_next(const uint64_t value)
+{
+    return (value >> 32) + 1;
+}
+
+
+/**
+ * @struct  atomic_slot
+ * @brief   Header preceding every payload of the pool.
+ */
+struct atomic_slot
+{
+    _Atomic uint64_t link;          /**< Tagged link owned by the engine using the slot */
+    _Atomic uint32_t free_next;     /**< Next free slot while in the free list */
+};
+typedef struct atomic_slot AtomicSlot;
+
+/**
+ * @struct  atomic_pool
+ * @brief   Lock-free pool of fixed-size slots.
+ */
+struct atomic_pool
+{
+    _Atomic(byte *) chunks[APOOL_MAX_CHUNKS];   /**< Chunk directory, filled in order */
+
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic uint64_t free_head;     /**< Tagged top of the free list */
+
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic uint64_t bump;          /**< Next slot index never handed out */
+    _Atomic size_t chunk_bytes;     /**< Total size of the published chunks */
+
+    size_t offset;                  /**< Byte offset from the slot header to the payload */
+    size_t stride;                  /**< Total size of a slot (Header + Padding + Data) */
+};
+typedef struct atomic_pool AtomicPool;
+
+
+/**
+ * @brief   Position of the most significant set bit of a non-zero value.
+ */
+static inline unsigned
+floor_log2(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - (unsigned) __builtin_clzll(value);
+#else
+    unsigned log = 0;
+    while (value >>= 1) log++;
+    return log;
+#endif
+}
+
+/**
+ * @brief   Retrieves the header of the slot at a non-null @p index.
+ *
+ * @note    The chunk holding @p index must have been published, which is
+ * always the case for indices obtained from apool_acquire() or read from a
+ * link published after it.
+ */
+static inline AtomicSlot *
+apool_slot(AtomicPool *pool, const uint32_t index)
+{
+    // chunk k holds the slots [64 * (2^k - 1), 64 * (2^(k+1) - 1)) of the 0-based space
+    const uint64_t position = (uint64_t) index - 1;
+    const unsigned k = floor_log2((position >> APOOL_BASE_SHIFT) + 1);
+    const uint64_t first = (((uint64_t) 1 << k) - 1) << APOOL_BASE_SHIFT;
+
+    byte *chunk = atomic_load_explicit(&pool->chunks[k], memory_order_acquire);
+    return (AtomicSlot *)(chunk + (size_t)(position - first) * pool->stride);
+}
+
+/**
+ * @brief   Retrieves the payload of the slot at a non-null @p index.
+ */
+static inline void *
+apool_data(AtomicPool *pool, const uint32_t index)
+{
+    return (byte *) apool_slot(pool, index) + pool->offset;
+}
+
+
+/**
+ * @brief   Initializes an empty pool for values of the given layout.
+ *
+ * @return  false if @p value_size / @p value_align are invalid.
+ *
+ * @details No chunk is allocated until the first acquire.
+ */
+bool
+apool_init(AtomicPool *pool, size_t value_size, size_t value_align);
+
+/**
+ * @brief   Frees every chunk of the pool.
+ *
+ * @warning Not thread-safe, no other thread may use the pool.
+ */
+void
+apool_destroy(AtomicPool *pool);
+
+/**
+ * @brief   Takes a slot from the free list, or carves a fresh one.
+ *
+ * @return  The slot index, or 0 on allocation failure.
+ *
+ * @par Complexity
+ * - Time:  O(1) amortized, lock-free
+ * - Space: O(1) amortized, chunks double the pool capacity
+ */
+uint32_t
+apool_acquire(AtomicPool *pool);
+
+/**
+ * @brief   Returns a slot to the free list.
+ *
+ * @par Complexity
+ * - Time:  O(1), lock-free
+ * - Space: O(1)
+ */
+void
+apool_release(AtomicPool *pool, uint32_t index);
+
+/**
+ * @brief   Total size of the chunks allocated by the pool.
+ */
+size_t
+apool_bytes(AtomicPool *pool);
+
+#endif //LIBDS_INTERNAL_ATOMICPOOL_H
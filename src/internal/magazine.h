@@ -0,0 +1,76 @@
+/**
+ * @file    magazine.h
+ * @brief   Internal per-thread magazine cache of node slots.
+ *
+ * Node slots of the same stride are interchangeable, whatever chain they
+ * come from, so cached chains share them per stride class. Each thread owns
+ * two magazines (small arrays of free slots) per class, and takes or returns
+ * slots without any synchronization. Only when both are empty (allocation)
+ * or full (release) does it trade a whole magazine with the class depot,
+ * which is guarded by a spinlock.
+ *
+ * Slots are carved from chunks owned by the depot, which live as long as the
+ * process. Magazines of an exiting thread are handed back to the depot.
+ *
+ * @warning This is an internal header and should not be used outside the
+ * library implementation.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#ifndef LIBDS_INTERNAL_MAGAZINE_H
+#define LIBDS_INTERNAL_MAGAZINE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "libds/core.h"
+#include "libds/impl/nodechain.h"
+#include "node.h"
+
+/**
+ * @def     MAG_MAX_STRIDE
+ * @brief   Largest slot stride served by the magazine cache.
+ *
+ * Chains with larger slots fall back to private chunks.
+ */
+#define MAG_MAX_STRIDE 512
+
+/**
+ * @brief   Checks whether slots of @p stride can be cached.
+ */
+bool
+mag_supports(size_t stride);
+
+/**
+ * @brief   Takes a free slot of @p stride for the calling thread.
+ *
+ * @return  Pointer to the slot, or NULL on allocation failure.
+ *
+ * @par Complexity
+ * - Time:  O(1), lock-free unless both thread magazines are empty
+ * - Space: O(1) amortized
+ */
+Node *
+mag_alloc(size_t stride);
+
+/**
+ * @brief   Returns a slot of @p stride taken with @ref mag_alloc.
+ *
+ * @note    The slot may be returned by any thread, not only the one that took it.
+ *
+ * @par Complexity
+ * - Time:  O(1), lock-free unless both thread magazines are full
+ * - Space: O(1) amortized
+ */
+void
+mag_free(size_t stride, Node *node);
+
+/**
+ * @brief   Reads the counters of the calling thread for the class of @p stride.
+ */
+void
+mag_stats(size_t stride, struct ds_cache_stats *out);
+
+#endif //LIBDS_INTERNAL_MAGAZINE_H
@@ -16,8 +16,14 @@
 #ifndef LIBDS_INTERNAL_NODE_H
 #define LIBDS_INTERNAL_NODE_H
 
+#include <stddef.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
 #include "libds/core.h"
 #include "utils.h"
+#include "allocator.h"
 
 #ifndef LIBDS_NC_MIN_BATCH_SIZE
 #define LIBDS_NC_MIN_BATCH_SIZE 8
@@ -27,6 +33,10 @@
 #define LIBDS_NC_GROWTH_FACTOR 0.5f
 #endif
 
+#ifndef LIBDS_NC_TRIM_RATIO
+#define LIBDS_NC_TRIM_RATIO 0.0f
+#endif
+
 /**
  * @var     MIN_BATCH_SIZE
  * @brief   Typed constant for the minimum batch capacity.
@@ -41,6 +51,13 @@ static const size_t MIN_BATCH_SIZE = (LIBDS_NC_MIN_BATCH_SIZE);
  */
 static const float GROWTH_FACTOR = (LIBDS_NC_GROWTH_FACTOR);
 
+/**
+ * @var     TRIM_RATIO
+ * @brief   Typed constant for the default automatic trimming threshold.
+ * @see     LIBDS_NC_TRIM_RATIO
+ */
+static const float TRIM_RATIO = (LIBDS_NC_TRIM_RATIO);
+
 /**
  * @struct  node
  * @brief   Intrusive memory header for singly-linked elements.
@@ -60,6 +77,24 @@ struct node
 typedef struct node Node;
 
 
+/**
+ * @struct  dnode
+ * @brief   Intrusive memory header for doubly-linked elements.
+ *
+ * Extends @ref node with a link to the previous active node. It is only used
+ * by chains allocated with @ref ds_nc_alloc_doubly, whose slots reserve room
+ * for the extra pointer before the padding and user data.
+ *
+ * @note The `prev` link is meaningless while the node rests in the node_stack.
+ */
+struct dnode
+{
+    struct node base;   /**< Singly-linked header, must be the first member */
+    struct node *prev;  /**< Pointer to the previous active node */
+};
+typedef struct dnode DNode;
+
+
 /**
  * @struct  chunk
  * @brief   Intrusive header for tracking allocated memory blocks.
@@ -80,16 +115,50 @@ typedef struct node Node;
  *          alignment guarantees for subsequent node placements, it occupies
  *          the same space of a slot.
  *
- * @warning The chunk does not store its size. Deallocation relies on tracking
- *          the head of the chunk list and freeing each block as a whole.
+ * @note    The chunk records its total size, so that sized allocators
+ *          (see @ref ds_allocator) get it back on deallocation. The header
+ *          always fits in the first slot, as a stride is at least two words.
+ *
+ * @note    Chains whose slots must start on a wider boundary (see
+ *          `slot_align`) get `slot_align - 1` extra bytes, and their first
+ *          slot is the first aligned address past the header slot.
  */
 struct chunk
 {
     struct chunk *next; /**< Pointer to the next allocated chunk */
+    size_t size;        /**< Total size of the chunk in bytes (header slot included) */
 };
 typedef struct chunk Chunk;
 
 
+/**
+ * @struct  ds_node_pool
+ * @brief   Recycling pool shared by several node chains.
+ *
+ * Holds the chunks and recycled slots that a private chain would keep for
+ * itself. Every attached chain, plus the creator, holds a reference, and the
+ * memory is returned to the OS once the last one is dropped. A snapshot that
+ * took the nodes of an attached chain over holds one too: released on another
+ * thread, it is queued in `released` instead of touching the pool, and the
+ * thread using the pool frees it later (see @ref pool_collect).
+ */
+struct ds_node_pool
+{
+    Chunk *chunk_head;  /**< Linked list of raw memory chunks */
+    Node *node_stack;   /**< Stack of recycled nodes ready for any attached chain */
+    size_t stack_size;  /**< Total count of available nodes resting in the node_stack */
+
+    size_t offset;      /**< Byte padding from the Node header to the user data */
+    size_t stride;      /**< Total physical size of a single slot */
+    size_t in_use;      /**< Count of slots held by the attached chains */
+    atomic_size_t refs; /**< Count of references (attached chains, snapshots and the creator) */
+    _Atomic(struct ds_nc_snapshot *) released; /**< Snapshots released since the last collection */
+
+    struct ds_allocator allocator; /**< Source of the chunks and of the pool itself */
+};
+typedef struct ds_node_pool NodePool;
+
+
 /**
  * @struct  ds_node_chain
  * @brief   State controller for node-based data structures.
@@ -105,15 +174,101 @@ struct ds_node_chain
 
     Chunk *chunk_head;  /**< Linked list of raw memory chunks to be freed upon destruction */
     Node *node_stack;  /**< Stack of recycled nodes ready for immediate O(1) use */
+    Node *stack_bottom; /**< Last node of the node_stack, meaningless while it is empty */
     size_t stack_size; /**< Total count of available nodes resting in the node_stack */
 
     size_t offset;     /**< Byte padding required to reach user data from the Node header */
     size_t stride;     /**< Total physical size of a single slot (Header + Padding + Data) */
+    size_t slot_align; /**< Boundary the private slots start on, in chunks (1 if any) */
     size_t length;     /**< Total count of active nodes currently holding valid data */
+
+    bool doubly_linked; /**< Whether nodes carry a `prev` link (DNode headers) */
+    bool cached;        /**< Whether slots come from the thread cache (see magazine.h) */
+    NodePool *pool;     /**< Shared pool the slots come from (NULL if private) */
+
+    Node *finger;        /**< Last node reached by index (NULL if unknown) */
+    size_t finger_index; /**< Index of `finger` in the chain */
+
+    float trim_ratio;   /**< Share of free slots that triggers a trim (0 to disable) */
+    size_t trim_mark;   /**< Free slot count required before the next automatic trim */
+
+    struct ds_nc_snapshot *snapshot; /**< Latest snapshot sharing the nodes (NULL if none) */
+    struct ds_nc_snapshot *retiring; /**< Older snapshots still reading retired nodes, oldest first */
+    size_t epoch;                    /**< Bumped when the nodes are shared, moved or freed wholesale, see @ref invalidate_cursors */
+
+    struct ds_allocator allocator;      /**< Source of the chunks, which it follows on a swap */
+    struct ds_allocator self_allocator; /**< Source of the chain itself, which stays with its handle */
 };
 typedef struct ds_node_chain NodeChain;
 
 
+/**
+ * @brief   Computes the slot layout of a node pool.
+ *
+ * @param   value_size    Size (in bytes) of each stored value.
+ * @param   value_align   Alignment requirement of the stored value.
+ * @param   header_size   Size of the header preceding each payload.
+ * @param   header_align  Alignment requirement of the header.
+ * @param   offset        Updated to the byte offset from the header to the payload.
+ * @param   stride        Updated to the total size of a slot (Header + Padding + Data).
+ *
+ * @return  false if @p value_size / @p value_align are invalid or on overflow.
+ *
+ * @note    Shared by every engine slicing chunks into fixed-size node slots.
+ */
+static inline bool
+node_layout(const size_t value_size, const size_t value_align, const size_t header_size,
+    const size_t header_align, size_t *offset, size_t *stride)
+{
+    if (!value_size || !value_align) return false;
+    if (value_align > alignof(max_align_t)) return false;
+    if (!is_power_of_two(value_align)) return false;
+    if (value_size % value_align != 0) return false;
+
+    const size_t max_align = max(header_align, value_align);
+    const size_t payload_offset = align_value(header_size, value_align);
+
+    // integer overflow check
+    if ((payload_offset + value_size) < value_size) return false;
+
+    *offset = payload_offset;
+    *stride = align_value(payload_offset + value_size, max_align);
+    return true;
+}
+
+
+/**
+ * @brief   Computes the size of a chunk of @p slot_count slots, header slot
+ *          and alignment padding included.
+ */
+static inline size_t
+chunk_bytes(const size_t slot_count, const size_t stride, const size_t slot_align)
+{
+    return (slot_count +1) * stride + slot_align -1;
+}
+
+
+/**
+ * @brief   Counts the slots of a chunk of @p size bytes, see @ref chunk_bytes.
+ */
+static inline size_t
+chunk_slot_count(const size_t size, const size_t stride, const size_t slot_align)
+{
+    return (size - (slot_align -1)) / stride -1;
+}
+
+
+/**
+ * @brief   Retrieves the first slot of @p chunk, past its header slot.
+ */
+static inline byte *
+chunk_slots(Chunk *chunk, const size_t stride, const size_t slot_align)
+{
+    const uintptr_t first = (uintptr_t) chunk + stride;
+    return (byte *)((first + slot_align -1) & ~(uintptr_t)(slot_align -1));
+}
+
+
 /**
  * @brief   Retrieves the memory address of the user payload.
  *
@@ -133,6 +288,104 @@ get_data(const NodeChain *chain, const Node *node)
 }
 
 
+/**
+ * @brief   Retrieves the node header of a user payload.
+ *
+ * @param   chain  Pointer to the active node chain.
+ * @param   data   Pointer to the user data segment, as given by @ref get_data.
+ *
+ * @return  Pointer to the node header that owns @p data.
+ */
+static inline Node *
+get_node(const NodeChain *chain, const void *data)
+{
+    return (Node *)((byte *)data - chain->offset);
+}
+
+
+/**
+ * @brief   Retrieves the previous active node of a doubly-linked chain.
+ *
+ * @warning Assumes @p chain->doubly_linked is set.
+ */
+static inline Node *
+get_prev(const Node *node)
+{
+    return ((const DNode *)node)->prev;
+}
+
+
+/**
+ * @brief   Updates the `prev` link of @p node, no-op on singly-linked chains.
+ */
+static inline void
+set_prev(const NodeChain *chain, Node *node, Node *prev)
+{
+    if (chain->doubly_linked)
+        ((DNode *)node)->prev = prev;
+}
+
+
+/**
+ * @brief   Checks whether the slots of @p chain come from outside its own chunks.
+ *
+ * Such chains (cached or attached to a @ref ds_node_pool) own no chunk, and
+ * give their slots back through @ref give_shared_slot instead of freeing them.
+ */
+static inline bool
+has_shared_slots(const NodeChain *chain)
+{
+    return chain->cached || chain->pool;
+}
+
+
+/**
+ * @brief   Pushes the run @p first .. @p last of @p count recycled slots onto the node_stack.
+ *
+ * @details Keeps `stack_bottom` up to date, so that the whole stack can be
+ * handed over to another chain without walking it.
+ */
+static inline void
+push_slots(NodeChain *chain, Node *first, Node *last, const size_t count)
+{
+    if (!chain->node_stack) chain->stack_bottom = last;
+
+    last->next = chain->node_stack;
+    chain->node_stack = first;
+    chain->stack_size += count;
+}
+
+
+/**
+ * @brief   Frees the snapshots released into @p pool, giving their slots back to it.
+ *
+ * @details Called by the thread using the pool once it runs out of recycled
+ * slots, and before the pool itself is freed.
+ */
+void
+pool_collect(NodePool *pool);
+
+
+/**
+ * @brief   Takes a slot from the thread cache or the pool of @p chain.
+ *
+ * @return  Pointer to the slot, or NULL on allocation failure.
+ *
+ * @warning Assumes @ref has_shared_slots holds, does not update @p chain->length.
+ */
+Node *
+take_shared_slot(NodeChain *chain);
+
+
+/**
+ * @brief   Gives a slot back to the thread cache or the pool of @p chain.
+ *
+ * @warning Assumes @ref has_shared_slots holds, does not update @p chain->length.
+ */
+void
+give_shared_slot(NodeChain *chain, Node *node);
+
+
 /**
  * @brief   Acquires a memory slot from the engine pool.
  * @param   chain  Pointer to the active node chain.
@@ -141,6 +394,7 @@ get_data(const NodeChain *chain, const Node *node)
  * @details Guarantees amortized O(1) allocation time.
  * - Pops from @p chain->node_stack, if recycled slots exist.
  * - If empty, triggers a geometric heap allocation: O(log N) frequency.
+ * - On chains with shared slots, takes one from the thread cache or pool instead.
  * - Slices the new chunk into distinct nodes of @p chain->stride size.
  * - Pushes the unused slices to the stack and returns the first one.
  *
@@ -155,6 +409,47 @@ Node *
 alloc_node(NodeChain *chain);
 
 
+/**
+ * @brief   Acquires @p count memory slots from the engine pool at once.
+ *
+ * @param   chain  Pointer to the active node chain.
+ * @param   count  Number of slots to acquire (strictly positive).
+ * @param   last   Updated to the last node of the returned sequence.
+ *
+ * @return  First node of a sequence of @p count nodes linked through `next`
+ * (the last one links to NULL), or NULL if allocation fails.
+ *
+ * @details Recycled slots are used first. The missing ones are carved from a
+ * single new chunk, sized like in @ref alloc_node but never smaller than the
+ * deficit, and are linked in ascending address order. On chains with shared
+ * slots, they come one by one from the thread cache or pool instead. On
+ * failure the chain is left untouched.
+ *
+ * @note    Increments @p chain->length by @p count.
+ */
+Node *
+alloc_nodes(NodeChain *chain, size_t count, Node **last);
+
+
+/**
+ * @brief   Adds @p count recycled slots to @p chain.
+ *
+ * @param   chain  Pointer to the active node chain.
+ * @param   count  Number of slots to add (strictly positive).
+ *
+ * @return  false on allocation failure, leaving @p chain untouched.
+ *
+ * @details The slots are carved from a single chunk of exactly @p count slots
+ * (or as many as the allocator rounds it to), and come out of the stack first,
+ * in ascending address order. On chains with shared slots, they are taken
+ * from the thread cache or pool instead.
+ *
+ * @note    Increments @p chain->stack_size by at least @p count.
+ */
+bool
+reserve_nodes(NodeChain *chain, size_t count);
+
+
 /**
  * @brief   Releases a node back into the recycling pool.
  *
@@ -164,14 +459,112 @@ alloc_node(NodeChain *chain);
  *
  * @details The memory slot itself is not returned to the OS here. Instead, it
  * is pushed onto the internal @p chain->node_stack for immediate future reuse,
- * preventing memory fragmentation.
+ * preventing memory fragmentation. On chains with shared slots, it goes back to
+ * the thread cache or pool instead. Once recycled slots exceed the trim ratio
+ * of @p chain, idle chunks are released first (see @ref trim_if_sparse); the
+ * chunk of @p node is kept, so its payload stays readable.
  *
  * @note    Decrements @p chain->length and
- *          Increments @p chain->stack_size.
+ *          Increments @p chain->stack_size (if slots are not shared).
  *
  * @warning The memory at @p node becomes invalid for the user after this call.
  */
 void
 free_node(NodeChain *chain, Node *node, const ds_destructor_fn destroy);
 
+
+/**
+ * @brief   Returns the chunks holding no live node to the allocator.
+ *
+ * @param   chain       Pointer to the active node chain.
+ * @param   keep_bytes  Bytes of fully free chunks to keep for future growth.
+ *
+ * @details Chunks do not track their occupancy: it is computed here by
+ * sorting the chunks and the recycled slots by address in place, so that the
+ * slots of each chunk form one run of the stack. Nothing is allocated, and
+ * the slots left are then handed out in ascending address order. Live nodes
+ * are never moved. On chains with shared slots, the recycled slots beyond
+ * @p keep_bytes go back to the thread cache or pool instead.
+ *
+ * @note    Decrements @p chain->stack_size by the number of released slots,
+ *          and rearms the automatic trimming of @ref trim_if_sparse.
+ *
+ * @par Complexity
+ * - Time:  O(S log S + C log C) for S recycled slots and C chunks
+ * - Space: O(1)
+ */
+void
+trim_chunks(NodeChain *chain, size_t keep_bytes);
+
+
+/**
+ * @brief   Trims @p chain if its recycled slots exceed its trim ratio.
+ *
+ * @details After a trim, the next one waits until the recycled slots doubled,
+ * so that a chain whose chunks all hold some live node does not scan them on
+ * every release.
+ */
+static inline void
+trim_if_sparse(NodeChain *chain)
+{
+    if (chain->trim_ratio <= 0 || chain->stack_size < chain->trim_mark)
+        return;
+
+    if ((float) chain->stack_size > chain->trim_ratio * (float)(chain->length + chain->stack_size))
+        trim_chunks(chain, 0);
+}
+
+
+/**
+ * @brief   Forgets the finger, once indices moved in an untracked way.
+ */
+static inline void
+forget_finger(NodeChain *chain)
+{
+    chain->finger = NULL;
+}
+
+
+/**
+ * @brief   Makes the cursors placed on @p chain stale, once its nodes are
+ *          shared, moved or freed wholesale.
+ */
+static inline void
+invalidate_cursors(NodeChain *chain)
+{
+    chain->epoch++;
+}
+
+
+/**
+ * @brief   Stops sharing the first @p count nodes of @p chain with its latest snapshot.
+ *
+ * @param   chain  Pointer to the chain, whose `snapshot` is set.
+ * @param   count  Number of nodes from the head that must become writable.
+ *
+ * @return  DS_ERR_NONE on success, or DS_ERR_ALLOCATION_FAILED /
+ * DS_ERR_COPY_FAILED, leaving @p chain untouched.
+ *
+ * @details The shared nodes among the first @p count are copied into fresh
+ * nodes, which take their place in @p chain, and the former ones are left
+ * to the snapshot until no reader holds it anymore. The shared nodes after
+ * them stay shared. Snapshots released since the last call give their
+ * nodes back to @p chain first.
+ */
+enum ds_error
+unshare_nodes(NodeChain *chain, size_t count);
+
+
+/**
+ * @brief   Makes the first @p count nodes of @p chain safe to modify, see @ref unshare_nodes.
+ *
+ * @note    Pushing at either end never touches a node a snapshot reads, and
+ *          does not need it.
+ */
+static inline enum ds_error
+unshare(NodeChain *chain, const size_t count)
+{
+    return chain->snapshot ? unshare_nodes(chain, count) : DS_ERR_NONE;
+}
+
 #endif //LIBDS_INTERNAL_NODE_H
\ No newline at end of file
@@ -10,6 +10,7 @@
 #define LIBDS_INTERNAL_UTILS_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 /**
@@ -67,4 +68,21 @@ is_power_of_two(const size_t value)
     return (value > 0) && ((value & (value - 1)) == 0);
 }
 
+/**
+ * @brief   Rounds a value up to the next power of two.
+ * @param   value The value to round.
+ * @return  The smallest power of two >= @p value, or 0 on overflow.
+ */
+static inline size_t
+next_power_of_two(const size_t value)
+{
+    size_t power = 1;
+    while (power < value)
+    {
+        if (power > SIZE_MAX / 2) return 0;
+        power <<= 1;
+    }
+    return power;
+}
+
 #endif //LIBDS_INTERNAL_UTILS_H
\ No newline at end of file
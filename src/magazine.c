@@ -0,0 +1,351 @@
+/**
+ * @file    magazine.c
+ * @brief   Per-thread magazine cache of node slots (see internal/magazine.h).
+ *
+ * Follows the two-magazine scheme of Bonwick's slab allocator: a thread
+ * allocates from its `loaded` magazine and swaps it with `previous` when it
+ * runs dry, so a thread alternating allocations and releases around a
+ * magazine boundary does not thrash the depot. Only when both are empty
+ * (or full) is a whole magazine traded with the depot, under its lock.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#include "libds/core.h"
+#include "libds/impl/nodechain.h"
+
+#include "internal/utils.h"
+#include "internal/node.h"
+#include "internal/magazine.h"
+
+/**
+ * @def     MAG_CLASS_GRANULE
+ * @brief   Stride difference between two consecutive classes.
+ *
+ * Every stride is a multiple of the Node alignment (see node_layout()).
+ */
+#define MAG_CLASS_GRANULE alignof(Node)
+
+/**
+ * @def     MAG_CLASSES
+ * @brief   Number of stride classes.
+ */
+#define MAG_CLASSES (MAG_MAX_STRIDE / MAG_CLASS_GRANULE)
+
+/**
+ * @struct  magazine
+ * @brief   Fixed-size stack of free slots, owned by one thread or the depot.
+ */
+struct magazine
+{
+    struct magazine *next;                  /**< Next magazine in a depot list */
+    size_t count;                           /**< Number of slots held */
+    Node *slots[LIBDS_NC_MAGAZINE_SIZE];    /**< Free slots, the top is `slots[count - 1]` */
+};
+typedef struct magazine Magazine;
+
+/**
+ * @struct  depot
+ * @brief   Shared store of one stride class.
+ */
+struct depot
+{
+    atomic_bool locked;     /**< Spinlock guarding the other fields */
+    Magazine *full;         /**< Magazines holding at least one slot */
+    Magazine *empty;        /**< Magazines holding no slot */
+    Node *loose;            /**< Slots released while no magazine could be allocated */
+    Chunk *chunks;          /**< Every chunk carved for the class */
+};
+typedef struct depot Depot;
+
+/**
+ * @struct  class_cache
+ * @brief   Magazines and counters of one thread for one stride class.
+ */
+struct class_cache
+{
+    Magazine *loaded;               /**< Magazine used first */
+    Magazine *previous;             /**< Spare magazine, swapped with `loaded` */
+    struct ds_cache_stats stats;    /**< Hit and miss counters */
+};
+typedef struct class_cache ClassCache;
+
+static Depot depots[MAG_CLASSES];
+static _Thread_local ClassCache thread_caches[MAG_CLASSES];
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+static inline size_t
+class_of(const size_t stride)
+{
+    return stride / MAG_CLASS_GRANULE - 1;
+}
+
+static void
+depot_lock(Depot *depot)
+{
+    while (atomic_exchange_explicit(&depot->locked, true, memory_order_acquire))
+        while (atomic_load_explicit(&depot->locked, memory_order_relaxed)) {}
+}
+
+static void
+depot_unlock(Depot *depot)
+{
+    atomic_store_explicit(&depot->locked, false, memory_order_release);
+}
+
+/**
+ * @brief   Pushes a magazine to the `full` or `empty` list of the depot.
+ * @warning The depot must be locked.
+ */
+static void
+depot_put(Depot *depot, Magazine *magazine)
+{
+    Magazine **list = magazine->count ? &depot->full : &depot->empty;
+    magazine->next = *list;
+    *list = magazine;
+}
+
+/**
+ * @brief   Hands the magazines of the exiting thread back to the depots.
+ */
+static void
+flush_thread(void *caches)
+{
+    ClassCache *cache = (ClassCache *) caches;
+
+    for (size_t k = 0; k < MAG_CLASSES; k++)
+    {
+        if (!cache[k].loaded && !cache[k].previous) continue;
+
+        depot_lock(&depots[k]);
+        if (cache[k].loaded) depot_put(&depots[k], cache[k].loaded);
+        if (cache[k].previous) depot_put(&depots[k], cache[k].previous);
+        depot_unlock(&depots[k]);
+
+        cache[k].loaded = NULL;
+        cache[k].previous = NULL;
+    }
+}
+
+#ifndef __STDC_NO_THREADS__
+static tss_t flush_key;
+static bool flush_key_created = false;
+static once_flag flush_once = ONCE_FLAG_INIT;
+
+static void
+create_flush_key(void)
+{
+    flush_key_created = (tss_create(&flush_key, flush_thread) == thrd_success);
+}
+#endif
+
+/**
+ * @brief   Makes sure the magazines of the calling thread are flushed when it exits.
+ *
+ * @note    Without C11 threads, the magazines of exiting threads are leaked.
+ */
+static void
+register_thread(void)
+{
+#ifndef __STDC_NO_THREADS__
+    static _Thread_local bool registered = false;
+    if (registered) return;
+
+    call_once(&flush_once, create_flush_key);
+    if (flush_key_created)
+        tss_set(flush_key, thread_caches);
+
+    registered = true;
+#endif
+}
+
+/**
+ * @brief   Gets an empty magazine from the depot, or allocates one.
+ */
+static Magazine *
+empty_magazine(Depot *depot)
+{
+    depot_lock(depot);
+    Magazine *magazine = depot->empty;
+    if (magazine) depot->empty = magazine->next;
+    depot_unlock(depot);
+
+    if (!magazine)
+    {
+        magazine = (Magazine *) malloc(sizeof(Magazine));
+        if (!magazine) return NULL;
+    }
+
+    magazine->count = 0;
+    return magazine;
+}
+
+/**
+ * @brief   Allocation path once both thread magazines are empty.
+ */
+static Node *
+alloc_miss(Depot *depot, ClassCache *cache, const size_t stride)
+{
+    register_thread();
+    cache->stats.alloc_misses++;
+
+    depot_lock(depot);
+
+    Magazine *full = depot->full;
+    if (full)
+    {
+        // trade the empty spare for a full magazine
+        depot->full = full->next;
+        if (cache->previous) depot_put(depot, cache->previous);
+        cache->previous = cache->loaded;
+        cache->loaded = full;
+
+        depot_unlock(depot);
+        return full->slots[--full->count];
+    }
+
+    Node *loose = depot->loose;
+    if (loose)
+    {
+        depot->loose = loose->next;
+        depot_unlock(depot);
+        return loose;
+    }
+
+    depot_unlock(depot);
+
+    // nothing to trade: carve a fresh chunk into the loaded magazine
+    if (!cache->loaded)
+    {
+        cache->loaded = empty_magazine(depot);
+        if (!cache->loaded) return NULL;
+    }
+
+    // one extra slot for the chunk header, like in alloc_node()
+    Chunk *chunk = (Chunk *) malloc((LIBDS_NC_MAGAZINE_SIZE + 1) * stride);
+    if (!chunk) return NULL;
+
+    depot_lock(depot);
+    chunk->size = (LIBDS_NC_MAGAZINE_SIZE + 1) * stride;
+    chunk->next = depot->chunks;
+    depot->chunks = chunk;
+    depot_unlock(depot);
+
+    // push in reverse so that slots come out in ascending address order
+    Magazine *loaded = cache->loaded;
+    byte *memory_chunk = (byte *)chunk + stride;
+    for (size_t i = LIBDS_NC_MAGAZINE_SIZE; i-- > 0;)
+        loaded->slots[loaded->count++] = (Node *)(memory_chunk + i * stride);
+
+    return loaded->slots[--loaded->count];
+}
+
+/**
+ * @brief   Release path once both thread magazines are full.
+ */
+static void
+free_miss(Depot *depot, ClassCache *cache, Node *node)
+{
+    register_thread();
+    cache->stats.free_misses++;
+
+    Magazine *empty = empty_magazine(depot);
+    if (!empty)
+    {
+        // out of memory: park the slot in the depot itself
+        depot_lock(depot);
+        node->next = depot->loose;
+        depot->loose = node;
+        depot_unlock(depot);
+        return;
+    }
+
+    // trade the full spare for an empty magazine
+    if (cache->previous)
+    {
+        depot_lock(depot);
+        depot_put(depot, cache->previous);
+        depot_unlock(depot);
+    }
+    cache->previous = cache->loaded;
+    cache->loaded = empty;
+
+    empty->slots[empty->count++] = node;
+}
+
+
+//==============================================================================
+// Magazine Cache
+//==============================================================================
+
+bool
+mag_supports(const size_t stride)
+{
+    return stride && stride <= MAG_MAX_STRIDE && stride % MAG_CLASS_GRANULE == 0;
+}
+
+Node *
+mag_alloc(const size_t stride)
+{
+    const size_t k = class_of(stride);
+    ClassCache *cache = &thread_caches[k];
+
+    Magazine *loaded = cache->loaded;
+    if (!loaded || !loaded->count)
+    {
+        Magazine *previous = cache->previous;
+        if (!previous || !previous->count)
+            return alloc_miss(&depots[k], cache, stride);
+
+        cache->previous = loaded;
+        cache->loaded = loaded = previous;
+    }
+
+    cache->stats.alloc_hits++;
+    return loaded->slots[--loaded->count];
+}
+
+void
+mag_free(const size_t stride, Node *node)
+{
+    const size_t k = class_of(stride);
+    ClassCache *cache = &thread_caches[k];
+
+    Magazine *loaded = cache->loaded;
+    if (!loaded || loaded->count == LIBDS_NC_MAGAZINE_SIZE)
+    {
+        Magazine *previous = cache->previous;
+        if (!previous || previous->count == LIBDS_NC_MAGAZINE_SIZE)
+        {
+            free_miss(&depots[k], cache, node);
+            return;
+        }
+
+        cache->previous = loaded;
+        cache->loaded = loaded = previous;
+    }
+
+    cache->stats.free_hits++;
+    loaded->slots[loaded->count++] = node;
+}
+
+void
+mag_stats(const size_t stride, struct ds_cache_stats *out)
+{
+    *out = thread_caches[class_of(stride)].stats;
+}
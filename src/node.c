@@ -8,51 +8,257 @@
 
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include "internal/node.h"
 #include "internal/utils.h"
+#include "internal/magazine.h"
+
+/**
+ * @brief   Allocates a chunk of @p batch_size slots and pushes them all to @p node_stack.
+ *
+ * @details The slots are pushed so that they are popped in ascending address
+ * order, laying out the nodes filled next sequentially. They start on a
+ * @p slot_align boundary (see @ref chunk_slots). If the stack was empty,
+ * @p stack_bottom (may be NULL) is set to the last of them.
+ *
+ * @return  false on allocation failure, leaving everything untouched.
+ */
+static bool
+carve_chunk(const struct ds_allocator *allocator, Chunk **chunk_head, Node **node_stack,
+    Node **stack_bottom, size_t *stack_size, const size_t stride, const size_t slot_align, size_t batch_size)
+{
+    // integer overflow check, one extra slot for the chunk header
+    if (batch_size > (SIZE_MAX - slot_align) / stride - 1) return false;
+
+    // as many slots as the allocator reserves anyway
+    batch_size = chunk_slot_count(mem_good_size(allocator, chunk_bytes(batch_size, stride, slot_align)),
+        stride, slot_align);
+    const size_t total_size = chunk_bytes(batch_size, stride, slot_align);
+
+    Chunk *new_chunk = (Chunk *) mem_alloc(allocator, total_size);
+    if (!new_chunk) return false;
+
+    // push to liked chunks
+    new_chunk->size = total_size;
+    new_chunk->next = *chunk_head;
+    *chunk_head = new_chunk;
+
+    // skip the header of the chunk
+    byte *memory_chunk = chunk_slots(new_chunk, stride, slot_align);
+
+    if (stack_bottom && !*node_stack)
+        *stack_bottom = (Node *)(memory_chunk + ((batch_size -1) * stride));
+
+    for (size_t i = batch_size; i-- > 0;)
+    {
+        // slice the chunk in `stride` spaced slots
+        Node *cached_node = (Node *)(memory_chunk + (i * stride));
+
+        // send node to stack
+        cached_node->next = *node_stack;
+        *node_stack = cached_node;
+        (*stack_size)++;
+    }
+    return true;
+}
+
+Node *
+take_shared_slot(NodeChain *chain)
+{
+    if (chain->cached)
+        return mag_alloc(chain->stride);
+
+    NodePool *pool = chain->pool;
+    if (!pool->node_stack) pool_collect(pool);
+
+    if (!pool->node_stack)
+    {
+        // same geometric growth as a private chain, based on every attached chain
+        const size_t batch_size = max(MIN_BATCH_SIZE, pool->in_use * GROWTH_FACTOR);
+        if (!carve_chunk(&pool->allocator, &pool->chunk_head, &pool->node_stack, NULL, &pool->stack_size,
+                pool->stride, 1, batch_size))
+            return NULL;
+    }
+
+    Node *node = pool->node_stack;
+    pool->node_stack = node->next;
+    pool->stack_size--;
+    pool->in_use++;
+
+    return node;
+}
+
+void
+give_shared_slot(NodeChain *chain, Node *node)
+{
+    if (chain->cached)
+    {
+        mag_free(chain->stride, node);
+        return;
+    }
+
+    NodePool *pool = chain->pool;
+    node->next = pool->node_stack;
+    pool->node_stack = node;
+    pool->stack_size++;
+    pool->in_use--;
+}
 
 Node *
 alloc_node(NodeChain *chain)
 {
+    if (!chain->node_stack && has_shared_slots(chain))
+    {
+        Node *new_node = take_shared_slot(chain);
+        if (!new_node) return NULL;
+
+        new_node->next = NULL;
+        chain->length++;
+        return new_node;
+    }
+
     if (!chain->node_stack)
     {
         // dynamic batch sizing: geometric growth based of current length
         const size_t batch_size = max(MIN_BATCH_SIZE, chain->length * GROWTH_FACTOR);
 
-        // one extra slot for the chunk header
-        const size_t total_size = (batch_size +1) * chain->stride;
+        if (!carve_chunk(&chain->allocator, &chain->chunk_head, &chain->node_stack, &chain->stack_bottom,
+                &chain->stack_size, chain->stride, chain->slot_align, batch_size))
+            return NULL;
+    }
+
+    // pop from stack of available nodes
+    Node *new_node = chain->node_stack;
+    chain->node_stack = chain->node_stack->next;
+    new_node->next = NULL;
+
+    chain->stack_size--;
+    chain->length++;
+
+    return new_node;
+}
+
+Node *
+alloc_nodes(NodeChain *chain, const size_t count, Node **last)
+{
+    const size_t deficit = chain->stack_size < count ? count - chain->stack_size : 0;
+
+    Node *first = NULL;
+    Node *tail = NULL;
+
+    if (deficit && has_shared_slots(chain))
+    {
+        for (size_t i = 0; i < deficit; i++)
+        {
+            Node *new_node = take_shared_slot(chain);
+            if (!new_node)
+            {
+                // rollback
+                while (first)
+                {
+                    Node *next = first->next;
+                    give_shared_slot(chain, first);
+                    first = next;
+                }
+                return NULL;
+            }
+
+            new_node->next = first;
+            first = new_node;
+            if (!tail) tail = new_node;
+        }
+    }
+    else if (deficit)
+    {
+        // the whole deficit comes from one chunk, extra slots go to the stack
+        size_t batch_size = max(deficit, max(MIN_BATCH_SIZE, chain->length * GROWTH_FACTOR));
+
+        const size_t stride = chain->stride;
+        const size_t slot_align = chain->slot_align;
 
-        Chunk *new_chunk = (Chunk *) malloc(total_size);
+        // integer overflow check, one extra slot for the chunk header
+        if (batch_size > (SIZE_MAX - slot_align) / stride - 1) return NULL;
+
+        batch_size = chunk_slot_count(mem_good_size(&chain->allocator, chunk_bytes(batch_size, stride, slot_align)),
+            stride, slot_align);
+        const size_t total_size = chunk_bytes(batch_size, stride, slot_align);
+
+        Chunk *new_chunk = (Chunk *) mem_alloc(&chain->allocator, total_size);
         if (!new_chunk) return NULL;
 
-        // push to liked chunks
+        new_chunk->size = total_size;
         new_chunk->next = chain->chunk_head;
         chain->chunk_head = new_chunk;
 
-        // skip the header of the chunk
-        byte *memory_chunk = (byte *)new_chunk + chain->stride;
+        byte *memory_chunk = chunk_slots(new_chunk, stride, slot_align);
 
-        for (size_t i = 0; i < batch_size; i++)
+        for (size_t i = deficit; i < batch_size; i++)
         {
-            // slice the chunk in `chain->stride` spaced slots
-            Node *cached_node = (Node *)(memory_chunk + (i * chain->stride));
+            Node *cached_node = (Node *)(memory_chunk + (i * stride));
+            push_slots(chain, cached_node, cached_node, 1);
+        }
 
-            // send node to stack
-            cached_node->next = chain->node_stack;
-            chain->node_stack = cached_node;
-            chain->stack_size++;
+        // link the deficit slots in ascending address order
+        for (size_t i = deficit; i-- > 0;)
+        {
+            Node *new_node = (Node *)(memory_chunk + (i * stride));
+            new_node->next = first;
+            first = new_node;
         }
+        tail = (Node *)(memory_chunk + ((deficit -1) * stride));
     }
 
-    // pop from stack of available nodes
-    Node *new_node = chain->node_stack;
-    chain->node_stack = chain->node_stack->next;
-    new_node->next = NULL;
+    // take the remaining slots from the stack, ahead of the fresh ones
+    for (size_t i = deficit; i < count; i++)
+    {
+        Node *new_node = chain->node_stack;
+        chain->node_stack = new_node->next;
+        chain->stack_size--;
 
-    chain->stack_size--;
-    chain->length++;
+        new_node->next = first;
+        first = new_node;
+        if (!tail) tail = new_node;
+    }
 
-    return new_node;
+    chain->length += count;
+
+    *last = tail;
+    return first;
+}
+
+bool
+reserve_nodes(NodeChain *chain, const size_t count)
+{
+    if (!has_shared_slots(chain))
+        return carve_chunk(&chain->allocator, &chain->chunk_head, &chain->node_stack, &chain->stack_bottom,
+            &chain->stack_size, chain->stride, chain->slot_align, count);
+
+    Node *first = NULL;
+    for (size_t i = 0; i < count; i++)
+    {
+        Node *new_node = take_shared_slot(chain);
+        if (!new_node)
+        {
+            // rollback
+            while (first)
+            {
+                Node *next = first->next;
+                give_shared_slot(chain, first);
+                first = next;
+            }
+            return false;
+        }
+        new_node->next = first;
+        first = new_node;
+    }
+
+    // only reached with a positive count
+    Node *last = first;
+    while (last->next) last = last->next;
+
+    push_slots(chain, first, last, count);
+    return true;
 }
 
 void
@@ -64,10 +270,223 @@ free_node(NodeChain *chain, Node *node, const ds_destructor_fn destroy)
         destroy(data);
     }
 
+    chain->length--;
+
+    if (has_shared_slots(chain))
+    {
+        give_shared_slot(chain, node);
+        return;
+    }
+
+    // trim first: the chunk of `node` stays, as pops still read its payload
+    trim_if_sparse(chain);
+
     // push to stack of available nodes
-    node->next = chain->node_stack;
-    chain->node_stack = node;
+    push_slots(chain, node, node, 1);
+}
 
-    chain->stack_size++;
-    chain->length--;
-}
\ No newline at end of file
+//==============================================================================
+// Trimming
+//==============================================================================
+
+/**
+ * @brief   Merges two runs of recycled slots sorted by address.
+ */
+static Node *
+merge_slots(Node *a, Node *b)
+{
+    Node head = { .next = NULL };
+    Node *tail = &head;
+    while (a && b)
+    {
+        if ((uintptr_t) a < (uintptr_t) b)
+        {
+            tail->next = a;
+            a = a->next;
+        }
+        else
+        {
+            tail->next = b;
+            b = b->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
+
+/**
+ * @brief   Sorts a NULL-terminated run of recycled slots by address, without allocating.
+ *
+ * @details Bottom-up merge sort: `runs[i]` holds a sorted run of 2^i slots.
+ */
+static Node *
+sort_slots(Node *list)
+{
+    Node *runs[sizeof(size_t) * 8] = { NULL };
+
+    while (list != NULL)
+    {
+        Node *run = list;
+        list = list->next;
+        run->next = NULL;
+
+        size_t i = 0;
+        for (; runs[i] != NULL; i++)
+        {
+            run = merge_slots(runs[i], run);
+            runs[i] = NULL;
+        }
+        runs[i] = run;
+    }
+
+    Node *sorted = NULL;
+    for (size_t i = 0; i < sizeof(size_t) * 8; i++)
+        if (runs[i]) sorted = merge_slots(runs[i], sorted);
+
+    return sorted;
+}
+
+/**
+ * @brief   Merges two lists of chunks sorted by address.
+ */
+static Chunk *
+merge_chunks(Chunk *a, Chunk *b)
+{
+    Chunk head = { .next = NULL, .size = 0 };
+    Chunk *tail = &head;
+    while (a && b)
+    {
+        if ((uintptr_t) a < (uintptr_t) b)
+        {
+            tail->next = a;
+            a = a->next;
+        }
+        else
+        {
+            tail->next = b;
+            b = b->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
+
+/**
+ * @brief   Sorts a list of chunks by address, see @ref sort_slots.
+ */
+static Chunk *
+sort_chunks(Chunk *list)
+{
+    Chunk *runs[sizeof(size_t) * 8] = { NULL };
+
+    while (list != NULL)
+    {
+        Chunk *run = list;
+        list = list->next;
+        run->next = NULL;
+
+        size_t i = 0;
+        for (; runs[i] != NULL; i++)
+        {
+            run = merge_chunks(runs[i], run);
+            runs[i] = NULL;
+        }
+        runs[i] = run;
+    }
+
+    Chunk *sorted = NULL;
+    for (size_t i = 0; i < sizeof(size_t) * 8; i++)
+        if (runs[i]) sorted = merge_chunks(runs[i], sorted);
+
+    return sorted;
+}
+
+/**
+ * @brief   Gives the recycled slots of a shared-slot chain back, but the first @p keep.
+ */
+static void
+trim_shared(NodeChain *chain, const size_t keep)
+{
+    Node **link = &chain->node_stack;
+    for (size_t i = 0; i < keep && *link; i++)
+    {
+        chain->stack_bottom = *link;
+        link = &(*link)->next;
+    }
+
+    Node *node = *link;
+    *link = NULL;
+
+    while (node != NULL)
+    {
+        Node *next = node->next;
+        give_shared_slot(chain, node);
+        chain->stack_size--;
+        node = next;
+    }
+}
+
+void
+trim_chunks(NodeChain *chain, const size_t keep_bytes)
+{
+    if (has_shared_slots(chain))
+    {
+        trim_shared(chain, keep_bytes / chain->stride);
+        chain->trim_mark = 2 * chain->stack_size + MIN_BATCH_SIZE;
+        return;
+    }
+
+    if (!chain->chunk_head || !chain->stack_size) return;
+
+    const size_t stride = chain->stride;
+    const size_t slot_align = chain->slot_align;
+
+    // both in address order, the recycled slots of each chunk form one run of the stack
+    Chunk *chunk = sort_chunks(chain->chunk_head);
+    chain->node_stack = sort_slots(chain->node_stack);
+    chain->chunk_head = NULL;
+
+    Chunk **chunk_link = &chain->chunk_head;
+    Node **link = &chain->node_stack;
+    size_t kept_bytes = 0;
+
+    while (chunk != NULL)
+    {
+        Chunk *next = chunk->next;
+        const byte *end = (const byte *)chunk + chunk->size;
+
+        Node **run = link;
+        Node *run_last = NULL;
+        size_t free_slots = 0;
+        while (*link && (const byte *)*link < end)
+        {
+            run_last = *link;
+            link = &(*link)->next;
+            free_slots++;
+        }
+
+        // a chunk is idle when all its slots are in the stack
+        const bool idle = free_slots == chunk_slot_count(chunk->size, stride, slot_align);
+        if (idle && kept_bytes + chunk->size > keep_bytes)
+        {
+            *run = *link;
+            link = run;
+            chain->stack_size -= free_slots;
+            mem_free(&chain->allocator, chunk, chunk->size);
+        }
+        else
+        {
+            if (idle) kept_bytes += chunk->size;
+            if (free_slots) chain->stack_bottom = run_last;
+
+            *chunk_link = chunk;
+            chunk_link = &chunk->next;
+        }
+        chunk = next;
+    }
+    *chunk_link = NULL;
+
+    chain->trim_mark = 2 * chain->stack_size + MIN_BATCH_SIZE;
+}
@@ -3,8 +3,10 @@
  * @brief   Core implementation of the type-agnostic singly-linked list engine.
  *
  * This module provides the internal, low-level mechanics for singly-linked list
- * operations. It is strictly type-agnostic, operating on raw byte strides and
- * memory alignments to manage a geometric, dynamically growing recycling pool.
+ * operations, with an optional doubly-linked mode where every node also keeps
+ * a `prev` link (see @ref ds_nc_alloc_doubly). It is strictly type-agnostic,
+ * operating on raw byte strides and memory alignments to manage a geometric,
+ * dynamically growing recycling pool.
  *
  * @note The length of the chain is internally updated inside `alloc_node()`
  * and `free_node()`.
@@ -18,8 +20,10 @@
 
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdatomic.h>
 
 #include "libds/core.h"
 #include "libds/impl/nodechain.h"
@@ -28,499 +32,2523 @@
 
 #include "internal/utils.h"
 #include "internal/node.h"
+#include "internal/magazine.h"
 
 
-//==============================================================================
-// Life-cycle Management
-//==============================================================================
+/**
+ * @var     COPY_BLOCK_SIZE
+ * @brief   Largest block of adjacent slots copied at once by @ref ds_nc_copy.
+ */
+static const size_t COPY_BLOCK_SIZE = 16 * 1024;
 
-NodeChain *
-ds_nc_alloc(const size_t value_size, const size_t value_align)
+
+/**
+ * @struct  retired_run
+ * @brief   Run of nodes unlinked from a chain while a snapshot still reads them.
+ *
+ * The nodes keep their links, and are walked by count from `first`. The
+ * shared nodes always leave from the front of the shared ones, so those
+ * retired under a snapshot are the first nodes of its view: a single run,
+ * allocated along with the snapshot, grows with each of them.
+ */
+struct retired_run
+{
+    Node *first;                /**< First node of the run */
+    size_t count;               /**< Count of nodes in the run */
+    struct retired_run *next;   /**< Next run retired under the same snapshot */
+};
+typedef struct retired_run RetiredRun;
+
+
+/**
+ * @struct  ds_nc_snapshot
+ * @brief   Read-only view of the nodes a chain held when it was taken.
+ *
+ * The view is a run of `length` nodes from `head`, walked by count: the chain
+ * may still link new nodes before `head` or after `tail` without copying.
+ * The nodes of the view the chain still links are the shared ones: a change
+ * to one of them first copies it, with the shared nodes before it, and
+ * retires the former ones under the latest snapshot (see @ref unshare_nodes),
+ * while a shared node leaving the chain is retired as it is. The chain gives
+ * them back to itself once no reader holds that snapshot. Older snapshots
+ * read a part of the same nodes, and hold a reference to the newer one until
+ * they are released.
+ */
+struct ds_nc_snapshot
 {
-    if (!value_size || !value_align) return NULL;
-    if (value_align > alignof(max_align_t)) return NULL;
-    if (!is_power_of_two(value_align)) return NULL;
-    if (value_size % value_align != 0) return NULL;
+    atomic_size_t refs;     /**< Readers, plus the chain and the older snapshot relying on it */
+
+    const Node *head;       /**< First node of the view (NULL if empty) */
+    const Node *tail;       /**< Last node of the view (NULL if empty) */
+    size_t length;          /**< Count of nodes in the view */
+    size_t offset;          /**< Byte padding from the Node header to the user data */
+
+    size_t shared_index;    /**< Index in the chain of the first shared node, while the latest */
+    size_t shared_length;   /**< Count of shared nodes, the last one being `tail` */
+    RetiredRun *retired;    /**< Runs unlinked from the chain, its own run first (never NULL while the latest) */
+
+    struct ds_nc_snapshot *newer; /**< Next snapshot of the same nodes (NULL if none) */
+    struct ds_nc_snapshot *next;  /**< Next snapshot in the `retiring` list of the chain */
+    bool detached;          /**< Whether `nodes` holds the former state of the chain */
+    NodeChain nodes;        /**< Former state of the chain, once cleared or freed */
 
-    const size_t max_align = max(alignof(Node), value_align);
-    const size_t payload_offset = align_value(sizeof(Node), value_align);
+    size_t value_size;          /**< Size of the values copied on divergence */
+    ds_copier_fn copy;          /**< Copy function of the values (NULL for bitwise) */
+    ds_destructor_fn destroy;   /**< Destructor of the values held in `nodes` and retired runs */
+
+    struct ds_allocator allocator; /**< Source of the snapshot itself and of its runs */
+};
+typedef struct ds_nc_snapshot Snapshot;
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
 
-    // integer overflow check
-    if ((payload_offset + value_size) < value_size) return NULL;
+static NodeChain *
+chain_alloc(const size_t value_size, const size_t value_align, const bool doubly_linked,
+    const bool cached, const struct ds_allocator *allocator)
+{
+    // doubly-linked slots keep room for the `prev` link before the payload
+    const size_t header_size = doubly_linked ? sizeof(DNode) : sizeof(Node);
 
-    const size_t node_stride = align_value(payload_offset + value_size, max_align);
+    size_t payload_offset, node_stride;
+    if (!node_layout(value_size, value_align, header_size, alignof(Node), &payload_offset, &node_stride))
+        return NULL;
 
-    NodeChain *new_chain = (NodeChain *) malloc(sizeof(NodeChain));
+    NodeChain *new_chain = (NodeChain *) mem_alloc(allocator, sizeof(NodeChain));
     if (!new_chain) return NULL;
 
+    new_chain->allocator = *allocator;
+    new_chain->self_allocator = *allocator;
+
     new_chain->head = NULL;
     new_chain->tail = NULL;
 
     new_chain->chunk_head = NULL;
     new_chain->node_stack = NULL;
+    new_chain->stack_bottom = NULL;
     new_chain->stack_size = 0;
 
     new_chain->offset = payload_offset;
     new_chain->stride = node_stride;
+    new_chain->slot_align = 1;
     new_chain->length = 0;
 
+    new_chain->doubly_linked = doubly_linked;
+    new_chain->cached = cached && mag_supports(node_stride);
+    new_chain->pool = NULL;
+
+    new_chain->finger = NULL;
+    new_chain->finger_index = 0;
+
+    new_chain->trim_ratio = TRIM_RATIO;
+    new_chain->trim_mark = MIN_BATCH_SIZE;
+
+    new_chain->snapshot = NULL;
+    new_chain->retiring = NULL;
+    new_chain->epoch = 0;
+
     return new_chain;
 }
 
-
-enum ds_error
-ds_nc_free(NodeChain **chain_ref, const ds_destructor_fn destroy)
+/**
+ * @brief   Returns a NULL-terminated run of nodes to the thread cache or pool.
+ */
+static void
+release_shared(NodeChain *chain, Node *node)
 {
-    if (!chain_ref || !*chain_ref) return DS_ERR_NULL_POINTER;
-
-    if (destroy)
+    while (node != NULL)
     {
-        const Node *node = (*chain_ref)->head;
-        while (node != NULL)
-        {
-            void *data = get_data(*chain_ref, node);
-            destroy(data);
-            node = node->next;
-        }
+        Node *next = node->next;
+        give_shared_slot(chain, node);
+        node = next;
     }
+}
 
-    Chunk *chunk = (*chain_ref)->chunk_head;
+/**
+ * @brief   Frees the chunks of a private chain or a pool.
+ */
+static void
+free_chunks(const struct ds_allocator *allocator, Chunk *chunk)
+{
     while (chunk != NULL)
     {
         Chunk *next = chunk->next;
-        free(chunk);
+        mem_free(allocator, chunk, chunk->size);
         chunk = next;
     }
+}
 
-    free(*chain_ref);
-    *chain_ref = NULL;
-    return DS_ERR_NONE;
+/**
+ * @brief   Drops one reference to @p pool, freeing it with the last one.
+ */
+static void
+pool_release(NodePool *pool)
+{
+    if (atomic_fetch_sub_explicit(&pool->refs, 1, memory_order_acq_rel) != 1) return;
+
+    // the snapshots released last still hold values to destroy
+    pool_collect(pool);
+
+    free_chunks(&pool->allocator, pool->chunk_head);
+    mem_free(&pool->allocator, pool, sizeof(NodePool));
 }
 
+/**
+ * @brief   Gives the @p count nodes of a retired run back to @p chain, destroying their values.
+ */
+static void
+free_run(NodeChain *chain, Node *node, size_t count, const ds_destructor_fn destroy)
+{
+    for (; count; count--)
+    {
+        // walked by count, the link after the run is not ours
+        Node *next = node->next;
+        if (destroy) destroy(get_data(chain, node));
+
+        if (has_shared_slots(chain))
+            give_shared_slot(chain, node);
+        else
+            push_slots(chain, node, node, 1);
 
-enum ds_error
-ds_nc_clear(NodeChain *chain, const ds_destructor_fn destroy, const bool is_deep_clear)
+        node = next;
+    }
+}
+
+/**
+ * @brief   Gives every run retired under @p snapshot back to @p chain.
+ */
+static void
+free_retired(NodeChain *chain, Snapshot *snapshot)
 {
-    if (!chain) return DS_ERR_NULL_POINTER;
+    RetiredRun *run = snapshot->retired;
+    if (!run) return;
 
-    // earlier return when there's no work to do
-    if ((chain->length == 0) && (!is_deep_clear || chain->chunk_head == NULL))
-        return DS_ERR_NONE;
+    while (run != NULL)
+    {
+        RetiredRun *next = run->next;
+        free_run(chain, run->first, run->count, snapshot->destroy);
+        mem_free(&snapshot->allocator, run, sizeof(RetiredRun));
+        run = next;
+    }
+
+    snapshot->retired = NULL;
+    trim_if_sparse(chain);
+}
+
+/**
+ * @brief   Frees @p snapshot, with the former state of the chain if it was handed over.
+ */
+static void
+snapshot_free(Snapshot *snapshot)
+{
+    if (snapshot->detached)
+    {
+        free_retired(&snapshot->nodes, snapshot);
+        ds_nc_clear(&snapshot->nodes, snapshot->destroy, true);
+    }
 
-    if (destroy)
+    const struct ds_allocator allocator = snapshot->allocator;
+    mem_free(&allocator, snapshot, sizeof(Snapshot));
+}
+
+/**
+ * @brief   Drops one reference to @p snapshot, freeing it with the last one.
+ *
+ * @details The last reference frees the former state of the chain, if it
+ * was handed over, then drops the reference held on the newer snapshot.
+ * The slots of a pooled chain only go back on the thread using the pool:
+ * the snapshot is queued into it instead, see @ref pool_collect.
+ */
+static void
+snapshot_release(Snapshot *snapshot)
+{
+    while (snapshot && atomic_fetch_sub_explicit(&snapshot->refs, 1, memory_order_acq_rel) == 1)
     {
-        const Node *node = chain->head;
-        while (node != NULL)
+        Snapshot *newer = snapshot->newer;
+
+        NodePool *pool = snapshot->detached ? snapshot->nodes.pool : NULL;
+        if (pool)
         {
-            void *data = get_data(chain, node);
-            destroy(data);
-            node = node->next;
+            // the pool may free the snapshot as soon as it is queued
+            Snapshot *head = atomic_load_explicit(&pool->released, memory_order_relaxed);
+            do
+                snapshot->next = head;
+            while (!atomic_compare_exchange_weak_explicit(&pool->released, &head, snapshot,
+                       memory_order_release, memory_order_relaxed));
+
+            pool_release(pool);
         }
+        else
+            snapshot_free(snapshot);
+
+        snapshot = newer;
     }
+}
 
-    if (is_deep_clear)
+
+void
+pool_collect(NodePool *pool)
+{
+    Snapshot *snapshot = atomic_exchange_explicit(&pool->released, NULL, memory_order_acquire);
+    while (snapshot != NULL)
     {
-        // clear the memory chunks and stack
-        Chunk *chunk = chain->chunk_head;
-        while (chunk != NULL)
+        Snapshot *next = snapshot->next;
+        snapshot_free(snapshot);
+        snapshot = next;
+    }
+}
+
+/**
+ * @brief   Gives back to @p chain the nodes retired under the snapshots no reader holds anymore.
+ *
+ * @details Runs on the thread of @p chain, the only one allowed to recycle
+ * its slots: a snapshot holding nothing else than the reference of the chain
+ * is done with its runs. The older snapshots come first, so that each one
+ * released drops its reference on the newer one before it is checked.
+ */
+static void
+reclaim_snapshots(NodeChain *chain)
+{
+    Snapshot **link = &chain->retiring;
+    while (*link != NULL)
+    {
+        Snapshot *older = *link;
+        if (atomic_load_explicit(&older->refs, memory_order_acquire) > 1)
         {
-            Chunk *next = chunk->next;
-            free(chunk);
-            chunk = next;
+            link = &older->next;
+            continue;
         }
 
-        chain->chunk_head = NULL;
-        chain->node_stack = NULL;
-        chain->stack_size = 0;
+        *link = older->next;
+        free_retired(chain, older);
+        snapshot_release(older);
     }
-    else
+
+    // the older snapshots rely on the latest one, it goes last
+    Snapshot *latest = chain->snapshot;
+    if (latest && atomic_load_explicit(&latest->refs, memory_order_acquire) == 1)
     {
-        // push to stack of available nodes
-        chain->tail->next = chain->node_stack;
-        chain->node_stack = chain->head;
-        chain->stack_size += chain->length;
+        chain->snapshot = NULL;
+        free_retired(chain, latest);
+        snapshot_release(latest);
+    }
+}
+
+/**
+ * @brief   Hands every node of @p chain over to its latest snapshot, and leaves it empty.
+ *
+ * @details The latest snapshot outlives the older ones, as each of them holds
+ * a reference to the newer one: it also takes their retired runs, and frees
+ * everything with its last reference. @p chain keeps its layout and pool.
+ */
+static void
+hand_over(NodeChain *chain)
+{
+    Snapshot *latest = chain->snapshot;
+
+    RetiredRun **runs = &latest->retired;
+    while (chain->retiring != NULL)
+    {
+        Snapshot *older = chain->retiring;
+        chain->retiring = older->next;
+
+        while (*runs) runs = &(*runs)->next;
+        *runs = older->retired;
+        older->retired = NULL;
+
+        snapshot_release(older);
     }
 
+    latest->nodes = *chain;
+    latest->nodes.snapshot = NULL;
+    latest->detached = true;
+
+    if (chain->pool) atomic_fetch_add_explicit(&chain->pool->refs, 1, memory_order_relaxed);
+
+    // same layout and pool, no node
     chain->head = NULL;
     chain->tail = NULL;
+    chain->chunk_head = NULL;
+    chain->node_stack = NULL;
+    chain->stack_size = 0;
     chain->length = 0;
-    return DS_ERR_NONE;
+    chain->trim_mark = MIN_BATCH_SIZE;
+    chain->snapshot = NULL;
+    forget_finger(chain);
+
+    snapshot_release(latest);
+}
+
+/**
+ * @brief   Makes the node at @p index writable, payload and link included.
+ *
+ * @details The nodes after the shared ones were pushed since the latest
+ * snapshot, and are never copied.
+ */
+static enum ds_error
+unshare_node(NodeChain *chain, const size_t index)
+{
+    const Snapshot *snapshot = chain->snapshot;
+    if (!snapshot || index >= snapshot->shared_index + snapshot->shared_length)
+        return DS_ERR_NONE;
+
+    return unshare_nodes(chain, index +1);
 }
 
+/**
+ * @brief   Makes the `next` link of the node at @p index writable.
+ *
+ * @details Same as @ref unshare_node, except that the last shared node is
+ * left alone: the snapshot seeing it never follows its link.
+ */
+static enum ds_error
+unshare_link(NodeChain *chain, const size_t index)
+{
+    const Snapshot *snapshot = chain->snapshot;
+    if (!snapshot || index +1 >= snapshot->shared_index + snapshot->shared_length)
+        return DS_ERR_NONE;
+
+    return unshare_nodes(chain, index +1);
+}
 
-enum ds_error
-ds_nc_copy(NodeChain *dst_chain, const NodeChain *src_chain, const size_t value_size,
-    const ds_copier_fn copy, const ds_destructor_fn destroy)
+/**
+ * @brief   Accounts for @p count nodes linked at @p index, before the shared ones or after them.
+ */
+static void
+shift_shared(NodeChain *chain, const size_t index, const size_t count)
 {
-    if (!dst_chain || !src_chain) return DS_ERR_NULL_POINTER;
-    if (dst_chain == src_chain) return DS_ERR_NONE;
+    Snapshot *snapshot = chain->snapshot;
+    if (snapshot && snapshot->shared_length && index <= snapshot->shared_index)
+        snapshot->shared_index += count;
+}
 
-    // detach original data to allow rollback on failure
-    const Node *old_head = dst_chain->head;
-    const Node *old_tail = dst_chain->tail;
-    const size_t old_length = dst_chain->length;
+/**
+ * @brief   Accounts for @p count nodes unlinked from @p index, before the shared ones or after them.
+ */
+static void
+unshift_shared(NodeChain *chain, const size_t index, const size_t count)
+{
+    Snapshot *snapshot = chain->snapshot;
+    if (snapshot && snapshot->shared_length && index < snapshot->shared_index)
+        snapshot->shared_index -= count;
+}
 
-    dst_chain->head = NULL;
-    dst_chain->tail = NULL;
-    dst_chain->length = 0;
+/**
+ * @brief   Counts the shared nodes among the @p count ones from @p index.
+ *
+ * @details The nodes before @p index must be writable, or only the link of
+ * the last one (see @ref unshare_link), so that the shared ones found are the
+ * first shared ones: @p from is set to the index of the first of them.
+ */
+static size_t
+shared_span(const NodeChain *chain, const size_t index, const size_t count, size_t *from)
+{
+    const Snapshot *snapshot = chain->snapshot;
+    *from = index + count;
+    if (!snapshot || !snapshot->shared_length) return 0;
 
-    const Node *src_node = src_chain->head;
-    while (src_node != NULL)
+    const size_t begin = max(snapshot->shared_index, index);
+    const size_t end = min(snapshot->shared_index + snapshot->shared_length, index + count);
+    if (begin >= end) return 0;
+
+    *from = begin;
+    return end - begin;
+}
+
+/**
+ * @brief   Retires the first @p count shared nodes, from @p first, already unlinked from @p chain.
+ *
+ * @details The nodes keep their payloads and links for the latest snapshot,
+ * and follow the ones retired so far in its view: its own run grows, and
+ * nothing is allocated. The caller updates `shared_index` if nodes remain
+ * shared.
+ *
+ * @note    Does not update @p chain->length.
+ */
+static void
+retire_shared(NodeChain *chain, Node *first, const size_t count)
+{
+    Snapshot *snapshot = chain->snapshot;
+    RetiredRun *run = snapshot->retired;
+
+    if (!run->count) run->first = first;
+    run->count += count;
+    snapshot->shared_length -= count;
+}
+
+/**
+ * @brief   Allocates a pool whose slots fit chains built with the same arguments.
+ */
+static NodePool *
+pool_alloc(const size_t value_size, const size_t value_align, const bool doubly_linked)
+{
+    const size_t header_size = doubly_linked ? sizeof(DNode) : sizeof(Node);
+
+    size_t payload_offset, node_stride;
+    if (!node_layout(value_size, value_align, header_size, alignof(Node), &payload_offset, &node_stride))
+        return NULL;
+
+    const struct ds_allocator *allocator = ds_get_allocator();
+
+    NodePool *pool = (NodePool *) mem_alloc(allocator, sizeof(NodePool));
+    if (!pool) return NULL;
+
+    pool->allocator = *allocator;
+
+    pool->chunk_head = NULL;
+    pool->node_stack = NULL;
+    pool->stack_size = 0;
+
+    pool->offset = payload_offset;
+    pool->stride = node_stride;
+    pool->in_use = 0;
+    atomic_init(&pool->refs, 1);
+    atomic_init(&pool->released, NULL);
+
+    return pool;
+}
+
+/**
+ * @brief   Allocates a chain attached to @p pool, if their slot layouts match.
+ */
+static NodeChain *
+chain_alloc_in(const size_t value_size, const size_t value_align, const bool doubly_linked,
+    NodePool *pool)
+{
+    if (!pool) return NULL;
+
+    NodeChain *new_chain = chain_alloc(value_size, value_align, doubly_linked, false, &pool->allocator);
+    if (!new_chain) return NULL;
+
+    // any slot with the same payload offset and size fits, whatever the header
+    if (new_chain->offset != pool->offset || new_chain->stride != pool->stride)
     {
-        Node *new_node = alloc_node(dst_chain);
-        if (!new_node)
+        mem_free(&pool->allocator, new_chain, sizeof(NodeChain));
+        return NULL;
+    }
+
+    new_chain->pool = pool;
+    atomic_fetch_add_explicit(&pool->refs, 1, memory_order_relaxed);
+
+    return new_chain;
+}
+
+/**
+ * @brief   Walks to the node at @p index, from the closest known node.
+ *
+ * @details Starts from the head, from the finger left by the previous indexed
+ * access, or, on doubly-linked chains, backwards from the tail or the finger,
+ * then leaves the finger on the node found. Sequential indexed accesses thus
+ * cost O(1) each.
+ *
+ * @warning Assumes @p index is within [0, length -1].
+ */
+static Node *
+node_at(NodeChain *chain, const size_t index)
+{
+    Node *node = chain->head;
+    size_t position = 0;
+
+    if (chain->finger && chain->finger_index <= index)
+    {
+        node = chain->finger;
+        position = chain->finger_index;
+    }
+
+    if (chain->doubly_linked)
+    {
+        Node *back_node = chain->tail;
+        size_t back_position = chain->length -1;
+
+        if (chain->finger && chain->finger_index > index && chain->finger_index < back_position)
         {
-            // rollback
-            ds_nc_clear(dst_chain, destroy, false);
-            dst_chain->head = (Node *)old_head;
-            dst_chain->tail = (Node *)old_tail;
-            dst_chain->length = old_length;
+            back_node = chain->finger;
+            back_position = chain->finger_index;
+        }
 
-            return DS_ERR_ALLOCATION_FAILED;
+        if (back_position - index < index - position)
+        {
+            for (; back_position > index; back_position--)
+                back_node = get_prev(back_node);
+
+            node = back_node;
+            position = index;
+        }
+    }
+
+    for (; position < index; position++)
+        node = node->next;
+
+    chain->finger = node;
+    chain->finger_index = index;
+    return node;
+}
+
+/**
+ * @brief   Detaches @p node, given its predecessor (NULL if it is the head).
+ */
+static void
+unlink_node(NodeChain *chain, Node *prev_node, Node *node)
+{
+    if (prev_node)
+        prev_node->next = node->next;
+    else
+        chain->head = node->next;
+
+    if (node->next)
+        set_prev(chain, node->next, prev_node);
+    else
+        chain->tail = prev_node;
+}
+
+/**
+ * @brief   Unlinks @p node, the one at @p index after @p prev_node (NULL if it
+ * is the head), and hands its value over to @p out or @p destroy.
+ *
+ * @return  DS_ERR_NONE on success, or DS_ERR_ALLOCATION_FAILED /
+ * DS_ERR_COPY_FAILED, leaving @p chain untouched.
+ *
+ * @details The link of @p prev_node must be writable, so that a shared
+ * @p node is the first shared one: it is retired as it is, and its value
+ * stays with the snapshot. @p out then gets a copy of it in a recycled
+ * slot, unless values are copied bitwise.
+ */
+static enum ds_error
+drop_node(NodeChain *chain, Node *prev_node, Node *node, const size_t index, void **out,
+    const ds_destructor_fn destroy)
+{
+    const Snapshot *snapshot = chain->snapshot;
+    if (!snapshot || !snapshot->shared_length || index != snapshot->shared_index)
+    {
+        unlink_node(chain, prev_node, node);
+        unshift_shared(chain, index, 1);
+
+        if (!out)
+            free_node(chain, node, destroy);
+        else
+        {
+            // ownership transferred to `out`
+            *out = get_data(chain, node);
+            free_node(chain, node, NULL);
         }
+        return DS_ERR_NONE;
+    }
+
+    Node *value_node = node;
+    if (out && snapshot->copy)
+    {
+        value_node = alloc_node(chain);
+        if (!value_node) return DS_ERR_ALLOCATION_FAILED;
+
+        const bool copied = snapshot->copy(get_data(chain, value_node), get_data(chain, node));
+
+        // the slot is read like the one of a popped node
+        free_node(chain, value_node, NULL);
+        if (!copied) return DS_ERR_COPY_FAILED;
+    }
+
+    unlink_node(chain, prev_node, node);
+    chain->length--;
+    retire_shared(chain, node, 1);
+
+    if (out) *out = get_data(chain, value_node);
+    return DS_ERR_NONE;
+}
+
+/**
+ * @brief   Checks whether the nodes of @p src can be linked into @p dst as they are.
+ *
+ * @details True when both draw their slots from the same pool, or both from
+ * the thread cache, with the same layout: the slots are then returned to the
+ * same place whichever chain frees them.
+ */
+static bool
+shares_slots(const NodeChain *dst, const NodeChain *src)
+{
+    if (dst->stride != src->stride || dst->offset != src->offset) return false;
+    if (dst->doubly_linked != src->doubly_linked) return false;
+
+    if (dst->pool || src->pool) return dst->pool == src->pool;
+    return dst->cached && src->cached;
+}
+
+/**
+ * @brief   Checks whether @p a and @p b allocate and free through the same allocator.
+ */
+static bool
+same_allocator(const NodeChain *a, const NodeChain *b)
+{
+    return a->allocator.alloc == b->allocator.alloc
+        && a->allocator.free == b->allocator.free
+        && a->allocator.context == b->allocator.context;
+}
+
+/**
+ * @brief   Checks whether the chunks of @p src can be handed over to @p dst.
+ *
+ * @details Both chains must own their chunks, share the same layout, and
+ * free them through the same allocator, and no snapshot of @p src may still
+ * read a node of them.
+ */
+static bool
+can_adopt_chunks(const NodeChain *dst, const NodeChain *src)
+{
+    if (has_shared_slots(dst) || has_shared_slots(src)) return false;
+
+    // nodes retired under a snapshot of `src` go back to its own chunks
+    if (src->snapshot) return false;
+    if (dst->stride != src->stride || dst->offset != src->offset) return false;
+    if (dst->slot_align != src->slot_align) return false;
+    if (dst->doubly_linked != src->doubly_linked) return false;
+
+    return same_allocator(dst, src);
+}
+
+/**
+ * @brief   Appends the NULL-terminated run @p first .. @p last to @p chain.
+ *
+ * @note    Does not update @p chain->length.
+ */
+static void
+append_run(NodeChain *chain, Node *first, Node *last)
+{
+    set_prev(chain, first, chain->tail);
+
+    if (chain->tail)
+        chain->tail->next = first;
+    else
+        chain->head = first;
+
+    chain->tail = last;
+}
+
+/**
+ * @brief   Copies the payloads of @p src, from @p node on, bitwise into the
+ * fresh node sequence @p fresh of @p dst.
+ *
+ * @details Both sequences have the same length. Wherever consecutive nodes are
+ * also adjacent slots on both sides, as in nodes carved by @ref alloc_nodes,
+ * the whole run moves in one block, the headers in between included: they are
+ * rewritten right after. A block spans at most @ref COPY_BLOCK_SIZE bytes, so
+ * that it is still cached when its links are rewritten. The `prev` links are
+ * left to the caller.
+ *
+ * @warning Assumes both chains share the same slot layout.
+ */
+static void
+copy_payloads(NodeChain *dst, Node *fresh, const NodeChain *src, const Node *node, const size_t value_size)
+{
+    const size_t stride = dst->stride;
+    const size_t max_run = max(COPY_BLOCK_SIZE / stride, 1);
+
+    while (fresh != NULL)
+    {
+        Node *last = fresh;
+        const Node *src_last = node;
+        size_t run = 1;
+
+        while (run < max_run && last->next == (Node *)((byte *)last + stride)
+            && src_last->next == (const Node *)((const byte *)src_last + stride))
+        {
+            last = last->next;
+            src_last = src_last->next;
+            run++;
+        }
+
+        Node *next = last->next;
+        memcpy(get_data(dst, fresh), get_data(src, node), (run -1) * stride + value_size);
+
+        // restore the links overwritten by the block
+        byte *slot = (byte *)fresh;
+        for (size_t i = 1; i < run; i++, slot += stride)
+            ((Node *)slot)->next = (Node *)(slot + stride);
+
+        last->next = next;
+
+        fresh = next;
+        node = src_last->next;
+    }
+}
+
+/**
+ * @brief   Copies @p count values into a fresh node sequence from @ref alloc_nodes.
+ *
+ * @param   reversed  Whether the last value goes to the first node.
+ *
+ * @return  true on success. On failure the copied values are destroyed, and the
+ * whole sequence is returned to the node_stack.
+ */
+static bool
+fill_nodes(NodeChain *chain, Node *first, Node *last, const void *values, const size_t count,
+    const size_t value_size, const ds_copier_fn copy, const ds_destructor_fn destroy, const bool reversed)
+{
+    const byte *src = (const byte *)values;
+
+    Node *node = first;
+    for (size_t i = 0; i < count; i++, node = node->next)
+    {
+        const size_t k = reversed ? count -1 - i : i;
+        void *dst_value = get_data(chain, node);
+
+        if (!copy)
+            memcpy(dst_value, src + k * value_size, value_size);
+
+        else if ( !copy(dst_value, src + k * value_size) )
+        {
+            // rollback, the current node is invalid and is not destroyed
+            if (destroy)
+                for (Node *copied = first; copied != node; copied = copied->next)
+                    destroy(get_data(chain, copied));
+
+            push_slots(chain, first, last, count);
+            chain->length -= count;
+            return false;
+        }
+    }
+    return true;
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+NodeChain *
+ds_nc_alloc(const size_t value_size, const size_t value_align)
+{
+    return chain_alloc(value_size, value_align, false, false, ds_get_allocator());
+}
+
+
+NodeChain *
+ds_nc_alloc_doubly(const size_t value_size, const size_t value_align)
+{
+    return chain_alloc(value_size, value_align, true, false, ds_get_allocator());
+}
+
+
+NodeChain *
+ds_nc_alloc_cached(const size_t value_size, const size_t value_align)
+{
+    return chain_alloc(value_size, value_align, false, true, ds_get_allocator());
+}
+
+
+NodeChain *
+ds_nc_alloc_doubly_cached(const size_t value_size, const size_t value_align)
+{
+    return chain_alloc(value_size, value_align, true, true, ds_get_allocator());
+}
+
+
+NodeChain *
+ds_nc_alloc_ex(const size_t value_size, const size_t value_align, const struct ds_allocator *allocator)
+{
+    if (allocator && (!allocator->alloc || !allocator->free)) return NULL;
+    return chain_alloc(value_size, value_align, false, false, allocator ? allocator : ds_get_allocator());
+}
+
+
+NodeChain *
+ds_nc_alloc_doubly_ex(const size_t value_size, const size_t value_align,
+    const struct ds_allocator *allocator)
+{
+    if (allocator && (!allocator->alloc || !allocator->free)) return NULL;
+    return chain_alloc(value_size, value_align, true, false, allocator ? allocator : ds_get_allocator());
+}
+
+
+NodePool *
+ds_nc_alloc_pool(const size_t value_size, const size_t value_align)
+{
+    return pool_alloc(value_size, value_align, false);
+}
+
+
+NodePool *
+ds_nc_alloc_doubly_pool(const size_t value_size, const size_t value_align)
+{
+    return pool_alloc(value_size, value_align, true);
+}
+
+
+enum ds_error
+ds_nc_free_pool(NodePool **pool_ref)
+{
+    if (!pool_ref || !*pool_ref) return DS_ERR_NULL_POINTER;
+
+    pool_release(*pool_ref);
+
+    *pool_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+NodeChain *
+ds_nc_alloc_with_pool(const size_t value_size, const size_t value_align, NodePool *pool)
+{
+    return chain_alloc_in(value_size, value_align, false, pool);
+}
+
+
+NodeChain *
+ds_nc_alloc_doubly_with_pool(const size_t value_size, const size_t value_align, NodePool *pool)
+{
+    return chain_alloc_in(value_size, value_align, true, pool);
+}
+
+
+/**
+ * @brief   Destroys every value of the chain, in batches when `destroy_batch` is given.
+ */
+static void
+destroy_values(const NodeChain *chain, const ds_destructor_fn destroy,
+               const ds_batch_destructor_fn destroy_batch)
+{
+    if (destroy_batch)
+    {
+        void *items[LIBDS_NC_DESTROY_BATCH_SIZE];
+        size_t count = 0;
+
+        for (const Node *node = chain->head; node != NULL; node = node->next)
+        {
+            items[count++] = get_data(chain, node);
+            if (count == LIBDS_NC_DESTROY_BATCH_SIZE)
+            {
+                destroy_batch(items, count);
+                count = 0;
+            }
+        }
+
+        if (count) destroy_batch(items, count);
+    }
+    else if (destroy)
+    {
+        for (const Node *node = chain->head; node != NULL; node = node->next)
+            destroy(get_data(chain, node));
+    }
+}
+
+
+/**
+ * @brief   Recycles the NULL-terminated run from @p node, destroying its values.
+ *
+ * @note    Does not update @p chain->length.
+ */
+static void
+recycle_run(NodeChain *chain, Node *node, const ds_destructor_fn destroy)
+{
+    while (node != NULL)
+    {
+        Node *next = node->next;
+        if (destroy) destroy(get_data(chain, node));
+
+        push_slots(chain, node, node, 1);
+        node = next;
+    }
+}
+
+
+static enum ds_error
+chain_free(NodeChain **chain_ref, const ds_destructor_fn destroy,
+           const ds_batch_destructor_fn destroy_batch)
+{
+    if (!chain_ref || !*chain_ref) return DS_ERR_NULL_POINTER;
+
+    // the snapshots still read, they take the whole state over and nothing is left to destroy
+    reclaim_snapshots(*chain_ref);
+    if ((*chain_ref)->snapshot) hand_over(*chain_ref);
+
+    destroy_values(*chain_ref, destroy, destroy_batch);
+
+    if (has_shared_slots(*chain_ref))
+    {
+        release_shared(*chain_ref, (*chain_ref)->head);
+        release_shared(*chain_ref, (*chain_ref)->node_stack);
+    }
+
+    free_chunks(&(*chain_ref)->allocator, (*chain_ref)->chunk_head);
+
+    if ((*chain_ref)->pool)
+        pool_release((*chain_ref)->pool);
+
+    mem_free(&(*chain_ref)->self_allocator, *chain_ref, sizeof(NodeChain));
+    *chain_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+static enum ds_error
+chain_clear(NodeChain *chain, const ds_destructor_fn destroy,
+            const ds_batch_destructor_fn destroy_batch, const bool is_deep_clear)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    invalidate_cursors(chain);
+
+    // handing the nodes over to a snapshot leaves nothing to destroy
+    reclaim_snapshots(chain);
+    if (chain->snapshot) hand_over(chain);
+
+    // earlier return when there's no work to do
+    if ((chain->length == 0) && (!is_deep_clear || (!chain->chunk_head && !chain->node_stack)))
+        return DS_ERR_NONE;
+
+    destroy_values(chain, destroy, destroy_batch);
+
+    if (is_deep_clear && has_shared_slots(chain))
+    {
+        // hand everything back to the thread cache or pool, there are no chunks
+        release_shared(chain, chain->head);
+        release_shared(chain, chain->node_stack);
+
+        chain->node_stack = NULL;
+        chain->stack_size = 0;
+    }
+    else if (is_deep_clear)
+    {
+        // clear the memory chunks and stack
+        free_chunks(&chain->allocator, chain->chunk_head);
+
+        chain->chunk_head = NULL;
+        chain->node_stack = NULL;
+        chain->stack_size = 0;
+    }
+    else
+    {
+        // push to stack of available nodes
+        push_slots(chain, chain->head, chain->tail, chain->length);
+    }
+
+    chain->head = NULL;
+    chain->tail = NULL;
+    chain->length = 0;
+
+    forget_finger(chain);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_free(NodeChain **chain_ref, const ds_destructor_fn destroy)
+{
+    return chain_free(chain_ref, destroy, NULL);
+}
+
+
+enum ds_error
+ds_nc_free_batch(NodeChain **chain_ref, const ds_batch_destructor_fn destroy)
+{
+    return chain_free(chain_ref, NULL, destroy);
+}
+
+
+enum ds_error
+ds_nc_clear(NodeChain *chain, const ds_destructor_fn destroy, const bool is_deep_clear)
+{
+    return chain_clear(chain, destroy, NULL, is_deep_clear);
+}
+
+
+enum ds_error
+ds_nc_clear_batch(NodeChain *chain, const ds_batch_destructor_fn destroy, const bool is_deep_clear)
+{
+    return chain_clear(chain, NULL, destroy, is_deep_clear);
+}
+
+
+enum ds_error
+ds_nc_copy(NodeChain *dst_chain, const NodeChain *src_chain, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!dst_chain || !src_chain) return DS_ERR_NULL_POINTER;
+    if (dst_chain == src_chain) return DS_ERR_NONE;
+
+    // the shared nodes are retired as they are once the copy is done
+    reclaim_snapshots(dst_chain);
+
+    forget_finger(dst_chain);
+    invalidate_cursors(dst_chain);
+
+    // detach original data to allow rollback on failure
+    const Node *old_head = dst_chain->head;
+    const Node *old_tail = dst_chain->tail;
+    const size_t old_length = dst_chain->length;
+
+    dst_chain->head = NULL;
+    dst_chain->tail = NULL;
+    dst_chain->length = 0;
+
+    // trivially copyable values: every node at once, payloads moved by runs
+    const bool same_layout = dst_chain->stride == src_chain->stride && dst_chain->offset == src_chain->offset;
+    if (!copy && same_layout && src_chain->length)
+    {
+        Node *last = NULL;
+        Node *first = alloc_nodes(dst_chain, src_chain->length, &last);
+        if (!first)
+        {
+            dst_chain->head = (Node *)old_head;
+            dst_chain->tail = (Node *)old_tail;
+            dst_chain->length = old_length;
+
+            return DS_ERR_ALLOCATION_FAILED;
+        }
+
+        copy_payloads(dst_chain, first, src_chain, src_chain->head, value_size);
+
+        // single linking pass for the `prev` links
+        if (dst_chain->doubly_linked)
+        {
+            Node *prev_node = NULL;
+            for (Node *node = first; node != NULL; node = node->next)
+            {
+                set_prev(dst_chain, node, prev_node);
+                prev_node = node;
+            }
+        }
+
+        dst_chain->head = first;
+        dst_chain->tail = last;
+    }
+
+    const Node *src_node = dst_chain->head ? NULL : src_chain->head;
+    while (src_node != NULL)
+    {
+        Node *new_node = alloc_node(dst_chain);
+        if (!new_node)
+        {
+            // rollback
+            recycle_run(dst_chain, dst_chain->head, destroy);
+            dst_chain->head = (Node *)old_head;
+            dst_chain->tail = (Node *)old_tail;
+            dst_chain->length = old_length;
+
+            return DS_ERR_ALLOCATION_FAILED;
+        }
+
+        const void *src_value = get_data(src_chain, src_node);
+        void *dst_value = get_data(dst_chain, new_node);
+
+        if (!copy)
+            memcpy(dst_value, src_value, value_size);
+        else
+        {
+            if ( !copy(dst_value, src_value) )
+            {
+                // the current new node is invalid, drop it without destroying
+                free_node(dst_chain, new_node, NULL);
+
+                // rollback
+                recycle_run(dst_chain, dst_chain->head, destroy);
+                dst_chain->head = (Node *)old_head;
+                dst_chain->tail = (Node *)old_tail;
+                dst_chain->length = old_length;
+
+                return DS_ERR_COPY_FAILED;
+            }
+        }
+
+        set_prev(dst_chain, new_node, dst_chain->tail);
+
+        // update head in the first iteration
+        if (!dst_chain->head)
+            dst_chain->head = new_node;
+        else
+            dst_chain->tail->next = new_node;
+
+        dst_chain->tail = new_node;
+
+        src_node = src_node->next;
+    }
+
+    // the snapshot keeps the shared values, and reads the nodes as they are
+    size_t shared_from;
+    const size_t shared_count = shared_span(dst_chain, 0, old_length, &shared_from);
+
+    Node *first_shared = NULL;
+    Node *curr_node = (Node *)old_head;
+    Node *next_node = NULL;
+    for (size_t i = 0; curr_node != NULL; i++)
+    {
+        next_node = curr_node->next;
+
+        if (i - shared_from < shared_count)
+        {
+            if (!first_shared) first_shared = curr_node;
+        }
+        else
+        {
+            if (destroy)
+            {
+                void *data_ptr = get_data(dst_chain, curr_node);
+                destroy(data_ptr);
+            }
+
+            push_slots(dst_chain, curr_node, curr_node, 1);
+        }
+
+        curr_node = next_node;
+    }
+
+    if (shared_count) retire_shared(dst_chain, first_shared, shared_count);
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_nc_swap(NodeChain *chain_a, NodeChain *chain_b)
+{
+    if (!chain_a || !chain_b) return DS_ERR_NULL_POINTER;
+    if (chain_a == chain_b) return DS_ERR_NONE;
+
+    // the cursors of either chain would otherwise pass on the other one
+    const size_t epoch = max(chain_a->epoch, chain_b->epoch) +1;
+
+    // the rest of the state is held by value: nodes, chunks and the allocator
+    // they go back to, pool reference, while each handle keeps its own
+    const NodeChain swap = *chain_a;
+    const struct ds_allocator self_allocator_b = chain_b->self_allocator;
+
+    *chain_a = *chain_b;
+    chain_a->self_allocator = swap.self_allocator;
+    chain_a->epoch = epoch;
+
+    *chain_b = swap;
+    chain_b->self_allocator = self_allocator_b;
+    chain_b->epoch = epoch;
+
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_move(NodeChain *dst_chain, NodeChain *src_chain, const ds_destructor_fn destroy)
+{
+    if (!dst_chain || !src_chain) return DS_ERR_NULL_POINTER;
+    if (dst_chain == src_chain) return DS_ERR_NONE;
+
+    // the destination frees its nodes and chunks, then takes the whole state
+    // of the source, which is left with the emptied one
+    const enum ds_error error = ds_nc_clear(dst_chain, destroy, true);
+    if (error) return error;
+
+    return ds_nc_swap(dst_chain, src_chain);
+}
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_nc_length(const NodeChain *chain)
+{
+    if (!chain) return 0;
+    return chain->length;
+}
+
+
+bool
+ds_nc_is_empty(const NodeChain *chain)
+{
+    if (!chain) return true;
+    return !chain->head && !chain->tail;
+}
+
+
+enum ds_error
+ds_nc_cache_stats(const NodeChain *chain, struct ds_cache_stats *out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    if (!chain->cached)
+    {
+        *out = (struct ds_cache_stats){0};
+        return DS_ERR_NONE;
+    }
+
+    mag_stats(chain->stride, out);
+    return DS_ERR_NONE;
+}
+
+
+size_t
+ds_nc_bytes(const NodeChain *chain)
+{
+    if (!chain) return 0;
+
+    size_t chunk_count = 0;
+    const Chunk *curr_chunk = chain->chunk_head;
+    while (curr_chunk != NULL)
+    {
+        chunk_count++;
+        curr_chunk = curr_chunk->next;
+    }
+
+    const size_t node_stride = chain->stride;
+
+    const size_t chain_struct_size  = sizeof(NodeChain);
+    const size_t nodes_total_size   = (chain->length + chain->stack_size) * node_stride;
+    const size_t chunk_headers_size = chunk_count * (node_stride + chain->slot_align -1);
+
+    return chain_struct_size + nodes_total_size + chunk_headers_size;
+}
+
+
+enum ds_error
+ds_nc_reserve(NodeChain *chain, const size_t capacity)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    const size_t current = chain->length + chain->stack_size;
+    if (capacity <= current) return DS_ERR_NONE;
+
+    if (!reserve_nodes(chain, capacity - current)) return DS_ERR_ALLOCATION_FAILED;
+    return DS_ERR_NONE;
+}
+
+
+size_t
+ds_nc_capacity(const NodeChain *chain)
+{
+    if (!chain) return 0;
+    return chain->length + chain->stack_size;
+}
+
+
+enum ds_error
+ds_nc_trim(NodeChain *chain, const size_t keep_bytes)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    trim_chunks(chain, keep_bytes);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_compact(NodeChain *chain)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    // the slots of cached or pooled chains are not theirs to move
+    if (has_shared_slots(chain)) return DS_ERR_UNSUPPORTED;
+
+    // the chunks stay while a snapshot reads some of their nodes
+    reclaim_snapshots(chain);
+    if (chain->snapshot) return DS_ERR_UNSUPPORTED;
+
+    // nothing to move, every chunk is idle
+    if (chain->length == 0)
+    {
+        invalidate_cursors(chain);
+        free_chunks(&chain->allocator, chain->chunk_head);
+
+        chain->chunk_head = NULL;
+        chain->node_stack = NULL;
+        chain->stack_size = 0;
+        return DS_ERR_NONE;
+    }
+
+    const size_t stride = chain->stride;
+    const size_t slot_align = chain->slot_align;
+
+    // integer overflow check, one extra slot for the chunk header
+    if (chain->length > (SIZE_MAX - slot_align) / stride - 1) return DS_ERR_ALLOCATION_FAILED;
+
+    const size_t slot_count = chunk_slot_count(
+        mem_good_size(&chain->allocator, chunk_bytes(chain->length, stride, slot_align)), stride, slot_align);
+    const size_t total_size = chunk_bytes(slot_count, stride, slot_align);
+
+    Chunk *new_chunk = (Chunk *) mem_alloc(&chain->allocator, total_size);
+    if (!new_chunk) return DS_ERR_ALLOCATION_FAILED;
+
+    new_chunk->size = total_size;
+    new_chunk->next = NULL;
+
+    byte *memory_chunk = chunk_slots(new_chunk, stride, slot_align);
+    const size_t payload_size = stride - chain->offset;
+
+    // move the payloads in traversal order into ascending slots
+    Node *prev_slot = NULL;
+    const Node *node = chain->head;
+    for (size_t i = 0; i < chain->length; i++)
+    {
+        Node *slot = (Node *)(memory_chunk + (i * stride));
+        memcpy(get_data(chain, slot), get_data(chain, node), payload_size);
+
+        slot->next = NULL;
+        set_prev(chain, slot, prev_slot);
+        if (prev_slot) prev_slot->next = slot;
+
+        prev_slot = slot;
+        node = node->next;
+    }
+
+    free_chunks(&chain->allocator, chain->chunk_head);
+
+    chain->chunk_head = new_chunk;
+    chain->head = (Node *)memory_chunk;
+    chain->tail = prev_slot;
+
+    forget_finger(chain);
+    invalidate_cursors(chain);
+
+    // slots the allocator threw in, consumed in ascending address order
+    chain->node_stack = NULL;
+    chain->stack_size = 0;
+    for (size_t i = slot_count; i-- > chain->length;)
+    {
+        Node *spare_node = (Node *)(memory_chunk + (i * stride));
+        push_slots(chain, spare_node, spare_node, 1);
+    }
+
+    return DS_ERR_NONE;
+}
+
+
+double
+ds_nc_link_distance(const NodeChain *chain)
+{
+    if (!chain || chain->length < 2) return 0.0;
+
+    double total_distance = 0.0;
+    for (const Node *node = chain->head; node->next != NULL; node = node->next)
+    {
+        const uintptr_t from = (uintptr_t) node;
+        const uintptr_t to = (uintptr_t) node->next;
+        total_distance += (double)(from < to ? to - from : from - to);
+    }
+
+    return total_distance / (double)(chain->length -1);
+}
+
+
+enum ds_error
+ds_nc_set_trim_ratio(NodeChain *chain, const float ratio)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    // NaN and negative ratios disable trimming
+    chain->trim_ratio = ratio > 0 ? (ratio < 1 ? ratio : 1) : 0;
+    chain->trim_mark = MIN_BATCH_SIZE;
+    return DS_ERR_NONE;
+}
+
+
+size_t
+ds_nc_pool_bytes(const NodePool *pool)
+{
+    if (!pool) return 0;
+
+    size_t chunk_count = 0;
+    for (const Chunk *chunk = pool->chunk_head; chunk != NULL; chunk = chunk->next)
+        chunk_count++;
+
+    return sizeof(NodePool) + (pool->in_use + pool->stack_size + chunk_count) * pool->stride;
+}
+
+enum ds_error
+ds_nc_reverse(NodeChain *chain)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+    if (chain->length <= 1) return DS_ERR_NONE;
+
+    const enum ds_error error = unshare(chain, chain->length);
+    if (error) return error;
+
+    Node *prev_node = NULL;
+    Node *next_node = NULL;
+    Node *curr_node = chain->head;
+
+    while (curr_node != NULL)
+    {
+        next_node = curr_node->next;
+        curr_node->next = prev_node;
+        set_prev(chain, curr_node, next_node);
+
+        // after the loop, prev_node points to the last processed node
+        prev_node = curr_node;
+        curr_node = next_node;
+    }
+
+    chain->tail = chain->head;
+    chain->head = prev_node;
+
+    forget_finger(chain);
+    return DS_ERR_NONE;
+}
+
+//==============================================================================
+// Push Data
+//==============================================================================
+
+enum ds_error
+ds_nc_push_front(NodeChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    Node *new_node = alloc_node(chain);
+    if (!new_node) return DS_ERR_ALLOCATION_FAILED;
+
+    new_node->next = chain->head;
+    set_prev(chain, new_node, NULL);
+
+    // empty list case, tail points to the new node
+    if (!chain->head)
+        chain->tail = new_node;
+    else
+        set_prev(chain, chain->head, new_node);
+
+    chain->head = new_node;
+
+    // every index shifted by one
+    if (chain->finger) chain->finger_index++;
+    shift_shared(chain, 0, 1);
+
+    *out = get_data(chain, new_node);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_push_back(NodeChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    Node *new_node = alloc_node(chain);
+    if (!new_node) return DS_ERR_ALLOCATION_FAILED;
+
+    set_prev(chain, new_node, chain->tail);
+
+    // empty structure case
+    if (!chain->head)
+    {
+        chain->head = new_node;
+        chain->tail = new_node;
+    }
+    // filled structure case
+    else
+    {
+        chain->tail->next = new_node;
+        chain->tail = new_node;
+    }
+
+    *out = get_data(chain, new_node);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_push_at(NodeChain *chain, const size_t index, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    // indices can be equal to length here, performing a `push_back()`
+    const size_t len = chain->length;
+    if (index > len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    if (index == 0) return ds_nc_push_front(chain, out);
+    if (index == len) return ds_nc_push_back(chain, out);
+
+    const enum ds_error error = unshare_link(chain, index -1);
+    if (error) return error;
+
+    Node *prev_node = node_at(chain, index -1);
+
+    Node *new_node = alloc_node(chain);
+    if (!new_node) return DS_ERR_ALLOCATION_FAILED;
+
+    new_node->next = prev_node->next;
+    prev_node->next = new_node;
+
+    set_prev(chain, new_node, prev_node);
+    set_prev(chain, new_node->next, new_node);
+    shift_shared(chain, index, 1);
+
+    *out = get_data(chain, new_node);
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_nc_push_back_n(NodeChain *chain, const void *values, const size_t count, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!chain || !values) return DS_ERR_NULL_POINTER;
+    if (!count) return DS_ERR_NONE;
+
+    Node *last = NULL;
+    Node *first = alloc_nodes(chain, count, &last);
+    if (!first) return DS_ERR_ALLOCATION_FAILED;
+
+    if (!fill_nodes(chain, first, last, values, count, value_size, copy, destroy, false))
+        return DS_ERR_COPY_FAILED;
+
+    // single linking pass for the `prev` links
+    if (chain->doubly_linked)
+    {
+        Node *prev_node = chain->tail;
+        for (Node *node = first; node != NULL; node = node->next)
+        {
+            set_prev(chain, node, prev_node);
+            prev_node = node;
+        }
+    }
+
+    if (!chain->head)
+        chain->head = first;
+    else
+        chain->tail->next = first;
+
+    chain->tail = last;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_push_front_n(NodeChain *chain, const void *values, const size_t count, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!chain || !values) return DS_ERR_NULL_POINTER;
+    if (!count) return DS_ERR_NONE;
+
+    Node *last = NULL;
+    Node *first = alloc_nodes(chain, count, &last);
+    if (!first) return DS_ERR_ALLOCATION_FAILED;
+
+    // the last value ends up in front, as with successive push_front calls
+    if (!fill_nodes(chain, first, last, values, count, value_size, copy, destroy, true))
+        return DS_ERR_COPY_FAILED;
+
+    if (chain->doubly_linked)
+    {
+        Node *prev_node = NULL;
+        for (Node *node = first; node != NULL; node = node->next)
+        {
+            set_prev(chain, node, prev_node);
+            prev_node = node;
+        }
+
+        if (chain->head)
+            set_prev(chain, chain->head, last);
+    }
+
+    last->next = chain->head;
+    if (!chain->head)
+        chain->tail = last;
+
+    chain->head = first;
+    if (chain->finger) chain->finger_index += count;
+    shift_shared(chain, 0, count);
+    return DS_ERR_NONE;
+}
+
+//==============================================================================
+// Get Data
+//==============================================================================
+
+enum ds_error
+ds_nc_get_front(const NodeChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    const Node *head = chain->head;
+    if (!head) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = get_data(chain, head);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_get_back(const NodeChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    const Node *tail = chain->tail;
+    if (!tail) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = get_data(chain, tail);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_get_at(NodeChain *chain, const size_t index, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    const size_t len = chain->length;
+    if (!len) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    if (index == 0) return ds_nc_get_front(chain, out);
+    if (index == len -1) return ds_nc_get_back(chain, out);
+
+    const Node *node = node_at(chain, index);
+
+    *out = get_data(chain, node);
+    return DS_ERR_NONE;
+}
+
+//==============================================================================
+// Pop Data
+//==============================================================================
+
+enum ds_error
+ds_nc_pop_front(NodeChain *chain, void **out, const ds_destructor_fn destroy)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+    if (!chain->head) return DS_ERR_EMPTY_STRUCTURE;
+
+    // a shared head leaves the chain without being copied
+    reclaim_snapshots(chain);
+
+    Node *old_head = chain->head;
+    const enum ds_error error = drop_node(chain, NULL, old_head, 0, out, destroy);
+    if (error) return error;
+
+    if (chain->finger == old_head) forget_finger(chain);
+    else if (chain->finger) chain->finger_index--;
+
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_pop_front_n(NodeChain *chain, void *out, const size_t count, const size_t value_size,
+    const ds_destructor_fn destroy, size_t *popped)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    if (popped) *popped = 0;
+    if (!count) return DS_ERR_NONE;
+    if (!chain->head) return DS_ERR_EMPTY_STRUCTURE;
+
+    const size_t total = min(count, chain->length);
+
+    // the shared nodes among them leave the chain without being copied
+    reclaim_snapshots(chain);
+
+    size_t shared_from;
+    const size_t shared_count = shared_span(chain, 0, total, &shared_from);
+    const Snapshot *snapshot = chain->snapshot;
+
+    byte *dst = (byte *)out;
+
+    if (dst && shared_count && snapshot->copy)
+    {
+        // `out` owns copies of the values the snapshot keeps, made before anything moves
+        Node *node = chain->head;
+        for (size_t i = 0; i < shared_from; i++)
+            node = node->next;
+
+        for (size_t i = 0; i < shared_count; i++, node = node->next)
+        {
+            if (snapshot->copy(dst + (shared_from + i) * value_size, get_data(chain, node))) continue;
+
+            // rollback, the current value is invalid and is not destroyed
+            if (snapshot->destroy)
+                for (size_t done = 0; done < i; done++)
+                    snapshot->destroy(dst + (shared_from + done) * value_size);
+
+            return DS_ERR_COPY_FAILED;
+        }
+    }
+
+    if (popped) *popped = total;
+
+    Node *first_shared = NULL;
+    Node *node = chain->head;
+    for (size_t i = 0; i < total; i++)
+    {
+        Node *next = node->next;
+        void *data = get_data(chain, node);
+
+        // the snapshot keeps the shared values, and reads the nodes as they are
+        const bool shared = i - shared_from < shared_count;
+        if (shared && !first_shared) first_shared = node;
+
+        if (dst && !(shared && snapshot->copy))
+            memcpy(dst + i * value_size, data, value_size); // ownership transferred to `out`
+        else if (!dst && !shared && destroy)
+            destroy(data);
+
+        if (!shared) push_slots(chain, node, node, 1);
+        node = next;
+    }
+
+    chain->head = node;
+    if (!node) chain->tail = NULL;
+    else set_prev(chain, node, NULL);
+    chain->length -= total;
+
+    if (!shared_count)
+        unshift_shared(chain, 0, total);
+    else
+    {
+        // the nodes still shared, if any, come first
+        retire_shared(chain, first_shared, shared_count);
+        chain->snapshot->shared_index = 0;
+    }
+
+    if (chain->finger && chain->finger_index < total) forget_finger(chain);
+    else if (chain->finger) chain->finger_index -= total;
+
+    trim_if_sparse(chain);
+
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_pop_back(NodeChain *chain, void **out, const ds_destructor_fn destroy)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+    if (!chain->tail) return DS_ERR_EMPTY_STRUCTURE;
+
+    // only the link before the tail is written, a shared tail is not copied
+    reclaim_snapshots(chain);
+    if (chain->length > 1)
+    {
+        const enum ds_error error = unshare_link(chain, chain->length -2);
+        if (error) return error;
+    }
+
+    Node *old_tail = chain->tail;
+    Node *tail_prev = NULL;
+
+    // if the structure still has nodes once popped
+    if (chain->head != chain->tail)
+    {
+        if (chain->doubly_linked)
+            tail_prev = get_prev(old_tail);
+        else
+        {
+            tail_prev = chain->head;
+            while (tail_prev->next != old_tail)
+                tail_prev = tail_prev->next;
+        }
+    }
+
+    const enum ds_error error = drop_node(chain, tail_prev, old_tail, chain->length -1, out, destroy);
+    if (error) return error;
+
+    if (chain->finger == old_tail) forget_finger(chain);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_pop_at(NodeChain *chain, const size_t index, void **out, const ds_destructor_fn destroy)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    const size_t len = chain->length;
+
+    if (!len) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    if (index == 0) return ds_nc_pop_front(chain, out, destroy);
+    if (index == len -1) return ds_nc_pop_back(chain, out, destroy);
+
+    // only the link before the node is written, a shared node is not copied
+    reclaim_snapshots(chain);
+    const enum ds_error error = unshare_link(chain, index -1);
+    if (error) return error;
+
+    // the finger is left on `prev_node`, which stays
+    Node *prev_node = node_at(chain, index -1);
+    return drop_node(chain, prev_node, prev_node->next, index, out, destroy);
+}
+
+
+enum ds_error
+ds_nc_pop_node(NodeChain *chain, void *data, void **out, const ds_destructor_fn destroy)
+{
+    if (!chain || !data) return DS_ERR_NULL_POINTER;
+    if (!chain->head) return DS_ERR_EMPTY_STRUCTURE;
+
+    Node *node = get_node(chain, data);
+    Node *prev_node = NULL;
+
+    if (chain->snapshot)
+    {
+        // a snapshot may read the node, its index is needed to copy it first
+        size_t index = 0;
+        Node *current = chain->head;
+        while (index < chain->length && current != node)
+        {
+            current = current->next;
+            index++;
+        }
+
+        if (index == chain->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+        return ds_nc_pop_at(chain, index, out, destroy);
+    }
+
+    if (chain->doubly_linked)
+        prev_node = get_prev(node);
+    else if (node != chain->head)
+    {
+        // singly-linked chains must search the predecessor
+        prev_node = chain->head;
+        while (prev_node->next && prev_node->next != node)
+            prev_node = prev_node->next;
+
+        if (!prev_node->next) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    // the index of the node is unknown
+    unlink_node(chain, prev_node, node);
+    forget_finger(chain);
+
+    if (!out)
+        free_node(chain, node, destroy);
+    else
+    {
+        // ownership transferred to `out`
+        *out = get_data(chain, node);
+        free_node(chain, node, NULL);
+    }
+    return DS_ERR_NONE;
+}
+
+//==============================================================================
+// Splicing
+//==============================================================================
+
+/**
+ * @brief   Moves the @p count nodes after @p prev_node (NULL for the head), the
+ * first at @p index, to the end of @p dst.
+ *
+ * @return  DS_ERR_NONE on success, or DS_ERR_ALLOCATION_FAILED /
+ * DS_ERR_COPY_FAILED, leaving both chains untouched.
+ *
+ * @details The nodes are relinked when both chains share their slots, and
+ * their payloads moved into fresh nodes of @p dst otherwise. The link of
+ * @p prev_node must be writable, so that the shared nodes among them are the
+ * first shared ones: those are retired as they are, and @p dst gets copies
+ * of their values, made before anything moves.
+ */
+static enum ds_error
+move_run(NodeChain *dst, NodeChain *src, Node *prev_node, const size_t index, const size_t count,
+    const size_t value_size)
+{
+    size_t shared_from;
+    const size_t shared_count = shared_span(src, index, count, &shared_from);
+    const Snapshot *snapshot = src->snapshot;
+
+    // all or nothing: the destination nodes are allocated before anything moves
+    const bool relink = shares_slots(dst, src);
+    const size_t fresh_count = relink ? shared_count : count;
+
+    Node *fresh = NULL;
+    Node *fresh_last = NULL;
+    if (fresh_count)
+    {
+        fresh = alloc_nodes(dst, fresh_count, &fresh_last);
+        if (!fresh) return DS_ERR_ALLOCATION_FAILED;
+    }
+
+    Node *first = prev_node ? prev_node->next : src->head;
+
+    if (shared_count)
+    {
+        Node *node = first;
+        for (size_t i = index; i < shared_from; i++)
+            node = node->next;
+
+        Node *copies = fresh;
+        if (!relink)
+            for (size_t i = index; i < shared_from; i++)
+                copies = copies->next;
+
+        Node *copy_node = copies;
+        for (size_t i = 0; i < shared_count; i++, node = node->next, copy_node = copy_node->next)
+        {
+            if (!snapshot->copy)
+            {
+                memcpy(get_data(dst, copy_node), get_data(src, node), value_size);
+                continue;
+            }
+            if (snapshot->copy(get_data(dst, copy_node), get_data(src, node))) continue;
+
+            // rollback, the current value is invalid and is not destroyed
+            if (snapshot->destroy)
+                for (Node *done = copies; done != copy_node; done = done->next)
+                    snapshot->destroy(get_data(dst, done));
+
+            push_slots(dst, fresh, fresh_last, fresh_count);
+            dst->length -= fresh_count;
+            return DS_ERR_COPY_FAILED;
+        }
+    }
+
+    // detach the run, whose payloads may move
+    invalidate_cursors(src);
+
+    Node *first_shared = NULL;
+    Node *run_first = NULL;
+    Node *run_last = NULL;
+    Node *node = first;
+    for (size_t i = 0; i < count; i++)
+    {
+        Node *next = node->next;
+        const bool shared = index + i - shared_from < shared_count;
+        Node *moved = node;
+
+        if (shared)
+        {
+            // the snapshot keeps the node, the destination gets its copy
+            if (!first_shared) first_shared = node;
+            moved = fresh;
+            fresh = fresh->next;
+        }
+        else if (!relink)
+        {
+            moved = fresh;
+            fresh = fresh->next;
+
+            memcpy(get_data(dst, moved), get_data(src, node), value_size);
+            free_node(src, node, NULL);
+        }
+        else
+        {
+            src->length--;
+            dst->length++;
+        }
+
+        set_prev(dst, moved, run_last);
+        if (run_last)
+            run_last->next = moved;
+        else
+            run_first = moved;
+
+        run_last = moved;
+        node = next;
+    }
+    run_last->next = NULL;
+
+    // `node` follows the run, its `prev` link is never read by a snapshot
+    if (prev_node)
+        prev_node->next = node;
+    else
+        src->head = node;
+
+    if (node)
+        set_prev(src, node, prev_node);
+    else
+        src->tail = prev_node;
+
+    if (src->finger && src->finger_index >= index + count)
+        src->finger_index -= count;
+    else if (src->finger && src->finger_index >= index)
+        forget_finger(src);
+
+    if (!shared_count)
+        unshift_shared(src, index, count);
+    else
+    {
+        // the nodes still shared, if any, follow `prev_node`
+        src->length -= shared_count;
+        retire_shared(src, first_shared, shared_count);
+        src->snapshot->shared_index = index;
+    }
+
+    append_run(dst, run_first, run_last);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_splice(NodeChain *dst_chain, NodeChain *src_chain, const size_t value_size)
+{
+    if (!dst_chain || !src_chain) return DS_ERR_NULL_POINTER;
+    if (dst_chain == src_chain || !src_chain->length) return DS_ERR_NONE;
+
+    // the shared nodes stay with the snapshot, only their values move
+    reclaim_snapshots(src_chain);
+    const bool shared = src_chain->snapshot && src_chain->snapshot->shared_length;
+
+    if (shared || (!shares_slots(dst_chain, src_chain) && !can_adopt_chunks(dst_chain, src_chain)))
+        return move_run(dst_chain, src_chain, NULL, 0, src_chain->length, value_size);
+
+    if (!has_shared_slots(src_chain))
+    {
+        // the chunks and the recycled slots of `src_chain` now belong to `dst_chain`
+        Chunk *last_chunk = src_chain->chunk_head;
+        while (last_chunk->next) last_chunk = last_chunk->next;
+
+        last_chunk->next = dst_chain->chunk_head;
+        dst_chain->chunk_head = src_chain->chunk_head;
+        src_chain->chunk_head = NULL;
+
+        if (src_chain->node_stack)
+        {
+            push_slots(dst_chain, src_chain->node_stack, src_chain->stack_bottom, src_chain->stack_size);
+
+            src_chain->node_stack = NULL;
+            src_chain->stack_size = 0;
+        }
+    }
+
+    append_run(dst_chain, src_chain->head, src_chain->tail);
+    dst_chain->length += src_chain->length;
+
+    src_chain->head = NULL;
+    src_chain->tail = NULL;
+    src_chain->length = 0;
+
+    forget_finger(src_chain);
+    invalidate_cursors(src_chain);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_transfer(NodeChain *dst_chain, NodeChain *src_chain, const size_t count, const size_t value_size)
+{
+    if (!dst_chain || !src_chain) return DS_ERR_NULL_POINTER;
+    if (count > src_chain->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (dst_chain == src_chain || !count) return DS_ERR_NONE;
+
+    if (count == src_chain->length)
+        return ds_nc_splice(dst_chain, src_chain, value_size);
+
+    reclaim_snapshots(src_chain);
+    return move_run(dst_chain, src_chain, NULL, 0, count, value_size);
+}
+
+
+enum ds_error
+ds_nc_split_at(NodeChain *chain, const size_t index, NodeChain *out_chain, const size_t value_size)
+{
+    if (!chain || !out_chain) return DS_ERR_NULL_POINTER;
+    if (index > chain->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (chain == out_chain || index == chain->length) return DS_ERR_NONE;
+
+    if (index == 0)
+        return ds_nc_splice(out_chain, chain, value_size);
+
+    // only the link before the split is written, the nodes kept are not copied
+    reclaim_snapshots(chain);
+    const enum ds_error error = unshare_link(chain, index -1);
+    if (error) return error;
+
+    // the finger is left on `prev_node`, which stays
+    Node *prev_node = node_at(chain, index -1);
+    return move_run(out_chain, chain, prev_node, index, chain->length - index, value_size);
+}
 
-        const void *src_value = get_data(src_chain, src_node);
-        void *dst_value = get_data(dst_chain, new_node);
+//==============================================================================
+// Snapshots
+//==============================================================================
 
-        if (!copy)
-            memcpy(dst_value, src_value, value_size);
-        else
-        {
-            if ( !copy(dst_value, src_value) )
-            {
-                // the current new node is invalid, drop it without destroying
-                free_node(dst_chain, new_node, NULL);
+enum ds_error
+unshare_nodes(NodeChain *chain, const size_t count)
+{
+    reclaim_snapshots(chain);
 
-                // rollback
-                ds_nc_clear(dst_chain, destroy, false);
-                dst_chain->head = (Node *)old_head;
-                dst_chain->tail = (Node *)old_tail;
-                dst_chain->length = old_length;
+    Snapshot *snapshot = chain->snapshot;
+    if (!snapshot || !snapshot->shared_length || count <= snapshot->shared_index)
+        return DS_ERR_NONE;
 
-                return DS_ERR_COPY_FAILED;
-            }
-        }
+    // the shared nodes up to the last one to write, the rest stays shared
+    const size_t index = snapshot->shared_index;
+    const size_t copies = min(count - index, snapshot->shared_length);
 
-        // update head in the first iteration
-        if (!dst_chain->head)
-            dst_chain->head = new_node;
-        else
-            dst_chain->tail->next = new_node;
+    Node *prev_node = index ? node_at(chain, index -1) : NULL;
+    Node *first = prev_node ? prev_node->next : chain->head;
 
-        dst_chain->tail = new_node;
+    Node *fresh_last = NULL;
+    Node *fresh = alloc_nodes(chain, copies, &fresh_last);
+    if (!fresh) return DS_ERR_ALLOCATION_FAILED;
 
-        src_node = src_node->next;
-    }
+    // the copies take the place of the shared nodes
+    chain->length -= copies;
 
-    Node *curr_node = (Node *)old_head;
-    Node *next_node = NULL;
-    while (curr_node != NULL)
+    if (!snapshot->copy)
+        copy_payloads(chain, fresh, chain, first, snapshot->value_size);
+    else
     {
-        if (destroy)
+        const Node *node = first;
+        for (Node *copied = fresh; copied != NULL; copied = copied->next, node = node->next)
         {
-            void *data_ptr = get_data(dst_chain, curr_node);
-            destroy(data_ptr);
+            if (snapshot->copy(get_data(chain, copied), get_data(chain, node))) continue;
+
+            // rollback, the current node is invalid and is not destroyed
+            if (snapshot->destroy)
+                for (Node *done = fresh; done != copied; done = done->next)
+                    snapshot->destroy(get_data(chain, done));
+
+            push_slots(chain, fresh, fresh_last, copies);
+            return DS_ERR_COPY_FAILED;
         }
+    }
 
-        next_node = curr_node->next;
+    Node *last = first;
+    for (size_t i = 1; i < copies; i++)
+        last = last->next;
 
-        curr_node->next = dst_chain->node_stack;
-        dst_chain->node_stack = curr_node;
-        dst_chain->stack_size++;
+    // the snapshot keeps reading the former run, linked to the same nodes
+    fresh_last->next = last->next;
+    if (prev_node)
+        prev_node->next = fresh;
+    else
+        chain->head = fresh;
 
-        curr_node = next_node;
+    if (chain->doubly_linked)
+    {
+        Node *prev = prev_node;
+        for (Node *node = fresh; node != fresh_last->next; node = node->next)
+        {
+            set_prev(chain, node, prev);
+            prev = node;
+        }
     }
 
+    if (fresh_last->next)
+        set_prev(chain, fresh_last->next, fresh_last);
+    else
+        chain->tail = fresh_last;
+
+    if (chain->finger && chain->finger_index >= index && chain->finger_index < index + copies)
+        forget_finger(chain);
+
+    retire_shared(chain, first, copies);
+    snapshot->shared_index += copies;
     return DS_ERR_NONE;
 }
 
-//==============================================================================
-// Utilities
-//==============================================================================
 
-size_t
-ds_nc_length(const NodeChain *chain)
+enum ds_error
+ds_nc_snapshot(NodeChain *chain, const size_t value_size, const ds_copier_fn copy,
+    const ds_destructor_fn destroy, Snapshot **out)
 {
-    if (!chain) return 0;
-    return chain->length;
-}
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
 
+    reclaim_snapshots(chain);
 
-bool
-ds_nc_is_empty(const NodeChain *chain)
-{
-    if (!chain) return true;
-    return !chain->head && !chain->tail;
-}
+    // the cursors placed so far may be on nodes the snapshot reads
+    invalidate_cursors(chain);
 
+    Snapshot *latest = chain->snapshot;
+    if (latest && latest->shared_index == 0 && latest->shared_length == chain->length
+        && latest->length == chain->length)
+    {
+        // the chain is still the latest snapshot, share it
+        atomic_fetch_add_explicit(&latest->refs, 1, memory_order_relaxed);
+        *out = latest;
+        return DS_ERR_NONE;
+    }
 
-size_t
-ds_nc_bytes(const NodeChain *chain)
-{
-    if (!chain) return 0;
+    Snapshot *snapshot = (Snapshot *) mem_alloc(&chain->allocator, sizeof(Snapshot));
+    if (!snapshot) return DS_ERR_ALLOCATION_FAILED;
 
-    size_t chunk_count = 0;
-    const Chunk *curr_chunk = chain->chunk_head;
-    while (curr_chunk != NULL)
+    // the run of the nodes to retire, so that a node leaving the chain never allocates
+    RetiredRun *run = (RetiredRun *) mem_alloc(&chain->allocator, sizeof(RetiredRun));
+    if (!run)
     {
-        chunk_count++;
-        curr_chunk = curr_chunk->next;
+        mem_free(&chain->allocator, snapshot, sizeof(Snapshot));
+        return DS_ERR_ALLOCATION_FAILED;
     }
 
-    const size_t node_stride = chain->stride;
+    run->first = NULL;
+    run->count = 0;
+    run->next = NULL;
 
-    const size_t chain_struct_size  = sizeof(NodeChain);
-    const size_t nodes_total_size   = (chain->length + chain->stack_size) * node_stride;
-    const size_t chunk_headers_size = chunk_count * node_stride;
+    // one reference for the caller, one for the chain
+    atomic_init(&snapshot->refs, 2);
 
-    return chain_struct_size + nodes_total_size + chunk_headers_size;
-}
+    snapshot->head = chain->head;
+    snapshot->tail = chain->tail;
+    snapshot->length = chain->length;
+    snapshot->offset = chain->offset;
 
-enum ds_error
-ds_nc_reverse(NodeChain *chain)
-{
-    if (!chain) return DS_ERR_NULL_POINTER;
-    if (chain->length <= 1) return DS_ERR_NONE;
+    snapshot->shared_index = 0;
+    snapshot->shared_length = chain->length;
+    snapshot->retired = run;
 
-    Node *prev_node = NULL;
-    Node *next_node = NULL;
-    Node *curr_node = chain->head;
+    snapshot->newer = NULL;
+    snapshot->next = NULL;
+    snapshot->detached = false;
 
-    while (curr_node != NULL)
+    snapshot->value_size = value_size;
+    snapshot->copy = copy;
+    snapshot->destroy = destroy;
+    snapshot->allocator = chain->allocator;
+
+    if (latest)
     {
-        next_node = curr_node->next;
-        curr_node->next = prev_node;
+        // the latest snapshot reads a part of the new one, whose nodes may be retired later
+        atomic_fetch_add_explicit(&snapshot->refs, 1, memory_order_relaxed);
+        latest->newer = snapshot;
 
-        // after the loop, prev_node points to the last processed node
-        prev_node = curr_node;
-        curr_node = next_node;
+        if (latest->retired->count)
+        {
+            // the chain keeps its reference, to take the retired runs back
+            Snapshot **link = &chain->retiring;
+            while (*link) link = &(*link)->next;
+            *link = latest;
+        }
+        else
+        {
+            free_retired(chain, latest);
+            snapshot_release(latest);
+        }
     }
 
-    chain->tail = chain->head;
-    chain->head = prev_node;
+    chain->snapshot = snapshot;
+    *out = snapshot;
     return DS_ERR_NONE;
 }
 
-//==============================================================================
-// Push Data
-//==============================================================================
 
 enum ds_error
-ds_nc_push_front(NodeChain *chain, void **out)
+ds_nc_snapshot_retain(Snapshot *snapshot)
 {
-    if (!chain || !out) return DS_ERR_NULL_POINTER;
-
-    Node *new_node = alloc_node(chain);
-    if (!new_node) return DS_ERR_ALLOCATION_FAILED;
+    if (!snapshot) return DS_ERR_NULL_POINTER;
 
-    new_node->next = chain->head;
+    atomic_fetch_add_explicit(&snapshot->refs, 1, memory_order_relaxed);
+    return DS_ERR_NONE;
+}
 
-    // empty list case, tail points to the new node
-    if (!chain->head)
-        chain->tail = new_node;
 
-    chain->head = new_node;
+enum ds_error
+ds_nc_snapshot_release(Snapshot **snapshot_ref)
+{
+    if (!snapshot_ref || !*snapshot_ref) return DS_ERR_NULL_POINTER;
 
-    *out = get_data(chain, new_node);
+    snapshot_release(*snapshot_ref);
+    *snapshot_ref = NULL;
     return DS_ERR_NONE;
 }
 
 
 enum ds_error
-ds_nc_push_back(NodeChain *chain, void **out)
+ds_nc_unshare(NodeChain *chain, const size_t index)
 {
-    if (!chain || !out) return DS_ERR_NULL_POINTER;
+    if (!chain) return DS_ERR_NULL_POINTER;
+    return unshare_node(chain, index);
+}
 
-    Node *new_node = alloc_node(chain);
-    if (!new_node) return DS_ERR_ALLOCATION_FAILED;
 
-    // empty structure case
-    if (!chain->head)
-    {
-        chain->head = new_node;
-        chain->tail = new_node;
-    }
-    // filled structure case
-    else
+size_t
+ds_nc_snapshot_length(const Snapshot *snapshot)
+{
+    if (!snapshot) return 0;
+    return snapshot->length;
+}
+
+
+enum ds_error
+ds_nc_snapshot_get_at(const Snapshot *snapshot, const size_t index, const void **out)
+{
+    if (!snapshot || !out) return DS_ERR_NULL_POINTER;
+
+    const size_t len = snapshot->length;
+    if (!len) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    // walked by count, the link after `tail` may change under the reader
+    const Node *node = snapshot->tail;
+    if (index < len -1)
     {
-        chain->tail->next = new_node;
-        chain->tail = new_node;
+        node = snapshot->head;
+        for (size_t i = 0; i < index; i++)
+            node = node->next;
     }
 
-    *out = get_data(chain, new_node);
+    *out = (const byte *)node + snapshot->offset;
     return DS_ERR_NONE;
 }
 
 
 enum ds_error
-ds_nc_push_at(NodeChain *chain, const size_t index, void **out)
+ds_nc_snapshot_begin(const Snapshot *snapshot, struct ds_nc_snapshot_cursor *cursor)
 {
-    if (!chain || !out) return DS_ERR_NULL_POINTER;
+    if (!snapshot || !cursor) return DS_ERR_NULL_POINTER;
 
-    // indices can be equal to length here, performing a `push_back()`
-    const size_t len = chain->length;
-    if (index > len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    cursor->snapshot = snapshot;
+    cursor->node = snapshot->head;
+    cursor->left = snapshot->length;
+    return DS_ERR_NONE;
+}
 
-    if (index == 0) return ds_nc_push_front(chain, out);
-    if (index == len) return ds_nc_push_back(chain, out);
 
-    Node *prev_node = chain->head;
-    for (size_t i = 0; i < index -1; i++)
-        prev_node = prev_node->next;
+enum ds_error
+ds_nc_snapshot_next(struct ds_nc_snapshot_cursor *cursor)
+{
+    if (!cursor) return DS_ERR_NULL_POINTER;
+    if (!cursor->node) return DS_ERR_INDEX_OUT_OF_BOUNDS;
 
-    Node *new_node = alloc_node(chain);
-    if (!new_node) return DS_ERR_ALLOCATION_FAILED;
+    // the last node is never followed, see ds_nc_snapshot_get_at()
+    cursor->left--;
+    cursor->node = cursor->left ? ((const Node *)cursor->node)->next : NULL;
+    return DS_ERR_NONE;
+}
 
-    new_node->next = prev_node->next;
-    prev_node->next = new_node;
 
-    *out = get_data(chain, new_node);
+enum ds_error
+ds_nc_snapshot_get(const struct ds_nc_snapshot_cursor *cursor, const void **out)
+{
+    if (!cursor || !out) return DS_ERR_NULL_POINTER;
+    if (!cursor->node) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    *out = (const byte *)cursor->node + cursor->snapshot->offset;
     return DS_ERR_NONE;
 }
 
 //==============================================================================
-// Get Data
+// Cursor
 //==============================================================================
 
-enum ds_error
-ds_nc_get_front(const NodeChain *chain, void **out)
+/**
+ * @brief   Makes the node of @p cursor writable, or only its link if @p whole_node is false.
+ *
+ * @details The index kept by the cursor is checked first, as edits made
+ * through other functions may have moved the node. The cursor then follows
+ * the copy of its node, which the finger is left on.
+ */
+static enum ds_error
+cursor_unshare(struct ds_nc_cursor *cursor, const bool whole_node)
 {
-    if (!chain || !out) return DS_ERR_NULL_POINTER;
+    NodeChain *chain = cursor->chain;
 
-    const Node *head = chain->head;
-    if (!head) return DS_ERR_EMPTY_STRUCTURE;
+    reclaim_snapshots(chain);
+    const Snapshot *snapshot = chain->snapshot;
+    if (!snapshot || !snapshot->shared_length) return DS_ERR_NONE;
 
-    *out = get_data(chain, head);
+    Node *node = (Node *)cursor->node;
+    if (cursor->index >= chain->length || node_at(chain, cursor->index) != node)
+    {
+        cursor->index = 0;
+        for (Node *current = chain->head; current != node; current = current->next)
+            cursor->index++;
+    }
+
+    const enum ds_error error = whole_node
+        ? unshare_node(chain, cursor->index)
+        : unshare_link(chain, cursor->index);
+    if (error) return error;
+
+    cursor->node = node_at(chain, cursor->index);
     return DS_ERR_NONE;
 }
 
 
 enum ds_error
-ds_nc_get_back(const NodeChain *chain, void **out)
+ds_nc_cursor_begin(NodeChain *chain, struct ds_nc_cursor *cursor)
 {
-    if (!chain || !out) return DS_ERR_NULL_POINTER;
-
-    const Node *tail = chain->tail;
-    if (!tail) return DS_ERR_EMPTY_STRUCTURE;
+    if (!chain || !cursor) return DS_ERR_NULL_POINTER;
 
-    *out = get_data(chain, tail);
+    cursor->chain = chain;
+    cursor->node = chain->head;
+    cursor->index = 0;
+    cursor->epoch = chain->epoch;
     return DS_ERR_NONE;
 }
 
 
+bool
+ds_nc_cursor_valid(const struct ds_nc_cursor *cursor)
+{
+    return cursor && cursor->node && cursor->epoch == cursor->chain->epoch;
+}
+
+
 enum ds_error
-ds_nc_get_at(const NodeChain *chain, const size_t index, void **out)
+ds_nc_cursor_next(struct ds_nc_cursor *cursor)
 {
-    if (!chain || !out) return DS_ERR_NULL_POINTER;
+    if (!cursor) return DS_ERR_NULL_POINTER;
+    if (!cursor->node) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (cursor->epoch != cursor->chain->epoch) return DS_ERR_STALE_CURSOR;
 
-    const size_t len = chain->length;
-    if (!len) return DS_ERR_EMPTY_STRUCTURE;
-    if (index >= len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    cursor->node = ((Node *)cursor->node)->next;
+    cursor->index++;
+    return DS_ERR_NONE;
+}
 
-    if (index == 0) return ds_nc_get_front(chain, out);
-    if (index == len -1) return ds_nc_get_back(chain, out);
 
-    const Node *node = chain->head;
-    for (size_t i = 0; i < index; i++)
-        node = node->next;
+enum ds_error
+ds_nc_cursor_get(const struct ds_nc_cursor *cursor, const void **out)
+{
+    if (!cursor || !out) return DS_ERR_NULL_POINTER;
+    if (!cursor->node) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (cursor->epoch != cursor->chain->epoch) return DS_ERR_STALE_CURSOR;
 
-    *out = get_data(chain, node);
+    *out = get_data(cursor->chain, (Node *)cursor->node);
     return DS_ERR_NONE;
 }
 
-//==============================================================================
-// Pop Data
-//==============================================================================
 
 enum ds_error
-ds_nc_pop_front(NodeChain *chain, void **out, const ds_destructor_fn destroy)
+ds_nc_cursor_ref(struct ds_nc_cursor *cursor, void **out)
 {
-    if (!chain) return DS_ERR_NULL_POINTER;
-    if (!chain->head) return DS_ERR_EMPTY_STRUCTURE;
-
-    Node *old_head = chain->head;
-    chain->head = old_head->next;
+    if (!cursor || !out) return DS_ERR_NULL_POINTER;
+    if (!cursor->node) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (cursor->epoch != cursor->chain->epoch) return DS_ERR_STALE_CURSOR;
 
-    // if the structure is now empty, tail must be set to NULL
-    if (!chain->head) chain->tail = NULL;
+    const enum ds_error error = cursor_unshare(cursor, true);
+    if (error) return error;
 
-    if (!out)
-        free_node(chain, old_head, destroy);
-    else
-    {
-        // ownership transferred to `out`
-        *out = get_data(chain, old_head);
-        free_node(chain, old_head, NULL);
-    }
+    *out = get_data(cursor->chain, (Node *)cursor->node);
     return DS_ERR_NONE;
 }
 
 
 enum ds_error
-ds_nc_pop_back(NodeChain *chain, void **out, const ds_destructor_fn destroy)
+ds_nc_cursor_insert_after(struct ds_nc_cursor *cursor, void **out)
 {
-    if (!chain) return DS_ERR_NULL_POINTER;
-    if (!chain->tail) return DS_ERR_EMPTY_STRUCTURE;
+    if (!cursor || !out) return DS_ERR_NULL_POINTER;
+    if (!cursor->node) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (cursor->epoch != cursor->chain->epoch) return DS_ERR_STALE_CURSOR;
 
-    Node *old_tail = chain->tail;
+    NodeChain *chain = cursor->chain;
 
-    // if the structure became empty
-    if (chain->head == chain->tail)
-    {
-        chain->head = NULL;
-        chain->tail = NULL;
-    }
-    // if the structure still has nodes
-    else
-    {
-        Node *tail_prev = chain->head;
+    enum ds_error error = cursor_unshare(cursor, false);
+    if (error) return error;
 
-        while (tail_prev->next != old_tail)
-            tail_prev = tail_prev->next;
+    Node *node = (Node *)cursor->node;
+    Node *new_node = alloc_node(chain);
+    if (!new_node) return DS_ERR_ALLOCATION_FAILED;
 
-        tail_prev->next = NULL;
-        chain->tail = tail_prev;
-    }
+    new_node->next = node->next;
+    node->next = new_node;
+    shift_shared(chain, cursor->index +1, 1);
 
-    if (!out)
-        free_node(chain, old_tail, destroy);
+    // the nodes after the cursor shift, a finger left on its own node stays right
+    if (chain->finger != node) forget_finger(chain);
+
+    set_prev(chain, new_node, node);
+    if (new_node->next)
+        set_prev(chain, new_node->next, new_node);
     else
-    {
-        // ownership transferred to `out`
-        *out = get_data(chain, old_tail);
-        free_node(chain, old_tail, NULL);
-    }
+        chain->tail = new_node;
+
+    *out = get_data(chain, new_node);
     return DS_ERR_NONE;
 }
 
 
 enum ds_error
-ds_nc_pop_at(NodeChain *chain, const size_t index, void **out, const ds_destructor_fn destroy)
+ds_nc_cursor_erase_after(struct ds_nc_cursor *cursor, void **out, const ds_destructor_fn destroy)
 {
-    if (!chain) return DS_ERR_NULL_POINTER;
-
-    const size_t len = chain->length;
-
-    if (!len) return DS_ERR_EMPTY_STRUCTURE;
-    if (index >= len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (!cursor) return DS_ERR_NULL_POINTER;
+    if (!cursor->node || !((Node *)cursor->node)->next) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+    if (cursor->epoch != cursor->chain->epoch) return DS_ERR_STALE_CURSOR;
 
-    if (index == 0) return ds_nc_pop_front(chain, out, destroy);
-    if (index == len -1) return ds_nc_pop_back(chain, out, destroy);
+    NodeChain *chain = cursor->chain;
 
-    Node *prev_node = chain->head;
-    for (size_t i = 0; i < index -1; i++)
-        prev_node = prev_node->next;
+    enum ds_error error = cursor_unshare(cursor, false);
+    if (error) return error;
 
-    Node *node = prev_node->next;
-    prev_node->next = node->next;
+    Node *prev_node = (Node *)cursor->node;
+    error = drop_node(chain, prev_node, prev_node->next, cursor->index +1, out, destroy);
+    if (error) return error;
 
-    if (!out)
-        free_node(chain, node, destroy);
-    else
-    {
-        // ownership transferred to `out`
-        *out = get_data(chain, node);
-        free_node(chain, node, NULL);
-    }
+    // the nodes after the cursor shift, a finger left on its own node stays right
+    if (chain->finger != prev_node) forget_finger(chain);
     return DS_ERR_NONE;
 }
@@ -0,0 +1,477 @@
+/**
+ * @file    nodesort.c
+ * @brief   Sorting of node chains, sequential and multi-threaded.
+ *
+ * Every sort here is a stable merge sort. The relinking sorts only rewrite
+ * the `next` links of the nodes, while the value sort gathers the payloads
+ * into a buffer, sorts it, and scatters them back into the same nodes.
+ *
+ * Multi-threaded sorts split the work in at most @ref MAX_SORT_THREADS parts,
+ * sort the parts concurrently, then merge them pairwise, one round per level
+ * of a binary tree. The calling thread always takes a share of each round,
+ * and a part whose thread could not be started runs on it too.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <threads.h>
+
+#include "libds/core.h"
+#include "libds/impl/nodechain.h"
+
+#include "internal/utils.h"
+#include "internal/node.h"
+#include "internal/allocator.h"
+
+/**
+ * @def     MAX_SORT_THREADS
+ * @brief   Upper bound on the threads of a single sort.
+ */
+#define MAX_SORT_THREADS 64
+
+/**
+ * @var     MIN_PART_LENGTH
+ * @brief   Fewest elements worth handing to a thread of its own.
+ */
+static const size_t MIN_PART_LENGTH = 4096;
+
+/**
+ * @var     INSERTION_RUN
+ * @brief   Length of the runs sorted by insertion before the array merges.
+ */
+static const size_t INSERTION_RUN = 16;
+
+/**
+ * @struct  node_task
+ * @brief   Share of a relinking sort: sorts `run`, or merges `other` into it.
+ */
+struct node_task
+{
+    const NodeChain *chain;     /**< Chain owning the nodes */
+    ds_comparator_fn cmp;       /**< Payload comparator */
+    Node *run;                  /**< NULL-terminated run, sorted in place */
+    Node *other;                /**< Later run merged into `run` (merges only) */
+};
+typedef struct node_task NodeTask;
+
+/**
+ * @struct  array_sort
+ * @brief   State shared by the shares of a value sort.
+ */
+struct array_sort
+{
+    byte *base[2];              /**< Gathered payloads, and a buffer of the same size */
+    size_t value_size;          /**< Size of a single element */
+    ds_comparator_fn cmp;       /**< Payload comparator */
+};
+typedef struct array_sort ArraySort;
+
+/**
+ * @struct  array_task
+ * @brief   Share of a value sort: a range of elements of the gathered payloads.
+ */
+struct array_task
+{
+    const ArraySort *sort;      /**< Shared state */
+    size_t start;               /**< First element of the range */
+    size_t count;               /**< Number of elements of the range */
+    size_t split;               /**< Length of the left part (merges only) */
+    int side;                   /**< Array of `base` holding the sorted range */
+    int other_side;             /**< Array holding the right part (merges only) */
+};
+typedef struct array_task ArrayTask;
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+/**
+ * @brief   Merges two sorted NULL-terminated runs, @p a holding the earlier nodes.
+ *
+ * @details Ties take the node of @p a first, which keeps the sort stable.
+ * Only the `next` links are written.
+ */
+static Node *
+merge_runs(const NodeChain *chain, Node *a, Node *b, const ds_comparator_fn cmp)
+{
+    Node *merged = NULL;
+    Node **link = &merged;
+
+    while (a && b)
+    {
+        if (cmp(get_data(chain, a), get_data(chain, b)) <= 0)
+        {
+            *link = a;
+            a = a->next;
+        }
+        else
+        {
+            *link = b;
+            b = b->next;
+        }
+        link = &(*link)->next;
+    }
+
+    *link = a ? a : b;
+    return merged;
+}
+
+/**
+ * @brief   Sorts the NULL-terminated run starting at @p node, relinking it.
+ *
+ * @details Sorted runs of 2^i nodes are merged like the digits of a binary
+ * counter, keeping the run heads in a fixed array of one slot per bit.
+ */
+static Node *
+sort_nodes(const NodeChain *chain, Node *node, const ds_comparator_fn cmp)
+{
+    // runs[i] is NULL or a sorted run of 2^i nodes, older than runs[i -1]
+    Node *runs[sizeof(size_t) * CHAR_BIT] = { NULL };
+    size_t run_count = 0;
+
+    while (node != NULL)
+    {
+        Node *next = node->next;
+        node->next = NULL;
+
+        // carry the new node up through the occupied slots
+        Node *run = node;
+        size_t i = 0;
+        for (; runs[i] != NULL; i++)
+        {
+            run = merge_runs(chain, runs[i], run, cmp);
+            runs[i] = NULL;
+        }
+        runs[i] = run;
+        run_count = max(run_count, i +1);
+
+        node = next;
+    }
+
+    Node *sorted = NULL;
+    for (size_t i = 0; i < run_count; i++)
+        if (runs[i]) sorted = merge_runs(chain, runs[i], sorted, cmp);
+
+    return sorted;
+}
+
+/**
+ * @brief   Installs the sorted run @p sorted as the nodes of @p chain.
+ *
+ * @details One pass restores the tail and the `prev` links.
+ */
+static void
+adopt_sorted(NodeChain *chain, Node *sorted)
+{
+    Node *prev_node = NULL;
+    for (Node *node = sorted; node != NULL; node = node->next)
+    {
+        set_prev(chain, node, prev_node);
+        prev_node = node;
+    }
+
+    chain->head = sorted;
+    chain->tail = prev_node;
+
+    forget_finger(chain);
+}
+
+/**
+ * @brief   Number of parts a sort of @p length elements splits into.
+ */
+static size_t
+part_count(const size_t length, const size_t threads)
+{
+    const size_t worth = max(1, length / MIN_PART_LENGTH);
+    return min(min(max(threads, 1), MAX_SORT_THREADS), worth);
+}
+
+/**
+ * @brief   Runs @p fn on @p count tasks spaced @p stride bytes apart, concurrently.
+ *
+ * @details The first task runs on the calling thread. A task whose thread
+ * cannot be started runs there too, so the result never depends on it.
+ */
+static void
+run_tasks(const thrd_start_t fn, void *tasks, const size_t stride, const size_t count)
+{
+    thrd_t threads[MAX_SORT_THREADS];
+    bool started[MAX_SORT_THREADS];
+
+    for (size_t i = 1; i < count; i++)
+    {
+        void *task = (byte *)tasks + i * stride;
+        started[i] = thrd_create(&threads[i], fn, task) == thrd_success;
+        if (!started[i]) fn(task);
+    }
+
+    fn(tasks);
+
+    for (size_t i = 1; i < count; i++)
+        if (started[i]) thrd_join(threads[i], NULL);
+}
+
+
+//==============================================================================
+// Relinking Tasks
+//==============================================================================
+
+static int
+sort_node_task(void *arg)
+{
+    NodeTask *task = (NodeTask *) arg;
+    task->run = sort_nodes(task->chain, task->run, task->cmp);
+    return 0;
+}
+
+static int
+merge_node_task(void *arg)
+{
+    NodeTask *task = (NodeTask *) arg;
+    task->run = merge_runs(task->chain, task->run, task->other, task->cmp);
+    return 0;
+}
+
+
+//==============================================================================
+// Value Tasks
+//==============================================================================
+
+static inline byte *
+element(const ArraySort *sort, const int side, const size_t index)
+{
+    return sort->base[side] + index * sort->value_size;
+}
+
+/**
+ * @brief   Merges the sorted ranges @p a and @p b into @p dst, ties taking @p a.
+ */
+static void
+merge_elements(const ArraySort *sort, const byte *a, size_t a_count, const byte *b, size_t b_count,
+    byte *dst)
+{
+    const size_t value_size = sort->value_size;
+
+    while (a_count && b_count)
+    {
+        if (sort->cmp(b, a) < 0)
+        {
+            memcpy(dst, b, value_size);
+            b += value_size;
+            b_count--;
+        }
+        else
+        {
+            memcpy(dst, a, value_size);
+            a += value_size;
+            a_count--;
+        }
+        dst += value_size;
+    }
+
+    memcpy(dst, a, a_count * value_size);
+    memcpy(dst + a_count * value_size, b, b_count * value_size);
+}
+
+/**
+ * @brief   Sorts a range of elements of `base[0]`, using `base[1]` as scratch.
+ */
+static int
+sort_array_task(void *arg)
+{
+    ArrayTask *task = (ArrayTask *) arg;
+    const ArraySort *sort = task->sort;
+    const size_t value_size = sort->value_size;
+    const size_t end = task->start + task->count;
+
+    // insertion sort of short runs, the scratch slot of `i` holds the moving element
+    for (size_t run = task->start; run < end; run += INSERTION_RUN)
+    {
+        const size_t run_end = min(run + INSERTION_RUN, end);
+        for (size_t i = run +1; i < run_end; i++)
+        {
+            byte *moving = element(sort, 1, i);
+            memcpy(moving, element(sort, 0, i), value_size);
+
+            size_t j = i;
+            while (j > run && sort->cmp(element(sort, 0, j -1), moving) > 0)
+                j--;
+
+            if (j == i) continue;
+            memmove(element(sort, 0, j +1), element(sort, 0, j), (i - j) * value_size);
+            memcpy(element(sort, 0, j), moving, value_size);
+        }
+    }
+
+    // bottom-up merges, back and forth between the two arrays
+    int side = 0;
+    for (size_t width = INSERTION_RUN; width < task->count; width *= 2)
+    {
+        for (size_t left = task->start; left < end; left += 2 * width)
+        {
+            const size_t middle = min(left + width, end);
+            const size_t right_end = min(left + 2 * width, end);
+            merge_elements(sort, element(sort, side, left), middle - left,
+                element(sort, side, middle), right_end - middle, element(sort, !side, left));
+        }
+        side = !side;
+    }
+
+    task->side = side;
+    return 0;
+}
+
+/**
+ * @brief   Merges the two sorted parts of a range into the other array.
+ */
+static int
+merge_array_task(void *arg)
+{
+    ArrayTask *task = (ArrayTask *) arg;
+    const ArraySort *sort = task->sort;
+    const size_t middle = task->start + task->split;
+
+    // both parts must be read from the same array
+    if (task->other_side != task->side)
+        memcpy(element(sort, task->side, middle), element(sort, task->other_side, middle),
+            (task->count - task->split) * sort->value_size);
+
+    merge_elements(sort, element(sort, task->side, task->start), task->split,
+        element(sort, task->side, middle), task->count - task->split,
+        element(sort, !task->side, task->start));
+
+    task->side = !task->side;
+    return 0;
+}
+
+
+//==============================================================================
+// Sorting
+//==============================================================================
+
+enum ds_error
+ds_nc_sort(NodeChain *chain, const ds_comparator_fn cmp)
+{
+    if (!chain || !cmp) return DS_ERR_NULL_POINTER;
+    if (chain->length <= 1) return DS_ERR_NONE;
+
+    const enum ds_error error = unshare(chain, chain->length);
+    if (error) return error;
+
+    adopt_sorted(chain, sort_nodes(chain, chain->head, cmp));
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_parallel_sort(NodeChain *chain, const ds_comparator_fn cmp, const size_t threads)
+{
+    if (!chain || !cmp) return DS_ERR_NULL_POINTER;
+    if (chain->length <= 1) return DS_ERR_NONE;
+
+    const size_t count = part_count(chain->length, threads);
+    if (count == 1) return ds_nc_sort(chain, cmp);
+
+    const enum ds_error error = unshare(chain, chain->length);
+    if (error) return error;
+
+    // cut the chain in `count` runs of nearly equal length
+    NodeTask tasks[MAX_SORT_THREADS];
+    Node *node = chain->head;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t length = chain->length / count + (i < chain->length % count);
+
+        tasks[i] = (NodeTask){ .chain = chain, .cmp = cmp, .run = node, .other = NULL };
+        for (size_t j = 1; j < length; j++)
+            node = node->next;
+
+        Node *next = node->next;
+        node->next = NULL;
+        node = next;
+    }
+
+    run_tasks(sort_node_task, tasks, sizeof(NodeTask), count);
+
+    // tasks[i] absorbs tasks[i + width], earlier runs first for stability
+    for (size_t width = 1; width < count; width *= 2)
+    {
+        size_t merges = 0;
+        for (size_t i = 0; i + width < count; i += 2 * width, merges++)
+            tasks[i].other = tasks[i + width].run;
+
+        run_tasks(merge_node_task, tasks, 2 * width * sizeof(NodeTask), merges);
+    }
+
+    adopt_sorted(chain, tasks[0].run);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_nc_parallel_sort_values(NodeChain *chain, const ds_comparator_fn cmp, const size_t threads,
+    const size_t value_size)
+{
+    if (!chain || !cmp) return DS_ERR_NULL_POINTER;
+    if (chain->length <= 1) return DS_ERR_NONE;
+
+    // integer overflow check, payloads plus the scratch array
+    if (chain->length > SIZE_MAX / 2 / max(value_size, 1)) return DS_ERR_ALLOCATION_FAILED;
+
+    const enum ds_error error = unshare(chain, chain->length);
+    if (error) return error;
+
+    const size_t array_size = chain->length * value_size;
+    byte *buffer = (byte *) mem_alloc(&chain->allocator, 2 * array_size);
+    if (!buffer) return DS_ERR_ALLOCATION_FAILED;
+
+    ArraySort sort = { .base = { buffer, buffer + array_size }, .value_size = value_size, .cmp = cmp };
+
+    byte *dst = buffer;
+    for (const Node *node = chain->head; node != NULL; node = node->next, dst += value_size)
+        memcpy(dst, get_data(chain, node), value_size);
+
+    const size_t count = part_count(chain->length, threads);
+    ArrayTask tasks[MAX_SORT_THREADS];
+    size_t start = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t length = chain->length / count + (i < chain->length % count);
+        tasks[i] = (ArrayTask){ .sort = &sort, .start = start, .count = length };
+        start += length;
+    }
+
+    run_tasks(sort_array_task, tasks, sizeof(ArrayTask), count);
+
+    for (size_t width = 1; width < count; width *= 2)
+    {
+        size_t merges = 0;
+        for (size_t i = 0; i + width < count; i += 2 * width, merges++)
+        {
+            tasks[i].split = tasks[i].count;
+            tasks[i].count += tasks[i + width].count;
+            tasks[i].other_side = tasks[i + width].side;
+        }
+
+        run_tasks(merge_array_task, tasks, 2 * width * sizeof(ArrayTask), merges);
+    }
+
+    // same nodes, same links: only the payloads move
+    const byte *src = element(&sort, tasks[0].side, 0);
+    for (Node *node = chain->head; node != NULL; node = node->next, src += value_size)
+        memcpy(get_data(chain, node), src, value_size);
+
+    // the finger still holds: no node moved
+    mem_free(&chain->allocator, buffer, 2 * array_size);
+    return DS_ERR_NONE;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file    pageallocator.c
+ * @brief   Allocator mapping every block straight from the OS (see ds_page_allocator()).
+ *
+ * Each block is an anonymous private mapping rounded to the page size, or to
+ * the huge page size for large blocks when requested. The rounding is a pure
+ * function of the size, so `free` recomputes the exact mapping length from the
+ * size it is given back, even when the caller grew its request with
+ * `good_size` first.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+#define _DEFAULT_SOURCE
+#define LIBDS_HAS_MMAP 1
+#endif
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "libds/core.h"
+
+#include "internal/utils.h"
+#include "internal/allocator.h"
+
+#ifdef LIBDS_HAS_MMAP
+#include <unistd.h>
+#include <sys/mman.h>
+
+/**
+ * @struct  page_config
+ * @brief   Context of a page allocator, one per combination of flags.
+ */
+struct page_config
+{
+    bool huge;      /**< Whether large mappings target huge pages */
+    bool populate;  /**< Whether pages are pre-faulted */
+};
+typedef struct page_config PageConfig;
+
+static const PageConfig configs[4] = {
+    { .huge = false, .populate = false },
+    { .huge = true,  .populate = false },
+    { .huge = false, .populate = true  },
+    { .huge = true,  .populate = true  },
+};
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+static size_t
+page_size(void)
+{
+    const long size = sysconf(_SC_PAGESIZE);
+    return size > 0 ? (size_t) size : 4096;
+}
+
+static inline bool
+is_huge(const PageConfig *config, const size_t size)
+{
+    return config->huge && size >= LIBDS_HUGE_PAGE_SIZE;
+}
+
+/**
+ * @return  Length of the mapping serving @p size bytes, or 0 on overflow.
+ */
+static size_t
+mapping_size(const PageConfig *config, const size_t size)
+{
+    const size_t granule = is_huge(config, size) ? LIBDS_HUGE_PAGE_SIZE : page_size();
+    if (size > SIZE_MAX - granule) return 0;
+
+    return align_value(max(size, 1), granule);
+}
+
+/**
+ * @brief   Maps @p length bytes aligned to LIBDS_HUGE_PAGE_SIZE.
+ *
+ * Over-maps by one huge page, then unmaps the misaligned head and the tail.
+ */
+static void *
+map_aligned(const size_t length)
+{
+    if (length > SIZE_MAX - LIBDS_HUGE_PAGE_SIZE) return NULL;
+
+    const size_t padded = length + LIBDS_HUGE_PAGE_SIZE;
+    byte *raw = (byte *) mmap(NULL, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+
+    byte *start = (byte *) align_value((uintptr_t) raw, LIBDS_HUGE_PAGE_SIZE);
+    const size_t head = (size_t)(start - raw);
+    const size_t tail = padded - head - length;
+
+    if (head) munmap(raw, head);
+    if (tail) munmap(start + length, tail);
+
+    return start;
+}
+
+
+//==============================================================================
+// Allocator Hooks
+//==============================================================================
+
+static void *
+page_alloc(void *context, const size_t size)
+{
+    const PageConfig *config = (const PageConfig *) context;
+
+    const size_t length = mapping_size(config, size);
+    if (!length) return NULL;
+
+    if (is_huge(config, size))
+    {
+        byte *block = (byte *) map_aligned(length);
+        if (!block) return NULL;
+
+#ifdef MADV_HUGEPAGE
+        madvise(block, length, MADV_HUGEPAGE);
+#endif
+        // touched after the advice, so the faults are served with huge pages
+        if (config->populate)
+            for (size_t offset = 0; offset < length; offset += page_size())
+                block[offset] = 0;
+
+        return block;
+    }
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+    if (config->populate) flags |= MAP_POPULATE;
+#endif
+
+    void *block = mmap(NULL, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return block == MAP_FAILED ? NULL : block;
+}
+
+static void
+page_free(void *context, void *ptr, const size_t size)
+{
+    munmap(ptr, mapping_size((const PageConfig *) context, size));
+}
+
+static size_t
+page_good_size(void *context, const size_t size)
+{
+    const size_t length = mapping_size((const PageConfig *) context, size);
+    return length ? length : size;
+}
+#endif //LIBDS_HAS_MMAP
+
+
+//==============================================================================
+// Page Allocator
+//==============================================================================
+
+struct ds_allocator
+ds_page_allocator(const unsigned flags)
+{
+#ifdef LIBDS_HAS_MMAP
+    const struct ds_allocator allocator = {
+        .alloc     = page_alloc,
+        .realloc   = NULL,
+        .free      = page_free,
+        .good_size = page_good_size,
+        .context   = (void *) &configs[flags & (DS_PAGES_HUGE | DS_PAGES_POPULATE)]
+    };
+    return allocator;
+#else
+    (void) flags;
+    return system_allocator;
+#endif
+}
@@ -0,0 +1,482 @@
+/**
+ * @file    ringbuffer.c
+ * @brief   Core implementation of the type-agnostic ring buffer engine.
+ *
+ * Elements live contiguously in a power-of-two array, so positions wrap with
+ * a bit mask instead of a division. The front element is at `head`, and the
+ * following ones are at `(head + i) & (capacity - 1)`.
+ *
+ * Growable buffers double their array when full. The array is reallocated in
+ * place and, if the content was wrapped around, the part from `head` to the
+ * old end is moved to the end of the new array.
+ *
+ * @warning This implementation operates entirely without direct type-safety
+ * and does NOT PROVIDE THREAD-SAFETY.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "libds/core.h"
+#include "libds/impl/ringbuffer.h"
+
+#include "internal/utils.h"
+#include "internal/allocator.h"
+
+/**
+ * @var     MIN_CAPACITY
+ * @brief   Capacity of the first array of a growable buffer.
+ */
+static const size_t MIN_CAPACITY = 8;
+
+/**
+ * @struct  ds_ring_buffer
+ * @brief   State controller for the ring buffer engine.
+ */
+struct ds_ring_buffer
+{
+    byte *data;         /**< Power-of-two array of elements (NULL until the first insertion) */
+
+    size_t head;        /**< Position of the first element */
+    size_t length;      /**< Total count of stored elements */
+    size_t capacity;    /**< Number of slots in `data` (zero or a power of two) */
+    size_t limit;       /**< Maximum number of elements, 0 if growable */
+    size_t value_size;  /**< Size of a single element */
+
+    struct ds_allocator allocator; /**< Source of the array and of the buffer itself */
+};
+typedef struct ds_ring_buffer RingBuffer;
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+static inline byte *
+slot_at(const RingBuffer *ring, const size_t i)
+{
+    return ring->data + ((ring->head + i) & (ring->capacity - 1)) * ring->value_size;
+}
+
+/**
+ * @brief   Calls @p destroy on every element.
+ */
+static void
+destroy_items(const RingBuffer *ring, const ds_destructor_fn destroy)
+{
+    for (size_t i = 0; i < ring->length; i++)
+        destroy(slot_at(ring, i));
+}
+
+/**
+ * @brief   Doubles the array, keeping the elements in order.
+ */
+static bool
+grow(RingBuffer *ring)
+{
+    const size_t old_capacity = ring->capacity;
+    const size_t new_capacity = old_capacity ? old_capacity * 2 : MIN_CAPACITY;
+    const size_t value_size = ring->value_size;
+
+    // integer overflow check
+    if (new_capacity < old_capacity || new_capacity > SIZE_MAX / value_size) return false;
+
+    byte *new_data = (byte *) mem_realloc(&ring->allocator, ring->data,
+        old_capacity * value_size, new_capacity * value_size);
+    if (!new_data) return false;
+
+    // move the wrapped part [head, old end) to the end of the new array
+    const size_t wrapped = old_capacity - ring->head;
+    if (ring->length > wrapped)
+    {
+        const size_t new_head = new_capacity - wrapped;
+        memcpy(new_data + new_head * value_size, new_data + ring->head * value_size, wrapped * value_size);
+        ring->head = new_head;
+    }
+
+    ring->data = new_data;
+    ring->capacity = new_capacity;
+    return true;
+}
+
+static RingBuffer *
+ring_alloc(const size_t value_size, const size_t value_align)
+{
+    if (!value_size || !value_align) return NULL;
+    if (value_align > alignof(max_align_t)) return NULL;
+    if (!is_power_of_two(value_align)) return NULL;
+    if (value_size % value_align != 0) return NULL;
+
+    const struct ds_allocator *allocator = ds_get_allocator();
+
+    RingBuffer *new_ring = (RingBuffer *) mem_alloc(allocator, sizeof(RingBuffer));
+    if (!new_ring) return NULL;
+
+    new_ring->allocator = *allocator;
+
+    new_ring->data = NULL;
+    new_ring->head = 0;
+    new_ring->length = 0;
+    new_ring->capacity = 0;
+    new_ring->limit = 0;
+    new_ring->value_size = value_size;
+
+    return new_ring;
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+RingBuffer *
+ds_rb_alloc(const size_t value_size, const size_t value_align)
+{
+    return ring_alloc(value_size, value_align);
+}
+
+
+RingBuffer *
+ds_rb_alloc_fixed(const size_t value_size, const size_t value_align, const size_t capacity)
+{
+    if (!capacity) return NULL;
+
+    const size_t slots = next_power_of_two(capacity);
+    if (!slots || (value_size && slots > SIZE_MAX / value_size)) return NULL;
+
+    RingBuffer *new_ring = ring_alloc(value_size, value_align);
+    if (!new_ring) return NULL;
+
+    new_ring->data = (byte *) mem_alloc(&new_ring->allocator, slots * value_size);
+    if (!new_ring->data)
+    {
+        mem_free(&new_ring->allocator, new_ring, sizeof(RingBuffer));
+        return NULL;
+    }
+
+    new_ring->capacity = slots;
+    new_ring->limit = capacity;
+    return new_ring;
+}
+
+
+enum ds_error
+ds_rb_free(RingBuffer **ring_ref, const ds_destructor_fn destroy)
+{
+    if (!ring_ref || !*ring_ref) return DS_ERR_NULL_POINTER;
+
+    if (destroy)
+        destroy_items(*ring_ref, destroy);
+
+    RingBuffer *ring = *ring_ref;
+    mem_free(&ring->allocator, ring->data, ring->capacity * ring->value_size);
+    mem_free(&ring->allocator, ring, sizeof(RingBuffer));
+    *ring_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_clear(RingBuffer *ring, const ds_destructor_fn destroy, const bool is_deep_clear)
+{
+    if (!ring) return DS_ERR_NULL_POINTER;
+
+    if (destroy)
+        destroy_items(ring, destroy);
+
+    if (is_deep_clear && !ring->limit)
+    {
+        mem_free(&ring->allocator, ring->data, ring->capacity * ring->value_size);
+        ring->data = NULL;
+        ring->capacity = 0;
+    }
+
+    ring->head = 0;
+    ring->length = 0;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_copy(RingBuffer *dst_ring, const RingBuffer *src_ring, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!dst_ring || !src_ring) return DS_ERR_NULL_POINTER;
+    if (dst_ring == src_ring) return DS_ERR_NONE;
+
+    const size_t length = src_ring->length;
+    if (dst_ring->limit && length > dst_ring->limit) return DS_ERR_FULL_STRUCTURE;
+
+    // fixed buffers keep their capacity, growable ones fit the source
+    const size_t capacity = dst_ring->limit
+        ? dst_ring->capacity
+        : max(dst_ring->capacity, next_power_of_two(max(length, MIN_CAPACITY)));
+
+    if (!capacity || capacity > SIZE_MAX / value_size) return DS_ERR_ALLOCATION_FAILED;
+
+    byte *new_data = (byte *) mem_alloc(&dst_ring->allocator, capacity * value_size);
+    if (!new_data) return DS_ERR_ALLOCATION_FAILED;
+
+    if (!copy)
+    {
+        // at most two contiguous segments in the source
+        const size_t first = min(length, src_ring->capacity - src_ring->head);
+        if (length)
+        {
+            memcpy(new_data, slot_at(src_ring, 0), first * value_size);
+            memcpy(new_data + first * value_size, src_ring->data, (length - first) * value_size);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            if ( !copy(new_data + i * value_size, slot_at(src_ring, i)) )
+            {
+                // rollback, the current slot is invalid and is not destroyed
+                if (destroy)
+                    for (size_t j = 0; j < i; j++)
+                        destroy(new_data + j * value_size);
+
+                mem_free(&dst_ring->allocator, new_data, capacity * value_size);
+                return DS_ERR_COPY_FAILED;
+            }
+        }
+    }
+
+    if (destroy)
+        destroy_items(dst_ring, destroy);
+
+    mem_free(&dst_ring->allocator, dst_ring->data, dst_ring->capacity * dst_ring->value_size);
+    dst_ring->data = new_data;
+    dst_ring->capacity = capacity;
+    dst_ring->head = 0;
+    dst_ring->length = length;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_rb_length(const RingBuffer *ring)
+{
+    if (!ring) return 0;
+    return ring->length;
+}
+
+
+size_t
+ds_rb_capacity(const RingBuffer *ring)
+{
+    if (!ring) return 0;
+    return ring->limit ? ring->limit : ring->capacity;
+}
+
+
+bool
+ds_rb_is_empty(const RingBuffer *ring)
+{
+    if (!ring) return true;
+    return ring->length == 0;
+}
+
+
+size_t
+ds_rb_bytes(const RingBuffer *ring)
+{
+    if (!ring) return 0;
+    return sizeof(RingBuffer) + ring->capacity * ring->value_size;
+}
+
+
+//==============================================================================
+// Get Data
+//==============================================================================
+
+enum ds_error
+ds_rb_get_front(const RingBuffer *ring, void **out)
+{
+    if (!ring || !out) return DS_ERR_NULL_POINTER;
+    if (!ring->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = slot_at(ring, 0);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_get_back(const RingBuffer *ring, void **out)
+{
+    if (!ring || !out) return DS_ERR_NULL_POINTER;
+    if (!ring->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = slot_at(ring, ring->length - 1);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_get_at(const RingBuffer *ring, const size_t index, void **out)
+{
+    if (!ring || !out) return DS_ERR_NULL_POINTER;
+    if (!ring->length) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= ring->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    *out = slot_at(ring, index);
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Push / Pop Data
+//==============================================================================
+
+enum ds_error
+ds_rb_push_back(RingBuffer *ring, void **out)
+{
+    if (!ring || !out) return DS_ERR_NULL_POINTER;
+
+    if (ring->limit && ring->length == ring->limit)
+        return DS_ERR_FULL_STRUCTURE;
+
+    if (ring->length == ring->capacity && !grow(ring))
+        return DS_ERR_ALLOCATION_FAILED;
+
+    *out = slot_at(ring, ring->length);
+    ring->length++;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_push_back_n(RingBuffer *ring, const void *values, const size_t count, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!ring || !values) return DS_ERR_NULL_POINTER;
+    if (!count) return DS_ERR_NONE;
+
+    if (count > SIZE_MAX - ring->length) return DS_ERR_ALLOCATION_FAILED;
+    if (ring->limit && ring->length + count > ring->limit)
+        return DS_ERR_FULL_STRUCTURE;
+
+    while (ring->capacity - ring->length < count)
+        if (!grow(ring)) return DS_ERR_ALLOCATION_FAILED;
+
+    const byte *src = (const byte *)values;
+
+    if (!copy)
+    {
+        // at most two contiguous segments in the destination
+        const size_t start = (ring->head + ring->length) & (ring->capacity - 1);
+        const size_t first = min(count, ring->capacity - start);
+
+        memcpy(ring->data + start * value_size, src, first * value_size);
+        memcpy(ring->data, src + first * value_size, (count - first) * value_size);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if ( !copy(slot_at(ring, ring->length + i), src + i * value_size) )
+            {
+                // rollback, the current slot is invalid and is not destroyed
+                if (destroy)
+                    for (size_t j = 0; j < i; j++)
+                        destroy(slot_at(ring, ring->length + j));
+
+                return DS_ERR_COPY_FAILED;
+            }
+        }
+    }
+
+    ring->length += count;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_pop_front(RingBuffer *ring, void **out, const ds_destructor_fn destroy)
+{
+    if (!ring) return DS_ERR_NULL_POINTER;
+    if (!ring->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    void *data = slot_at(ring, 0);
+
+    if (!out && destroy)
+        destroy(data);
+    else if (out)
+        *out = data; // ownership transferred to `out`
+
+    ring->head = (ring->head + 1) & (ring->capacity - 1);
+    ring->length--;
+
+    // restart from the beginning of the array, keeping accesses sequential
+    if (!ring->length) ring->head = 0;
+
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_pop_front_n(RingBuffer *ring, void *out, const size_t count, const size_t value_size,
+    const ds_destructor_fn destroy, size_t *popped)
+{
+    if (!ring) return DS_ERR_NULL_POINTER;
+
+    if (popped) *popped = 0;
+    if (!count) return DS_ERR_NONE;
+    if (!ring->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    const size_t total = min(count, ring->length);
+    if (popped) *popped = total;
+
+    if (out)
+    {
+        // ownership transferred to `out`, at most two contiguous segments
+        const size_t first = min(total, ring->capacity - ring->head);
+
+        memcpy(out, slot_at(ring, 0), first * value_size);
+        memcpy((byte *)out + first * value_size, ring->data, (total - first) * value_size);
+    }
+    else if (destroy)
+    {
+        for (size_t i = 0; i < total; i++)
+            destroy(slot_at(ring, i));
+    }
+
+    ring->head = (ring->head + total) & (ring->capacity - 1);
+    ring->length -= total;
+    if (!ring->length) ring->head = 0;
+
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_rb_pop_back(RingBuffer *ring, void **out, const ds_destructor_fn destroy)
+{
+    if (!ring) return DS_ERR_NULL_POINTER;
+    if (!ring->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    void *data = slot_at(ring, ring->length - 1);
+
+    if (!out && destroy)
+        destroy(data);
+    else if (out)
+        *out = data; // ownership transferred to `out`
+
+    ring->length--;
+    if (!ring->length) ring->head = 0;
+
+    return DS_ERR_NONE;
+}
@@ -0,0 +1,536 @@
+/**
+ * @file    segmentedstack.c
+ * @brief   Core implementation of the type-agnostic segmented stack engine.
+ *
+ * Elements are stored bottom to top in a directory of segments:
+ *      segments[0]       [ e0  e1  ...        ]  full
+ *      segments[1]       [ ...                ]  full
+ *      segments[top]     [ ... eN-1 |  free   ]  partially filled
+ *      segments[top + 1] [        free        ]  empty, kept for reuse
+ *
+ * Only the directory is ever reallocated; the segments never move, so
+ * pointers to stored elements stay valid on growth.
+ *
+ * @warning This implementation operates entirely without direct type-safety
+ * and does NOT PROVIDE THREAD-SAFETY.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "libds/core.h"
+#include "libds/impl/segmentedstack.h"
+
+#include "internal/utils.h"
+#include "internal/allocator.h"
+
+/**
+ * @var     MIN_SEGMENT_SIZE
+ * @brief   Capacity of the first segment allocated by a push.
+ */
+static const size_t MIN_SEGMENT_SIZE = 8;
+
+/**
+ * @struct  segment
+ * @brief   Contiguous array of elements, filled from its beginning.
+ */
+struct segment
+{
+    byte *data;         /**< Array of `capacity` elements */
+    size_t capacity;    /**< Number of slots in `data` */
+    size_t count;       /**< Number of used slots */
+};
+typedef struct segment Segment;
+
+/**
+ * @struct  ds_segmented_stack
+ * @brief   State controller for the segmented stack engine.
+ */
+struct ds_segmented_stack
+{
+    Segment *segments;      /**< Directory of segments, bottom first */
+    size_t segment_count;   /**< Number of allocated segments */
+    size_t directory_size;  /**< Number of entries available in `segments` */
+    size_t top;             /**< Segment holding the top element */
+
+    size_t capacity;        /**< Total count of slots over all segments */
+    size_t length;          /**< Total count of stored elements */
+    size_t value_size;      /**< Size of a single element */
+
+    struct ds_allocator allocator; /**< Source of the segments, directory and stack itself */
+};
+typedef struct ds_segmented_stack SegmentedStack;
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+/**
+ * @brief   Appends a new empty segment of @p capacity slots to the directory.
+ */
+static Segment *
+add_segment(SegmentedStack *stack, const size_t capacity)
+{
+    if (capacity > SIZE_MAX / stack->value_size) return NULL;
+
+    if (stack->segment_count == stack->directory_size)
+    {
+        const size_t new_size = max(4, stack->directory_size * 2);
+
+        Segment *directory = (Segment *) mem_realloc(&stack->allocator, stack->segments,
+            stack->directory_size * sizeof(Segment), new_size * sizeof(Segment));
+        if (!directory) return NULL;
+
+        stack->segments = directory;
+        stack->directory_size = new_size;
+    }
+
+    byte *data = (byte *) mem_alloc(&stack->allocator, capacity * stack->value_size);
+    if (!data) return NULL;
+
+    Segment *segment = &stack->segments[stack->segment_count++];
+    segment->data = data;
+    segment->capacity = capacity;
+    segment->count = 0;
+
+    stack->capacity += capacity;
+    return segment;
+}
+
+/**
+ * @brief   Frees every segment and the directory.
+ */
+static void
+free_segments(SegmentedStack *stack)
+{
+    for (size_t i = 0; i < stack->segment_count; i++)
+        mem_free(&stack->allocator, stack->segments[i].data, stack->segments[i].capacity * stack->value_size);
+
+    mem_free(&stack->allocator, stack->segments, stack->directory_size * sizeof(Segment));
+    stack->segments = NULL;
+    stack->segment_count = 0;
+    stack->directory_size = 0;
+    stack->top = 0;
+    stack->capacity = 0;
+}
+
+/**
+ * @brief   Calls @p destroy on every element, bottom to top.
+ */
+static void
+destroy_items(const SegmentedStack *stack, const ds_destructor_fn destroy)
+{
+    for (size_t i = 0; i < stack->segment_count; i++)
+    {
+        const Segment *segment = &stack->segments[i];
+        for (size_t j = 0; j < segment->count; j++)
+            destroy(segment->data + j * stack->value_size);
+    }
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+SegmentedStack *
+ds_ss_alloc(const size_t value_size, const size_t value_align)
+{
+    if (!value_size || !value_align) return NULL;
+    if (value_align > alignof(max_align_t)) return NULL;
+    if (!is_power_of_two(value_align)) return NULL;
+    if (value_size % value_align != 0) return NULL;
+
+    const struct ds_allocator *allocator = ds_get_allocator();
+
+    SegmentedStack *new_stack = (SegmentedStack *) mem_alloc(allocator, sizeof(SegmentedStack));
+    if (!new_stack) return NULL;
+
+    new_stack->allocator = *allocator;
+
+    new_stack->segments = NULL;
+    new_stack->segment_count = 0;
+    new_stack->directory_size = 0;
+    new_stack->top = 0;
+
+    new_stack->capacity = 0;
+    new_stack->length = 0;
+    new_stack->value_size = value_size;
+
+    return new_stack;
+}
+
+
+enum ds_error
+ds_ss_free(SegmentedStack **stack_ref, const ds_destructor_fn destroy)
+{
+    if (!stack_ref || !*stack_ref) return DS_ERR_NULL_POINTER;
+
+    if (destroy)
+        destroy_items(*stack_ref, destroy);
+
+    free_segments(*stack_ref);
+
+    mem_free(&(*stack_ref)->allocator, *stack_ref, sizeof(SegmentedStack));
+    *stack_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_clear(SegmentedStack *stack, const ds_destructor_fn destroy, const bool is_deep_clear)
+{
+    if (!stack) return DS_ERR_NULL_POINTER;
+
+    if (destroy)
+        destroy_items(stack, destroy);
+
+    if (is_deep_clear)
+        free_segments(stack);
+    else
+    {
+        for (size_t i = 0; i < stack->segment_count; i++)
+            stack->segments[i].count = 0;
+
+        stack->top = 0;
+    }
+
+    stack->length = 0;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_copy(SegmentedStack *dst_stack, const SegmentedStack *src_stack, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!dst_stack || !src_stack) return DS_ERR_NULL_POINTER;
+    if (dst_stack == src_stack) return DS_ERR_NONE;
+
+    if (!src_stack->length)
+        return ds_ss_clear(dst_stack, destroy, false);
+
+    const size_t length = src_stack->length;
+    if (length > SIZE_MAX / value_size) return DS_ERR_ALLOCATION_FAILED;
+
+    const struct ds_allocator *allocator = &dst_stack->allocator;
+
+    Segment *directory = (Segment *) mem_alloc(allocator, sizeof(Segment));
+    byte *data = (byte *) mem_alloc(allocator, length * value_size);
+    if (!directory || !data)
+    {
+        mem_free(allocator, directory, sizeof(Segment));
+        mem_free(allocator, data, length * value_size);
+        return DS_ERR_ALLOCATION_FAILED;
+    }
+
+    byte *dst = data;
+    for (size_t i = 0; i < src_stack->segment_count; i++)
+    {
+        const Segment *segment = &src_stack->segments[i];
+
+        if (!copy)
+        {
+            memcpy(dst, segment->data, segment->count * value_size);
+            dst += segment->count * value_size;
+            continue;
+        }
+
+        for (size_t j = 0; j < segment->count; j++, dst += value_size)
+        {
+            if ( !copy(dst, segment->data + j * value_size) )
+            {
+                // rollback, the current slot is invalid and is not destroyed
+                if (destroy)
+                    for (byte *item = data; item < dst; item += value_size)
+                        destroy(item);
+
+                mem_free(allocator, data, length * value_size);
+                mem_free(allocator, directory, sizeof(Segment));
+                return DS_ERR_COPY_FAILED;
+            }
+        }
+    }
+
+    if (destroy)
+        destroy_items(dst_stack, destroy);
+
+    free_segments(dst_stack);
+
+    directory->data = data;
+    directory->capacity = length;
+    directory->count = length;
+
+    dst_stack->segments = directory;
+    dst_stack->segment_count = 1;
+    dst_stack->directory_size = 1;
+    dst_stack->top = 0;
+    dst_stack->capacity = length;
+    dst_stack->length = length;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_reserve(SegmentedStack *stack, const size_t capacity)
+{
+    if (!stack) return DS_ERR_NULL_POINTER;
+    if (capacity <= stack->capacity) return DS_ERR_NONE;
+
+    if (!add_segment(stack, capacity - stack->capacity))
+        return DS_ERR_ALLOCATION_FAILED;
+
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_ss_length(const SegmentedStack *stack)
+{
+    if (!stack) return 0;
+    return stack->length;
+}
+
+
+size_t
+ds_ss_capacity(const SegmentedStack *stack)
+{
+    if (!stack) return 0;
+    return stack->capacity;
+}
+
+
+bool
+ds_ss_is_empty(const SegmentedStack *stack)
+{
+    if (!stack) return true;
+    return stack->length == 0;
+}
+
+
+size_t
+ds_ss_bytes(const SegmentedStack *stack)
+{
+    if (!stack) return 0;
+
+    return sizeof(SegmentedStack)
+        + stack->directory_size * sizeof(Segment)
+        + stack->capacity * stack->value_size;
+}
+
+
+//==============================================================================
+// Get Data
+//==============================================================================
+
+enum ds_error
+ds_ss_get_front(const SegmentedStack *stack, void **out)
+{
+    if (!stack || !out) return DS_ERR_NULL_POINTER;
+    if (!stack->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    const Segment *segment = &stack->segments[stack->top];
+    *out = segment->data + (segment->count - 1) * stack->value_size;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_get_back(const SegmentedStack *stack, void **out)
+{
+    if (!stack || !out) return DS_ERR_NULL_POINTER;
+    if (!stack->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = stack->segments[0].data;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_get_at(const SegmentedStack *stack, const size_t index, void **out)
+{
+    if (!stack || !out) return DS_ERR_NULL_POINTER;
+    if (!stack->length) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= stack->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    // walk down from the top segment
+    size_t depth = index;
+    const Segment *segment = &stack->segments[stack->top];
+    while (depth >= segment->count)
+    {
+        depth -= segment->count;
+        segment--;
+    }
+
+    *out = segment->data + (segment->count - 1 - depth) * stack->value_size;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Push / Pop Data
+//==============================================================================
+
+enum ds_error
+ds_ss_push_front(SegmentedStack *stack, void **out)
+{
+    if (!stack || !out) return DS_ERR_NULL_POINTER;
+
+    Segment *segment = stack->segment_count ? &stack->segments[stack->top] : NULL;
+
+    if (!segment || segment->count == segment->capacity)
+    {
+        // segments above the top are empty, reuse the next one if any
+        if (segment && stack->top + 1 < stack->segment_count)
+            segment = &stack->segments[++stack->top];
+        else
+        {
+            // geometric growth: the new segment doubles the total capacity
+            segment = add_segment(stack, max(MIN_SEGMENT_SIZE, stack->capacity));
+            if (!segment) return DS_ERR_ALLOCATION_FAILED;
+
+            stack->top = stack->segment_count - 1;
+        }
+    }
+
+    *out = segment->data + segment->count * stack->value_size;
+    segment->count++;
+    stack->length++;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_push_front_n(SegmentedStack *stack, const void *values, const size_t count, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!stack || !values) return DS_ERR_NULL_POINTER;
+    if (!count) return DS_ERR_NONE;
+
+    if (count > SIZE_MAX - stack->length) return DS_ERR_ALLOCATION_FAILED;
+
+    // a single new segment covers whatever the current ones cannot hold
+    const size_t needed = stack->length + count;
+    if (needed > stack->capacity
+        && !add_segment(stack, max(needed - stack->capacity, max(MIN_SEGMENT_SIZE, stack->capacity))))
+        return DS_ERR_ALLOCATION_FAILED;
+
+    const byte *src = (const byte *)values;
+    const size_t first_segment = stack->top;
+    const size_t first_count = stack->segment_count ? stack->segments[first_segment].count : 0;
+
+    size_t done = 0;
+    size_t index = first_segment;
+    while (done < count)
+    {
+        Segment *segment = &stack->segments[index];
+        const size_t run = min(count - done, segment->capacity - segment->count);
+        byte *dst = segment->data + segment->count * value_size;
+
+        if (!copy)
+            memcpy(dst, src + done * value_size, run * value_size);
+        else
+        {
+            for (size_t i = 0; i < run; i++)
+            {
+                if ( !copy(dst + i * value_size, src + (done + i) * value_size) )
+                {
+                    // rollback, the current slot is invalid and is not destroyed
+                    segment->count += i;
+                    for (size_t k = first_segment; k <= index; k++)
+                    {
+                        Segment *filled = &stack->segments[k];
+                        const size_t from = (k == first_segment) ? first_count : 0;
+
+                        if (destroy)
+                            for (size_t j = from; j < filled->count; j++)
+                                destroy(filled->data + j * value_size);
+
+                        filled->count = from;
+                    }
+                    return DS_ERR_COPY_FAILED;
+                }
+            }
+        }
+
+        segment->count += run;
+        done += run;
+        if (done < count) index++;
+    }
+
+    // segments before `index` are now full, `index` holds the new top
+    stack->top = index;
+    stack->length += count;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_pop_front(SegmentedStack *stack, void **out, const ds_destructor_fn destroy)
+{
+    if (!stack) return DS_ERR_NULL_POINTER;
+    if (!stack->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    Segment *segment = &stack->segments[stack->top];
+    void *data = segment->data + (segment->count - 1) * stack->value_size;
+
+    if (!out && destroy)
+        destroy(data);
+    else if (out)
+        *out = data; // ownership transferred to `out`
+
+    segment->count--;
+    stack->length--;
+
+    // keep `top` on a non-empty segment, the ones below are full
+    if (!segment->count && stack->top > 0)
+        stack->top--;
+
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_ss_pop_front_n(SegmentedStack *stack, void *out, const size_t count, const size_t value_size,
+    const ds_destructor_fn destroy, size_t *popped)
+{
+    if (!stack) return DS_ERR_NULL_POINTER;
+
+    if (popped) *popped = 0;
+    if (!count) return DS_ERR_NONE;
+    if (!stack->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    const size_t total = min(count, stack->length);
+    if (popped) *popped = total;
+
+    byte *dst = (byte *)out;
+    for (size_t i = 0; i < total; i++)
+    {
+        Segment *segment = &stack->segments[stack->top];
+        void *data = segment->data + (segment->count - 1) * value_size;
+
+        if (dst)
+            memcpy(dst + i * value_size, data, value_size); // ownership transferred to `out`
+        else if (destroy)
+            destroy(data);
+
+        segment->count--;
+        if (!segment->count && stack->top > 0)
+            stack->top--;
+    }
+
+    stack->length -= total;
+    return DS_ERR_NONE;
+}
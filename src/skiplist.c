@@ -0,0 +1,695 @@
+/**
+ * @file    skiplist.c
+ * @brief   Core implementation of the type-agnostic indexable skip list engine.
+ *
+ * Every element lives in a node carrying a tower of H forward links, H being
+ * drawn once with probability 1/4 of growing each level:
+ *      [ Node Header ]
+ *      [   Padding   ]
+ *      [ Payload     ]
+ *      [   Padding   ]
+ *      [ Height (H)  ]
+ *      [ Level 0     ]  { next, span }
+ *      [     ...     ]
+ *      [ Level H-1   ]
+ *
+ * Each link also records its span, the number of positions it skips, so a
+ * positional search adds spans top-down instead of counting nodes, as in the
+ * ranked skip lists of Pugh's cookbook. Nodes of the same height share the
+ * same size, so they come from one internal node chain per height, and get
+ * the geometric chunk allocation and node recycling of `node.c`.
+ *
+ * @note Ranks are 1-based internally (the head has rank 0), and the span of
+ * a link whose next node is NULL reaches the virtual rank `length`.
+ *
+ * @warning This implementation operates entirely without direct type-safety
+ * and does NOT PROVIDE THREAD-SAFETY.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "libds/core.h"
+#include "libds/impl/nodechain.h"
+#include "libds/impl/skiplist.h"
+
+#include "internal/utils.h"
+#include "internal/node.h"
+#include "internal/allocator.h"
+
+/**
+ * @def     SL_MAX_LEVEL
+ * @brief   Highest tower, enough for 4^32 elements at a growth probability of 1/4.
+ */
+#define SL_MAX_LEVEL 32
+
+/**
+ * @struct  level
+ * @brief   Forward link of a tower at one level.
+ */
+struct level
+{
+    Node *next;     /**< Next node reaching this level (NULL if none) */
+    size_t span;    /**< Rank distance to `next` (to `length` if NULL) */
+};
+typedef struct level Level;
+
+/**
+ * @struct  tower
+ * @brief   Height and links of a node, stored after its payload.
+ */
+struct tower
+{
+    size_t height;      /**< Number of levels (H) */
+    Level levels[];     /**< Links, from level 0 to H-1 */
+};
+typedef struct tower Tower;
+
+/**
+ * @struct  ds_skip_list
+ * @brief   State controller for the skip list engine.
+ */
+struct ds_skip_list
+{
+    Level head[SL_MAX_LEVEL];       /**< Links of the head, valid below `level` */
+    size_t level;                   /**< Number of levels in use (at least 1) */
+    size_t length;                  /**< Total count of stored elements */
+    Node *tail;                     /**< Last node (NULL if empty) */
+
+    NodeChain *pools[SL_MAX_LEVEL]; /**< Node pool of each height, created on first use */
+    size_t value_size;              /**< Size of a single element */
+    size_t region_align;            /**< Alignment of the node payload region */
+    size_t offset;                  /**< Byte offset from a node to its payload */
+    size_t tower_offset;            /**< Byte offset from a node to its tower */
+    uint64_t seed;                  /**< State of the height generator */
+
+    struct ds_allocator allocator;  /**< Source of the pools and of the list itself */
+};
+typedef struct ds_skip_list SkipList;
+
+
+//==============================================================================
+// Node Helpers
+//==============================================================================
+
+static inline Tower *
+tower_of(const SkipList *list, const Node *node)
+{
+    return (Tower *)((byte *)node + list->tower_offset);
+}
+
+static inline void *
+payload_of(const SkipList *list, const Node *node)
+{
+    return (byte *)node + list->offset;
+}
+
+/**
+ * @brief   Size of the payload region (payload + tower) of a node of @p height.
+ */
+static inline size_t
+region_size(const SkipList *list, const size_t height)
+{
+    const size_t tower_start = list->tower_offset - list->offset;
+    return align_value(tower_start + offsetof(Tower, levels) + height * sizeof(Level), list->region_align);
+}
+
+/**
+ * @brief   Draws a tower height, each level being kept with probability 1/4.
+ */
+static size_t
+random_height(SkipList *list)
+{
+    // xorshift64*
+    uint64_t x = list->seed;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    list->seed = x;
+
+    uint64_t bits = x * UINT64_C(0x2545F4914F6CDD1D);
+
+    size_t height = 1;
+    while (height < SL_MAX_LEVEL && (bits & 3) == 0)
+    {
+        height++;
+        bits >>= 2;
+    }
+    return height;
+}
+
+/**
+ * @brief   Allocates a node of @p height from the pool of that height.
+ */
+static Node *
+alloc_tower(SkipList *list, const size_t height)
+{
+    NodeChain **pool = &list->pools[height -1];
+    if (!*pool)
+    {
+        *pool = ds_nc_alloc_ex(region_size(list, height), list->region_align, &list->allocator);
+        if (!*pool) return NULL;
+    }
+
+    Node *node = alloc_node(*pool);
+    if (!node) return NULL;
+
+    tower_of(list, node)->height = height;
+    return node;
+}
+
+/**
+ * @brief   Recycles @p node into the pool of its height.
+ */
+static void
+free_tower(SkipList *list, Node *node, const ds_destructor_fn destroy)
+{
+    free_node(list->pools[tower_of(list, node)->height -1], node, destroy);
+}
+
+/**
+ * @brief   Calls @p destroy, if any, then recycles every node from @p node on.
+ */
+static void
+free_towers(SkipList *list, Node *node, const ds_destructor_fn destroy)
+{
+    while (node != NULL)
+    {
+        Node *next = tower_of(list, node)->levels[0].next;
+        free_tower(list, node, destroy);
+        node = next;
+    }
+}
+
+/**
+ * @brief   Resets the head links of an empty list.
+ */
+static void
+reset_head(SkipList *list)
+{
+    list->head[0].next = NULL;
+    list->head[0].span = 0;
+    list->level = 1;
+    list->length = 0;
+    list->tail = NULL;
+}
+
+/**
+ * @brief   Finds the last node of rank at most @p rank, top-down.
+ *
+ * @param[out] update  Optional, receives at each level the links of the last
+ *                     node of rank at most @p rank.
+ * @param[out] ranks   Receives the rank of each `update` entry (if @p update).
+ *
+ * @return  The node of rank @p rank, or NULL for rank 0 (the head).
+ */
+static Node *
+descend(const SkipList *list, const size_t rank, Level **update, size_t *ranks)
+{
+    Level *links = (Level *)list->head;
+    Node *node = NULL;
+    size_t traversed = 0;
+
+    for (size_t i = list->level; i-- > 0;)
+    {
+        while (links[i].next && traversed + links[i].span <= rank)
+        {
+            traversed += links[i].span;
+            node = links[i].next;
+            links = tower_of(list, node)->levels;
+        }
+
+        if (update)
+        {
+            update[i] = links;
+            ranks[i] = traversed;
+        }
+    }
+    return node;
+}
+
+/**
+ * @brief   Links every level of the nodes, in their level 0 order.
+ */
+static void
+rebuild_levels(SkipList *list)
+{
+    Level *last[SL_MAX_LEVEL];
+    size_t last_rank[SL_MAX_LEVEL];
+
+    for (size_t i = 0; i < SL_MAX_LEVEL; i++)
+    {
+        last[i] = list->head;
+        last_rank[i] = 0;
+    }
+
+    size_t level = 1;
+    size_t rank = 0;
+    Node *node = list->head[0].next;
+
+    while (node != NULL)
+    {
+        Tower *tower = tower_of(list, node);
+        Node *next = tower->levels[0].next;
+        rank++;
+
+        for (size_t i = 0; i < tower->height; i++)
+        {
+            last[i][i].next = node;
+            last[i][i].span = rank - last_rank[i];
+            last[i] = tower->levels;
+            last_rank[i] = rank;
+        }
+        level = max(level, tower->height);
+
+        list->tail = node;
+        node = next;
+    }
+
+    for (size_t i = 0; i < level; i++)
+    {
+        last[i][i].next = NULL;
+        last[i][i].span = rank - last_rank[i];
+    }
+
+    list->level = level;
+    list->length = rank;
+}
+
+/**
+ * @brief   Inserts a node at rank @p rank + 1, shifting the following ones.
+ */
+static void *
+insert_at(SkipList *list, const size_t rank)
+{
+    Level *update[SL_MAX_LEVEL];
+    size_t ranks[SL_MAX_LEVEL];
+    descend(list, rank, update, ranks);
+
+    const size_t height = random_height(list);
+    Node *node = alloc_tower(list, height);
+    if (!node) return NULL;
+
+    if (height > list->level)
+    {
+        for (size_t i = list->level; i < height; i++)
+        {
+            update[i] = list->head;
+            ranks[i] = 0;
+            list->head[i].next = NULL;
+            list->head[i].span = list->length;
+        }
+        list->level = height;
+    }
+
+    Level *links = tower_of(list, node)->levels;
+    for (size_t i = 0; i < height; i++)
+    {
+        links[i].next = update[i][i].next;
+        links[i].span = update[i][i].span - (ranks[0] - ranks[i]);
+
+        update[i][i].next = node;
+        update[i][i].span = ranks[0] - ranks[i] + 1;
+    }
+
+    // the higher links now skip one more position
+    for (size_t i = height; i < list->level; i++)
+        update[i][i].span++;
+
+    if (!links[0].next) list->tail = node;
+    list->length++;
+
+    return payload_of(list, node);
+}
+
+/**
+ * @brief   Removes the node of rank @p rank + 1.
+ */
+static void
+remove_at(SkipList *list, const size_t rank, void **out, const ds_destructor_fn destroy)
+{
+    Level *update[SL_MAX_LEVEL];
+    size_t ranks[SL_MAX_LEVEL];
+    Node *prev_node = descend(list, rank, update, ranks);
+
+    Node *node = prev_node ? tower_of(list, prev_node)->levels[0].next : list->head[0].next;
+    const Level *links = tower_of(list, node)->levels;
+
+    for (size_t i = 0; i < list->level; i++)
+    {
+        if (update[i][i].next == node)
+        {
+            update[i][i].span += links[i].span - 1;
+            update[i][i].next = links[i].next;
+        }
+        else
+            update[i][i].span--;
+    }
+
+    if (list->tail == node) list->tail = prev_node;
+
+    while (list->level > 1 && !list->head[list->level -1].next)
+        list->level--;
+
+    list->length--;
+
+    if (!out)
+        free_tower(list, node, destroy);
+    else
+    {
+        // ownership transferred to `out`
+        *out = payload_of(list, node);
+        free_tower(list, node, NULL);
+    }
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+SkipList *
+ds_sl_alloc(const size_t value_size, const size_t value_align)
+{
+    if (!value_size || !value_align) return NULL;
+    if (value_align > alignof(max_align_t)) return NULL;
+    if (!is_power_of_two(value_align)) return NULL;
+    if (value_size % value_align != 0) return NULL;
+
+    // integer overflow check, the tallest tower must fit
+    const size_t tower_size = offsetof(Tower, levels) + SL_MAX_LEVEL * sizeof(Level);
+    if (value_size > SIZE_MAX / 2 - tower_size) return NULL;
+
+    // node payload: [ payload ][ padding ][ height ][ levels... ]
+    const size_t region_align = max(value_align, alignof(Tower));
+    const size_t tower_start = align_value(value_size, alignof(Tower));
+
+    size_t payload_offset, node_stride;
+    if (!node_layout(align_value(tower_start + tower_size, region_align), region_align, sizeof(Node),
+            alignof(Node), &payload_offset, &node_stride))
+        return NULL;
+
+    const struct ds_allocator *allocator = ds_get_allocator();
+
+    SkipList *new_list = (SkipList *) mem_alloc(allocator, sizeof(SkipList));
+    if (!new_list) return NULL;
+
+    new_list->allocator = *allocator;
+
+    for (size_t i = 0; i < SL_MAX_LEVEL; i++)
+        new_list->pools[i] = NULL;
+
+    new_list->value_size = value_size;
+    new_list->region_align = region_align;
+    new_list->offset = payload_offset;
+    new_list->tower_offset = payload_offset + tower_start;
+    new_list->seed = UINT64_C(0x9E3779B97F4A7C15);
+
+    reset_head(new_list);
+    return new_list;
+}
+
+
+enum ds_error
+ds_sl_free(SkipList **list_ref, const ds_destructor_fn destroy)
+{
+    if (!list_ref || !*list_ref) return DS_ERR_NULL_POINTER;
+
+    SkipList *list = *list_ref;
+
+    if (destroy)
+        for (const Node *node = list->head[0].next; node != NULL; node = tower_of(list, node)->levels[0].next)
+            destroy(payload_of(list, node));
+
+    for (size_t i = 0; i < SL_MAX_LEVEL; i++)
+        if (list->pools[i]) ds_nc_free(&list->pools[i], NULL);
+
+    mem_free(&list->allocator, list, sizeof(SkipList));
+    *list_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_sl_clear(SkipList *list, const ds_destructor_fn destroy, const bool is_deep_clear)
+{
+    if (!list) return DS_ERR_NULL_POINTER;
+
+    if (is_deep_clear)
+    {
+        if (destroy)
+            for (const Node *node = list->head[0].next; node != NULL; node = tower_of(list, node)->levels[0].next)
+                destroy(payload_of(list, node));
+
+        // the pools are created again on demand
+        for (size_t i = 0; i < SL_MAX_LEVEL; i++)
+            if (list->pools[i]) ds_nc_free(&list->pools[i], NULL);
+    }
+    else
+        free_towers(list, list->head[0].next, destroy);
+
+    reset_head(list);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_sl_copy(SkipList *dst_list, const SkipList *src_list, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!dst_list || !src_list) return DS_ERR_NULL_POINTER;
+    if (dst_list == src_list) return DS_ERR_NONE;
+
+    // detach original data to allow rollback on failure
+    Node *old_first = dst_list->head[0].next;
+    SkipList old_state = *dst_list;
+    reset_head(dst_list);
+
+    enum ds_error error = DS_ERR_NONE;
+
+    // append on level 0 only, the upper levels are linked at the end
+    Node *last = NULL;
+    for (const Node *src_node = src_list->head[0].next; src_node != NULL;
+         src_node = tower_of(src_list, src_node)->levels[0].next)
+    {
+        Node *new_node = alloc_tower(dst_list, random_height(dst_list));
+        if (!new_node)
+        {
+            error = DS_ERR_ALLOCATION_FAILED;
+            break;
+        }
+
+        void *dst = payload_of(dst_list, new_node);
+        const void *src = payload_of(src_list, src_node);
+
+        if (!copy)
+            memcpy(dst, src, value_size);
+        else if (!copy(dst, src))
+        {
+            free_tower(dst_list, new_node, NULL);
+            error = DS_ERR_COPY_FAILED;
+            break;
+        }
+
+        tower_of(dst_list, new_node)->levels[0].next = NULL;
+        if (last) tower_of(dst_list, last)->levels[0].next = new_node;
+        else dst_list->head[0].next = new_node;
+        last = new_node;
+    }
+
+    if (error)
+    {
+        // rollback
+        free_towers(dst_list, dst_list->head[0].next, destroy);
+
+        memcpy(dst_list->head, old_state.head, sizeof(old_state.head));
+        dst_list->level = old_state.level;
+        dst_list->length = old_state.length;
+        dst_list->tail = old_state.tail;
+        return error;
+    }
+
+    rebuild_levels(dst_list);
+    free_towers(dst_list, old_first, destroy);
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_sl_length(const SkipList *list)
+{
+    if (!list) return 0;
+    return list->length;
+}
+
+
+bool
+ds_sl_is_empty(const SkipList *list)
+{
+    if (!list) return true;
+    return list->length == 0;
+}
+
+
+size_t
+ds_sl_bytes(const SkipList *list)
+{
+    if (!list) return 0;
+
+    size_t total_size = sizeof(SkipList);
+    for (size_t i = 0; i < SL_MAX_LEVEL; i++)
+        total_size += ds_nc_bytes(list->pools[i]);
+
+    return total_size;
+}
+
+
+enum ds_error
+ds_sl_reverse(SkipList *list)
+{
+    if (!list) return DS_ERR_NULL_POINTER;
+    if (list->length <= 1) return DS_ERR_NONE;
+
+    Node *prev_node = NULL;
+    Node *node = list->head[0].next;
+    while (node != NULL)
+    {
+        Level *links = tower_of(list, node)->levels;
+        Node *next = links[0].next;
+        links[0].next = prev_node;
+        prev_node = node;
+        node = next;
+    }
+
+    list->head[0].next = prev_node;
+    rebuild_levels(list);
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Get Data
+//==============================================================================
+
+enum ds_error
+ds_sl_get_front(const SkipList *list, void **out)
+{
+    if (!list || !out) return DS_ERR_NULL_POINTER;
+    if (!list->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = payload_of(list, list->head[0].next);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_sl_get_back(const SkipList *list, void **out)
+{
+    if (!list || !out) return DS_ERR_NULL_POINTER;
+    if (!list->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = payload_of(list, list->tail);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_sl_get_at(const SkipList *list, const size_t index, void **out)
+{
+    if (!list || !out) return DS_ERR_NULL_POINTER;
+    if (!list->length) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= list->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    *out = payload_of(list, descend(list, index +1, NULL, NULL));
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_sl_unshare(SkipList *list, const size_t index)
+{
+    (void) index;
+
+    // skip lists take no snapshot, their elements are never shared
+    if (!list) return DS_ERR_NULL_POINTER;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Push Data
+//==============================================================================
+
+enum ds_error
+ds_sl_push_front(SkipList *list, void **out)
+{
+    return ds_sl_push_at(list, 0, out);
+}
+
+
+enum ds_error
+ds_sl_push_back(SkipList *list, void **out)
+{
+    if (!list) return DS_ERR_NULL_POINTER;
+    return ds_sl_push_at(list, list->length, out);
+}
+
+
+enum ds_error
+ds_sl_push_at(SkipList *list, const size_t index, void **out)
+{
+    if (!list || !out) return DS_ERR_NULL_POINTER;
+
+    // indices can be equal to length here, performing a `push_back()`
+    if (index > list->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    void *data = insert_at(list, index);
+    if (!data) return DS_ERR_ALLOCATION_FAILED;
+
+    *out = data;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Pop Data
+//==============================================================================
+
+enum ds_error
+ds_sl_pop_front(SkipList *list, void **out, const ds_destructor_fn destroy)
+{
+    return ds_sl_pop_at(list, 0, out, destroy);
+}
+
+
+enum ds_error
+ds_sl_pop_back(SkipList *list, void **out, const ds_destructor_fn destroy)
+{
+    if (!list) return DS_ERR_NULL_POINTER;
+    if (!list->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    return ds_sl_pop_at(list, list->length -1, out, destroy);
+}
+
+
+enum ds_error
+ds_sl_pop_at(SkipList *list, const size_t index, void **out, const ds_destructor_fn destroy)
+{
+    if (!list) return DS_ERR_NULL_POINTER;
+    if (!list->length) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= list->length) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    remove_at(list, index, out, destroy);
+    return DS_ERR_NONE;
+}
@@ -0,0 +1,315 @@
+/**
+ * @file    spscring.c
+ * @brief   Core implementation of the wait-free SPSC ring engine.
+ *
+ * `head` and `tail` are free-running counters: the consumer only advances
+ * `head`, the producer only advances `tail`, and the slot of counter `i` is
+ * `i & (slots - 1)`. Their difference is the length, even after they wrap
+ * around SIZE_MAX.
+ *
+ * A slot is written before the producer publishes the new `tail` (release),
+ * and read only after the consumer observed it (acquire); the same pairing on
+ * `head` hands freed slots back to the producer.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "libds/core.h"
+#include "libds/impl/spscring.h"
+
+#include "internal/utils.h"
+
+/**
+ * @struct  ds_spsc_ring
+ * @brief   State controller for the SPSC ring engine.
+ *
+ * Each side reads its own line only, except when its cached copy of the
+ * opposite index runs out.
+ */
+struct ds_spsc_ring
+{
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic size_t head;        /**< Counter of the next element to dequeue (consumer) */
+    size_t cached_tail;         /**< Last `tail` seen by the consumer */
+
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    _Atomic size_t tail;        /**< Counter of the next slot to fill (producer) */
+    size_t cached_head;         /**< Last `head` seen by the producer */
+
+    alignas(LIBDS_CACHE_LINE_SIZE)
+    byte *data;                 /**< Power-of-two array of elements */
+    size_t mask;                /**< Number of slots minus one */
+    size_t limit;               /**< Maximum number of elements */
+    size_t value_size;          /**< Size of a single element */
+};
+typedef struct ds_spsc_ring SpscRing;
+
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+static inline byte *
+slot_at(const SpscRing *ring, const size_t counter)
+{
+    return ring->data + (counter & ring->mask) * ring->value_size;
+}
+
+/**
+ * @brief   Free room seen by the producer, reloading `head` only if needed.
+ */
+static inline size_t
+producer_room(SpscRing *ring, const size_t tail, const size_t wanted)
+{
+    size_t room = ring->limit - (tail - ring->cached_head);
+    if (room < wanted)
+    {
+        ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        room = ring->limit - (tail - ring->cached_head);
+    }
+    return room;
+}
+
+/**
+ * @brief   Elements seen by the consumer, reloading `tail` only if needed.
+ */
+static inline size_t
+consumer_ready(SpscRing *ring, const size_t head, const size_t wanted)
+{
+    size_t ready = ring->cached_tail - head;
+    if (ready < wanted)
+    {
+        ring->cached_tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        ready = ring->cached_tail - head;
+    }
+    return ready;
+}
+
+/**
+ * @brief   Copies @p count elements from the counter @p from into @p dst.
+ */
+static void
+copy_out(const SpscRing *ring, byte *dst, const size_t from, const size_t count,
+         const size_t value_size)
+{
+    // at most two contiguous segments in the source
+    const size_t start = from & ring->mask;
+    const size_t first = min(count, ring->mask + 1 - start);
+
+    memcpy(dst, ring->data + start * value_size, first * value_size);
+    memcpy(dst + first * value_size, ring->data, (count - first) * value_size);
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+SpscRing *
+ds_sr_alloc(const size_t value_size, const size_t value_align, const size_t capacity)
+{
+    if (!value_size || !value_align || !capacity) return NULL;
+    if (value_align > alignof(max_align_t)) return NULL;
+    if (!is_power_of_two(value_align)) return NULL;
+    if (value_size % value_align != 0) return NULL;
+
+    const size_t slots = next_power_of_two(capacity);
+    if (!slots || slots > SIZE_MAX / value_size) return NULL;
+
+    // the cache line alignment exceeds what malloc guarantees
+    SpscRing *ring = (SpscRing *) aligned_alloc(alignof(SpscRing),
+        align_value(sizeof(SpscRing), alignof(SpscRing)));
+    if (!ring) return NULL;
+
+    ring->data = (byte *) malloc(slots * value_size);
+    if (!ring->data)
+    {
+        free(ring);
+        return NULL;
+    }
+
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    ring->cached_head = 0;
+    ring->cached_tail = 0;
+    ring->mask = slots - 1;
+    ring->limit = capacity;
+    ring->value_size = value_size;
+
+    return ring;
+}
+
+enum ds_error
+ds_sr_free(SpscRing **ring_ref, const ds_destructor_fn destroy)
+{
+    if (!ring_ref || !*ring_ref) return DS_ERR_NULL_POINTER;
+
+    SpscRing *ring = *ring_ref;
+
+    if (destroy)
+    {
+        const size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        for (size_t i = atomic_load_explicit(&ring->head, memory_order_acquire); i != tail; i++)
+            destroy(slot_at(ring, i));
+    }
+
+    free(ring->data);
+    free(ring);
+
+    *ring_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_sr_length(const SpscRing *ring)
+{
+    if (!ring) return 0;
+
+    // `head` first: a `tail` read afterwards can only be further ahead
+    const size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    return min(tail - head, ring->limit);
+}
+
+size_t
+ds_sr_capacity(const SpscRing *ring)
+{
+    return ring ? ring->limit : 0;
+}
+
+size_t
+ds_sr_bytes(const SpscRing *ring)
+{
+    if (!ring) return 0;
+    return sizeof(SpscRing) + (ring->mask + 1) * ring->value_size;
+}
+
+bool
+ds_sr_is_empty(const SpscRing *ring)
+{
+    return ds_sr_length(ring) == 0;
+}
+
+
+//==============================================================================
+// Enqueue / Dequeue Value
+//==============================================================================
+
+enum ds_error
+ds_sr_try_enqueue(SpscRing *ring, const void *value, const ds_copier_fn copy)
+{
+    if (!ring || !value) return DS_ERR_NULL_POINTER;
+
+    const size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (!producer_room(ring, tail, 1)) return DS_ERR_FULL_STRUCTURE;
+
+    byte *data = slot_at(ring, tail);
+    if (!copy)
+        memcpy(data, value, ring->value_size);
+
+    else if (!copy(data, value))
+        return DS_ERR_COPY_FAILED;
+
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_sr_try_enqueue_n(SpscRing *ring, const void *values, const size_t count, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy, size_t *pushed)
+{
+    if (pushed) *pushed = 0;
+    if (!ring || !values) return DS_ERR_NULL_POINTER;
+    if (!count) return DS_ERR_NONE;
+
+    const size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    const size_t batch = min(count, producer_room(ring, tail, count));
+    if (!batch) return DS_ERR_FULL_STRUCTURE;
+
+    const byte *src = (const byte *)values;
+
+    if (!copy)
+    {
+        // at most two contiguous segments in the destination
+        const size_t start = tail & ring->mask;
+        const size_t first = min(batch, ring->mask + 1 - start);
+
+        memcpy(ring->data + start * value_size, src, first * value_size);
+        memcpy(ring->data, src + first * value_size, (batch - first) * value_size);
+    }
+    else
+    {
+        for (size_t i = 0; i < batch; i++)
+        {
+            if ( !copy(slot_at(ring, tail + i), src + i * value_size) )
+            {
+                // rollback, the current slot is invalid and is not destroyed
+                if (destroy)
+                    for (size_t j = 0; j < i; j++)
+                        destroy(slot_at(ring, tail + j));
+
+                return DS_ERR_COPY_FAILED;
+            }
+        }
+    }
+
+    atomic_store_explicit(&ring->tail, tail + batch, memory_order_release);
+
+    if (pushed) *pushed = batch;
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_sr_try_dequeue(SpscRing *ring, void *out)
+{
+    if (!ring || !out) return DS_ERR_NULL_POINTER;
+
+    const size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (!consumer_ready(ring, head, 1)) return DS_ERR_EMPTY_STRUCTURE;
+
+    memcpy(out, slot_at(ring, head), ring->value_size);
+
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return DS_ERR_NONE;
+}
+
+enum ds_error
+ds_sr_try_dequeue_n(SpscRing *ring, void *out, const size_t count, const size_t value_size,
+    const ds_destructor_fn destroy, size_t *popped)
+{
+    if (popped) *popped = 0;
+    if (!ring) return DS_ERR_NULL_POINTER;
+
+    const size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    const size_t ready = consumer_ready(ring, head, max(count, 1));
+    if (!ready) return DS_ERR_EMPTY_STRUCTURE;
+
+    const size_t batch = min(count, ready);
+    if (!batch) return DS_ERR_NONE;
+
+    if (out)
+        copy_out(ring, (byte *)out, head, batch, value_size);
+
+    else if (destroy)
+        for (size_t i = 0; i < batch; i++)
+            destroy(slot_at(ring, head + i));
+
+    atomic_store_explicit(&ring->head, head + batch, memory_order_release);
+
+    if (popped) *popped = batch;
+    return DS_ERR_NONE;
+}
@@ -0,0 +1,664 @@
+/**
+ * @file    unrolledchain.c
+ * @brief   Core implementation of the type-agnostic unrolled list engine.
+ *
+ * Every node of an unrolled chain holds a small array of elements:
+ *      [ Node Header ]
+ *      [ Count       ]
+ *      [   Padding   ]
+ *      [ Element 0   ]
+ *      [     ...     ]
+ *      [ Element K-1 ]
+ *
+ * The nodes themselves are managed by an internal singly-linked node chain,
+ * so they share the geometric chunk allocation and node recycling of
+ * `node.c`. Elements inside a node are kept packed at its beginning.
+ *
+ * @note The length of `chain->blocks` counts nodes, while `chain->length`
+ * counts elements.
+ *
+ * @warning This implementation operates entirely without direct type-safety
+ * and does NOT PROVIDE THREAD-SAFETY.
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdalign.h>
+
+#include "libds/core.h"
+#include "libds/impl/nodechain.h"
+#include "libds/impl/unrolledchain.h"
+
+#include "internal/utils.h"
+#include "internal/node.h"
+#include "internal/allocator.h"
+
+/**
+ * @var     MIN_BLOCK_ITEMS
+ * @brief   Lower bound on the element capacity of a node, so splits stay useful.
+ */
+static const size_t MIN_BLOCK_ITEMS = 4;
+
+/**
+ * @struct  ds_unrolled_chain
+ * @brief   State controller for the unrolled engine.
+ */
+struct ds_unrolled_chain
+{
+    NodeChain *blocks;      /**< Pool and links of the nodes (payload = count + items) */
+    void *scratch;          /**< Holds the last popped element for ownership transfer */
+
+    size_t items_offset;    /**< Byte offset from the node payload to its first element */
+    size_t value_size;      /**< Size of a single element */
+    size_t block_capacity;  /**< Maximum number of elements per node (K) */
+    size_t length;          /**< Total count of stored elements */
+
+    struct ds_allocator allocator; /**< Source of the scratch and of the chain itself */
+};
+typedef struct ds_unrolled_chain UnrolledChain;
+
+
+//==============================================================================
+// Node Helpers
+//==============================================================================
+
+static inline size_t *
+block_count(const UnrolledChain *chain, const Node *block)
+{
+    return (size_t *)get_data(chain->blocks, block);
+}
+
+static inline byte *
+block_item(const UnrolledChain *chain, const Node *block, const size_t i)
+{
+    return (byte *)get_data(chain->blocks, block) + chain->items_offset + i * chain->value_size;
+}
+
+/**
+ * @brief   Allocates an empty node and links it after @p prev (or as head if NULL).
+ */
+static Node *
+insert_block_after(UnrolledChain *chain, Node *prev)
+{
+    NodeChain *blocks = chain->blocks;
+
+    Node *block = alloc_node(blocks);
+    if (!block) return NULL;
+
+    *block_count(chain, block) = 0;
+
+    if (!prev)
+    {
+        block->next = blocks->head;
+        blocks->head = block;
+    }
+    else
+    {
+        block->next = prev->next;
+        prev->next = block;
+    }
+
+    if (blocks->tail == prev)
+        blocks->tail = block;
+
+    return block;
+}
+
+/**
+ * @brief   Unlinks @p block (whose predecessor is @p prev) and recycles it.
+ */
+static void
+remove_block(UnrolledChain *chain, Node *prev, Node *block)
+{
+    NodeChain *blocks = chain->blocks;
+
+    if (!prev)
+        blocks->head = block->next;
+    else
+        prev->next = block->next;
+
+    if (blocks->tail == block)
+        blocks->tail = prev;
+
+    free_node(blocks, block, NULL);
+}
+
+/**
+ * @brief   Finds the node holding the element at @p *index.
+ *
+ * @param[in,out] index  Global index on input, index inside the node on output.
+ * @param[out]    prev   Optional predecessor of the returned node.
+ */
+static Node *
+find_block(const UnrolledChain *chain, size_t *index, Node **prev)
+{
+    Node *prev_block = NULL;
+    Node *block = chain->blocks->head;
+
+    while (*index >= *block_count(chain, block))
+    {
+        *index -= *block_count(chain, block);
+        prev_block = block;
+        block = block->next;
+    }
+
+    if (prev) *prev = prev_block;
+    return block;
+}
+
+/**
+ * @brief   Calls @p destroy on every element of the chain.
+ */
+static void
+destroy_items(const UnrolledChain *chain, const Node *block, const ds_destructor_fn destroy)
+{
+    while (block != NULL)
+    {
+        const size_t count = *block_count(chain, block);
+        for (size_t i = 0; i < count; i++)
+            destroy(block_item(chain, block, i));
+
+        block = block->next;
+    }
+}
+
+/**
+ * @brief   Opens a gap at position @p i of a non-full node.
+ */
+static void *
+open_slot(UnrolledChain *chain, Node *block, const size_t i)
+{
+    size_t *count = block_count(chain, block);
+    byte *slot = block_item(chain, block, i);
+
+    memmove(slot + chain->value_size, slot, (*count - i) * chain->value_size);
+    (*count)++;
+    chain->length++;
+
+    return slot;
+}
+
+/**
+ * @brief   Removes the element at position @p i of @p block.
+ *
+ * @details Empty nodes are recycled, and a node that fits together with its
+ * successor in half of the capacity absorbs it.
+ */
+static void
+close_slot(UnrolledChain *chain, Node *prev, Node *block, const size_t i,
+    void **out, const ds_destructor_fn destroy)
+{
+    const size_t value_size = chain->value_size;
+    size_t *count = block_count(chain, block);
+    byte *slot = block_item(chain, block, i);
+
+    if (out)
+    {
+        // ownership transferred to `out`
+        memcpy(chain->scratch, slot, value_size);
+        *out = chain->scratch;
+    }
+    else if (destroy)
+        destroy(slot);
+
+    (*count)--;
+    chain->length--;
+    memmove(slot, slot + value_size, (*count - i) * value_size);
+
+    if (*count == 0)
+    {
+        remove_block(chain, prev, block);
+        return;
+    }
+
+    Node *next = block->next;
+    if (next && *count + *block_count(chain, next) <= chain->block_capacity / 2)
+    {
+        const size_t next_count = *block_count(chain, next);
+        memcpy(block_item(chain, block, *count), block_item(chain, next, 0), next_count * value_size);
+        *count += next_count;
+
+        remove_block(chain, block, next);
+    }
+}
+
+
+//==============================================================================
+// Life-cycle Management
+//==============================================================================
+
+UnrolledChain *
+ds_uc_alloc(const size_t value_size, const size_t value_align)
+{
+    if (!value_size || !value_align) return NULL;
+    if (value_align > alignof(max_align_t)) return NULL;
+    if (!is_power_of_two(value_align)) return NULL;
+    if (value_size % value_align != 0) return NULL;
+
+    // node payload: [ count ][ padding ][ items... ]
+    const size_t block_align = max(alignof(size_t), value_align);
+    const size_t items_offset = align_value(sizeof(size_t), value_align);
+    const size_t header_size = align_value(sizeof(Node), block_align) + items_offset;
+
+    // integer overflow check
+    if (value_size > (SIZE_MAX - header_size - LIBDS_CACHE_LINE_SIZE) / MIN_BLOCK_ITEMS)
+        return NULL;
+
+    const size_t min_bytes = align_value(header_size + MIN_BLOCK_ITEMS * value_size, LIBDS_CACHE_LINE_SIZE);
+    const size_t node_bytes = max(LIBDS_UC_NODE_BYTES, min_bytes);
+    const size_t block_capacity = (node_bytes - header_size) / value_size;
+
+    // the payload fills the node, so that the slots span whole cache lines
+    const size_t block_size = node_bytes - align_value(sizeof(Node), block_align);
+
+    const struct ds_allocator *allocator = ds_get_allocator();
+
+    UnrolledChain *new_chain = (UnrolledChain *) mem_alloc(allocator, sizeof(UnrolledChain));
+    if (!new_chain) return NULL;
+
+    new_chain->allocator = *allocator;
+    new_chain->blocks = ds_nc_alloc_ex(block_size, block_align, allocator);
+    new_chain->scratch = mem_alloc(allocator, value_size);
+
+    if (!new_chain->blocks || !new_chain->scratch)
+    {
+        if (new_chain->blocks) ds_nc_free(&new_chain->blocks, NULL);
+        mem_free(allocator, new_chain->scratch, value_size);
+        mem_free(allocator, new_chain, sizeof(UnrolledChain));
+        return NULL;
+    }
+
+    // each node starts on a cache line, see LIBDS_UC_NODE_BYTES
+    new_chain->blocks->slot_align = LIBDS_CACHE_LINE_SIZE;
+
+    new_chain->items_offset = items_offset;
+    new_chain->value_size = value_size;
+    new_chain->block_capacity = block_capacity;
+    new_chain->length = 0;
+
+    return new_chain;
+}
+
+
+enum ds_error
+ds_uc_free(UnrolledChain **chain_ref, const ds_destructor_fn destroy)
+{
+    if (!chain_ref || !*chain_ref) return DS_ERR_NULL_POINTER;
+
+    UnrolledChain *chain = *chain_ref;
+
+    if (destroy)
+        destroy_items(chain, chain->blocks->head, destroy);
+
+    ds_nc_free(&chain->blocks, NULL);
+    mem_free(&chain->allocator, chain->scratch, chain->value_size);
+
+    mem_free(&chain->allocator, chain, sizeof(UnrolledChain));
+    *chain_ref = NULL;
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_clear(UnrolledChain *chain, const ds_destructor_fn destroy, const bool is_deep_clear)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    if (destroy)
+        destroy_items(chain, chain->blocks->head, destroy);
+
+    chain->length = 0;
+    return ds_nc_clear(chain->blocks, NULL, is_deep_clear);
+}
+
+
+enum ds_error
+ds_uc_copy(UnrolledChain *dst_chain, const UnrolledChain *src_chain, const size_t value_size,
+    const ds_copier_fn copy, const ds_destructor_fn destroy)
+{
+    if (!dst_chain || !src_chain) return DS_ERR_NULL_POINTER;
+    if (dst_chain == src_chain) return DS_ERR_NONE;
+
+    NodeChain *blocks = dst_chain->blocks;
+
+    // detach original data to allow rollback on failure
+    Node *old_head = blocks->head;
+    Node *old_tail = blocks->tail;
+    const size_t old_block_count = blocks->length;
+    const size_t old_length = dst_chain->length;
+
+    blocks->head = NULL;
+    blocks->tail = NULL;
+    blocks->length = 0;
+    dst_chain->length = 0;
+
+    enum ds_error error = DS_ERR_NONE;
+
+    const Node *src_block = src_chain->blocks->head;
+    while (src_block != NULL)
+    {
+        Node *new_block = insert_block_after(dst_chain, blocks->tail);
+        if (!new_block)
+        {
+            error = DS_ERR_ALLOCATION_FAILED;
+            break;
+        }
+
+        const size_t count = *block_count(src_chain, src_block);
+
+        if (!copy)
+            memcpy(block_item(dst_chain, new_block, 0), block_item(src_chain, src_block, 0), count * value_size);
+        else
+        {
+            size_t i = 0;
+            while (i < count && copy(block_item(dst_chain, new_block, i), block_item(src_chain, src_block, i)))
+                i++;
+
+            if (i < count)
+            {
+                // keep only the successfully copied items for the rollback
+                *block_count(dst_chain, new_block) = i;
+                error = DS_ERR_COPY_FAILED;
+                break;
+            }
+        }
+
+        *block_count(dst_chain, new_block) = count;
+        dst_chain->length += count;
+
+        src_block = src_block->next;
+    }
+
+    if (error)
+    {
+        // rollback
+        if (destroy)
+            destroy_items(dst_chain, blocks->head, destroy);
+
+        ds_nc_clear(blocks, NULL, false);
+        blocks->head = old_head;
+        blocks->tail = old_tail;
+        blocks->length = old_block_count;
+        dst_chain->length = old_length;
+
+        return error;
+    }
+
+    if (destroy)
+        destroy_items(dst_chain, old_head, destroy);
+
+    // recycle the detached nodes
+    if (old_head)
+    {
+        push_slots(blocks, old_head, old_tail, old_block_count);
+    }
+
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Utilities
+//==============================================================================
+
+size_t
+ds_uc_length(const UnrolledChain *chain)
+{
+    if (!chain) return 0;
+    return chain->length;
+}
+
+
+bool
+ds_uc_is_empty(const UnrolledChain *chain)
+{
+    if (!chain) return true;
+    return chain->length == 0;
+}
+
+
+size_t
+ds_uc_bytes(const UnrolledChain *chain)
+{
+    if (!chain) return 0;
+    return sizeof(UnrolledChain) + chain->value_size + ds_nc_bytes(chain->blocks);
+}
+
+
+enum ds_error
+ds_uc_reverse(UnrolledChain *chain)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+    if (chain->length <= 1) return DS_ERR_NONE;
+
+    const size_t value_size = chain->value_size;
+
+    ds_nc_reverse(chain->blocks);
+
+    for (const Node *block = chain->blocks->head; block != NULL; block = block->next)
+    {
+        const size_t count = *block_count(chain, block);
+        for (size_t i = 0; i < count / 2; i++)
+        {
+            byte *left = block_item(chain, block, i);
+            byte *right = block_item(chain, block, count - 1 - i);
+
+            memcpy(chain->scratch, left, value_size);
+            memcpy(left, right, value_size);
+            memcpy(right, chain->scratch, value_size);
+        }
+    }
+
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Push Data
+//==============================================================================
+
+enum ds_error
+ds_uc_push_front(UnrolledChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    Node *head = chain->blocks->head;
+
+    if (!head || *block_count(chain, head) == chain->block_capacity)
+    {
+        head = insert_block_after(chain, NULL);
+        if (!head) return DS_ERR_ALLOCATION_FAILED;
+    }
+
+    *out = open_slot(chain, head, 0);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_push_back(UnrolledChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    Node *tail = chain->blocks->tail;
+
+    // full nodes are left untouched, so sequential appends keep them packed
+    if (!tail || *block_count(chain, tail) == chain->block_capacity)
+    {
+        tail = insert_block_after(chain, tail);
+        if (!tail) return DS_ERR_ALLOCATION_FAILED;
+    }
+
+    *out = open_slot(chain, tail, *block_count(chain, tail));
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_push_at(UnrolledChain *chain, const size_t index, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    // indices can be equal to length here, performing a `push_back()`
+    const size_t len = chain->length;
+    if (index > len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    if (index == 0) return ds_uc_push_front(chain, out);
+    if (index == len) return ds_uc_push_back(chain, out);
+
+    const size_t capacity = chain->block_capacity;
+
+    size_t i = index;
+    Node *prev = NULL;
+    Node *block = find_block(chain, &i, &prev);
+
+    // at a node boundary, appending to the previous node avoids shifting
+    if (i == 0 && prev && *block_count(chain, prev) < capacity)
+    {
+        *out = open_slot(chain, prev, *block_count(chain, prev));
+        return DS_ERR_NONE;
+    }
+
+    if (*block_count(chain, block) == capacity)
+    {
+        // split the full node in two halves
+        Node *half = insert_block_after(chain, block);
+        if (!half) return DS_ERR_ALLOCATION_FAILED;
+
+        const size_t keep = capacity / 2;
+        const size_t moved = capacity - keep;
+
+        memcpy(block_item(chain, half, 0), block_item(chain, block, keep), moved * chain->value_size);
+        *block_count(chain, half) = moved;
+        *block_count(chain, block) = keep;
+
+        if (i > keep)
+        {
+            block = half;
+            i -= keep;
+        }
+    }
+
+    *out = open_slot(chain, block, i);
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Get Data
+//==============================================================================
+
+enum ds_error
+ds_uc_get_front(const UnrolledChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+    if (!chain->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    *out = block_item(chain, chain->blocks->head, 0);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_get_back(const UnrolledChain *chain, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+    if (!chain->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    const Node *tail = chain->blocks->tail;
+    *out = block_item(chain, tail, *block_count(chain, tail) - 1);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_get_at(const UnrolledChain *chain, const size_t index, void **out)
+{
+    if (!chain || !out) return DS_ERR_NULL_POINTER;
+
+    const size_t len = chain->length;
+    if (!len) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    if (index == len -1) return ds_uc_get_back(chain, out);
+
+    size_t i = index;
+    const Node *block = find_block(chain, &i, NULL);
+
+    *out = block_item(chain, block, i);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_unshare(UnrolledChain *chain, const size_t index)
+{
+    (void) index;
+
+    // unrolled chains take no snapshot, their elements are never shared
+    if (!chain) return DS_ERR_NULL_POINTER;
+    return DS_ERR_NONE;
+}
+
+
+//==============================================================================
+// Pop Data
+//==============================================================================
+
+enum ds_error
+ds_uc_pop_front(UnrolledChain *chain, void **out, const ds_destructor_fn destroy)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+    if (!chain->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    close_slot(chain, NULL, chain->blocks->head, 0, out, destroy);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_pop_back(UnrolledChain *chain, void **out, const ds_destructor_fn destroy)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+    if (!chain->length) return DS_ERR_EMPTY_STRUCTURE;
+
+    Node *tail = chain->blocks->tail;
+    const size_t count = *block_count(chain, tail);
+
+    // the predecessor is only needed when the last node becomes empty
+    Node *prev = NULL;
+    if (count == 1 && chain->blocks->head != tail)
+    {
+        prev = chain->blocks->head;
+        while (prev->next != tail)
+            prev = prev->next;
+    }
+
+    close_slot(chain, prev, tail, count - 1, out, destroy);
+    return DS_ERR_NONE;
+}
+
+
+enum ds_error
+ds_uc_pop_at(UnrolledChain *chain, const size_t index, void **out, const ds_destructor_fn destroy)
+{
+    if (!chain) return DS_ERR_NULL_POINTER;
+
+    const size_t len = chain->length;
+
+    if (!len) return DS_ERR_EMPTY_STRUCTURE;
+    if (index >= len) return DS_ERR_INDEX_OUT_OF_BOUNDS;
+
+    size_t i = index;
+    Node *prev = NULL;
+    Node *block = find_block(chain, &i, &prev);
+
+    close_slot(chain, prev, block, i, out, destroy);
+    return DS_ERR_NONE;
+}
@@ -0,0 +1,587 @@
+/**
+ * @file    test_concurrentdef.c
+ * @brief   Concurrent container generator tests
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#define LIBDS_ENABLE_ERROR_PRINT 0
+#include "libds/core.h"
+
+#include "test_runner.h"
+#include "libds/concurrentdef.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+static int destroy_calls = 0;    // Tracks destroy function calls
+
+static bool copy_string(void* dst, const void* src)
+{
+    if (!dst || !src) return false;
+
+    const size_t len = strlen(*(const char**)src);
+    char* new_str = malloc(len + 1);
+    if (!new_str) return false;
+
+    memcpy(new_str, *(const char**)src, len + 1);
+    *(char**)dst = new_str;
+    return true;
+}
+
+static void destroy_string(void* data)
+{
+    if (!data) return;
+    free(*(char**)data);
+    *(char**)data = NULL;
+    destroy_calls++;
+}
+
+static double elapsed_seconds(const struct timespec* start)
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (double)(now.tv_sec - start->tv_sec) + (double)(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// ============================================================================
+// Concurrent Type Definitions (Template Instantiations)
+// ============================================================================
+
+LIBDS_DEF_CONCURRENT_QUEUE(uint64_t, ConcurrentU64, cqu, null_copy, null_destroy)
+LIBDS_DEF_CONCURRENT_QUEUE(char*,    ConcurrentStr, cqs, copy_string, destroy_string)
+
+LIBDS_DEF_SPSC_QUEUE(uint64_t, SpscU64, spu, null_copy, null_destroy)
+LIBDS_DEF_SPSC_QUEUE(char*,    SpscStr, sps, copy_string, destroy_string)
+
+LIBDS_DEF_CONCURRENT_STACK(uint64_t, StackU64, csu, null_copy, null_destroy)
+LIBDS_DEF_CONCURRENT_STACK(char*,    StackStr, css, copy_string, destroy_string)
+
+LIBDS_DEF_LIST(uint64_t, ListU64, lu, null_copy, null_destroy)
+
+// ============================================================================
+// Test Cases
+// ============================================================================
+
+static void test_concurrent_fifo(void)
+{
+    printf("\n    %-30s", "test_concurrent_fifo");
+
+    ConcurrentU64 queue = cqu_create();
+    assert(queue._nodes != NULL);
+    assert(cqu_is_empty(queue));
+
+    uint64_t value;
+    assert(cqu_dequeue(queue, &value) == DS_ERR_EMPTY_STRUCTURE);
+
+    for (uint64_t i = 0; i < 1000; i++)
+        assert(cqu_enqueue(queue, i) == DS_ERR_NONE);
+    assert(cqu_length(queue) == 1000);
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        assert(cqu_dequeue(queue, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+    assert(cqu_is_empty(queue));
+    assert(cqu_dequeue(queue, &value) == DS_ERR_EMPTY_STRUCTURE);
+
+    // the steady state recycles nodes instead of allocating
+    const size_t bytes = cqu_bytes(queue);
+    for (uint64_t round = 0; round < 100; round++) {
+        for (uint64_t i = 0; i < 500; i++) cqu_enqueue(queue, i);
+        for (uint64_t i = 0; i < 500; i++) cqu_dequeue(queue, NULL);
+    }
+    assert(cqu_bytes(queue) == bytes);
+
+    cqu_delete(&queue);
+    assert(queue._nodes == NULL);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_concurrent_ownership(void)
+{
+    printf("\n    %-30s", "test_concurrent_ownership");
+
+    destroy_calls = 0;
+    ConcurrentStr queue = cqs_create();
+
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    for (int i = 0; i < 4; i++)
+        assert(cqs_enqueue(queue, (char*)words[i]) == DS_ERR_NONE);
+
+    char* out = NULL;
+    assert(cqs_dequeue(queue, &out) == DS_ERR_NONE);
+    assert(strcmp(out, "alpha") == 0 && out != words[0] && destroy_calls == 0);
+    free(out);
+
+    assert(cqs_dequeue(queue, NULL) == DS_ERR_NONE);
+    assert(destroy_calls == 1);
+
+    // the leftovers are destroyed with the queue
+    cqs_delete(&queue);
+    assert(destroy_calls == 3);
+
+    printf(" [PASSED]\n");
+}
+
+enum { PRODUCERS = 4, CONSUMERS = 4, PER_PRODUCER = 50000 };
+
+typedef struct {
+    ConcurrentU64* queue;
+    uint64_t id;
+    uint64_t received;                  // Consumer: values dequeued
+    uint64_t sum;                       // Consumer: sum of the sequence numbers
+    bool ordered;                       // Consumer: per-producer order kept
+} Worker;
+
+static _Atomic int producers_left;
+
+static void* produce(void* arg)
+{
+    Worker* worker = arg;
+    for (uint64_t seq = 0; seq < PER_PRODUCER; seq++)
+        while (cqu_enqueue(*worker->queue, worker->id << 32 | seq) != DS_ERR_NONE) sched_yield();
+
+    atomic_fetch_sub(&producers_left, 1);
+    return NULL;
+}
+
+static void* consume(void* arg)
+{
+    Worker* worker = arg;
+    int64_t last_seen[PRODUCERS];
+    for (int i = 0; i < PRODUCERS; i++) last_seen[i] = -1;
+
+    for (;;) {
+        uint64_t value;
+        if (cqu_dequeue(*worker->queue, &value) != DS_ERR_NONE) {
+            if (atomic_load(&producers_left) == 0 && cqu_is_empty(*worker->queue)) break;
+            sched_yield();  // let the producers run on machines with few cores
+            continue;
+        }
+
+        const uint64_t producer = value >> 32;
+        const int64_t seq = (int64_t)(value & UINT32_MAX);
+
+        // a single consumer must see each producer's values in order
+        if (seq <= last_seen[producer]) worker->ordered = false;
+        last_seen[producer] = seq;
+
+        worker->received++;
+        worker->sum += (uint64_t)seq;
+    }
+    return NULL;
+}
+
+static void test_concurrent_throughput(void)
+{
+    printf("\n    %-30s", "test_concurrent_throughput");
+
+    ConcurrentU64 queue = cqu_create();
+    atomic_store(&producers_left, PRODUCERS);
+
+    Worker producers[PRODUCERS], consumers[CONSUMERS];
+    pthread_t threads[PRODUCERS + CONSUMERS];
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    for (int i = 0; i < CONSUMERS; i++) {
+        consumers[i] = (Worker){ .queue = &queue, .id = (uint64_t)i, .ordered = true };
+        assert(pthread_create(&threads[i], NULL, consume, &consumers[i]) == 0);
+    }
+    for (int i = 0; i < PRODUCERS; i++) {
+        producers[i] = (Worker){ .queue = &queue, .id = (uint64_t)i };
+        assert(pthread_create(&threads[CONSUMERS + i], NULL, produce, &producers[i]) == 0);
+    }
+    for (int i = 0; i < PRODUCERS + CONSUMERS; i++)
+        pthread_join(threads[i], NULL);
+
+    const double seconds = elapsed_seconds(&start);
+
+    uint64_t received = 0, sum = 0;
+    for (int i = 0; i < CONSUMERS; i++) {
+        assert(consumers[i].ordered);
+        received += consumers[i].received;
+        sum += consumers[i].sum;
+    }
+
+    // every value was dequeued exactly once
+    const uint64_t total = (uint64_t)PRODUCERS * PER_PRODUCER;
+    assert(received == total);
+    assert(sum == (uint64_t)PRODUCERS * PER_PRODUCER * (PER_PRODUCER - 1) / 2);
+    assert(cqu_is_empty(queue));
+
+    printf(" %.2f Mops/s", (double)total / seconds / 1e6);
+
+    cqu_delete(&queue);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_spsc_ring(void)
+{
+    printf("\n    %-30s", "test_spsc_ring");
+
+    SpscU64 queue = spu_create(100);
+    assert(queue._nodes != NULL);
+    assert(spu_capacity(queue) == 100 && spu_is_empty(queue));
+
+    uint64_t value, values[256], out[256];
+    for (uint64_t i = 0; i < 256; i++) values[i] = i;
+
+    assert(spu_dequeue(queue, &value) == DS_ERR_EMPTY_STRUCTURE);
+
+    // the bound is the requested capacity, not the power-of-two array
+    size_t pushed = 0, popped = 0;
+    assert(spu_try_enqueue_n(queue, values, 256, &pushed) == DS_ERR_NONE && pushed == 100);
+    assert(spu_enqueue(queue, 0) == DS_ERR_FULL_STRUCTURE);
+    assert(spu_try_enqueue_n(queue, values, 1, &pushed) == DS_ERR_FULL_STRUCTURE && pushed == 0);
+    assert(spu_length(queue) == 100);
+
+    assert(spu_try_dequeue_n(queue, out, 30, &popped) == DS_ERR_NONE && popped == 30);
+    for (uint64_t i = 0; i < 30; i++) assert(out[i] == i);
+
+    // wrap around the array end with both batch calls
+    uint64_t next_in = 256, next_out = 30;
+    for (int round = 0; round < 50; round++) {
+        for (uint64_t i = 0; i < 25; i++) values[i] = next_in + i;
+        assert(spu_try_enqueue_n(queue, values, 25, &pushed) == DS_ERR_NONE);
+        next_in += pushed;
+
+        assert(spu_try_dequeue_n(queue, out, 20, &popped) == DS_ERR_NONE && popped == 20);
+        for (uint64_t i = 0; i < 20; i++, next_out++)
+            assert(out[i] == (next_out < 100 ? next_out : next_out + 156));
+    }
+
+    while (spu_dequeue(queue, &value) == DS_ERR_NONE) next_out++;
+    assert(spu_is_empty(queue));
+    assert(spu_try_dequeue_n(queue, out, 1, &popped) == DS_ERR_EMPTY_STRUCTURE && popped == 0);
+
+    spu_delete(&queue);
+    assert(queue._nodes == NULL);
+
+    // ownership: failed copies are rolled back, leftovers destroyed on delete
+    destroy_calls = 0;
+    SpscStr strings = sps_create(8);
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+
+    assert(sps_try_enqueue_n(strings, (char**)words, 4, &pushed) == DS_ERR_NONE && pushed == 4);
+
+    char* text = NULL;
+    assert(sps_dequeue(strings, &text) == DS_ERR_NONE);
+    assert(strcmp(text, "alpha") == 0 && text != words[0]);
+    free(text);
+
+    assert(sps_try_dequeue_n(strings, NULL, 1, &popped) == DS_ERR_NONE && destroy_calls == 1);
+
+    sps_delete(&strings);
+    assert(destroy_calls == 3);
+
+    printf(" [PASSED]\n");
+}
+
+enum { SPSC_COUNT = 1000000, SPSC_BATCH = 64 };
+
+static void* spsc_produce(void* arg)
+{
+    SpscU64* queue = arg;
+    uint64_t batch[SPSC_BATCH];
+
+    for (uint64_t next = 0; next < SPSC_COUNT;) {
+        const uint64_t count = SPSC_COUNT - next < SPSC_BATCH ? SPSC_COUNT - next : SPSC_BATCH;
+        for (uint64_t i = 0; i < count; i++) batch[i] = next + i;
+
+        size_t pushed = 0;
+        if (spu_try_enqueue_n(*queue, batch, (size_t)count, &pushed) != DS_ERR_NONE) sched_yield();
+        next += pushed;
+    }
+    return NULL;
+}
+
+static void test_spsc_throughput(void)
+{
+    printf("\n    %-30s", "test_spsc_throughput");
+
+    SpscU64 queue = spu_create(4096);
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    pthread_t producer;
+    assert(pthread_create(&producer, NULL, spsc_produce, &queue) == 0);
+
+    // every value arrives once and in order
+    uint64_t expected = 0, out[SPSC_BATCH];
+    while (expected < SPSC_COUNT) {
+        size_t popped = 0;
+        if (spu_try_dequeue_n(queue, out, SPSC_BATCH, &popped) != DS_ERR_NONE) {
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < popped; i++) assert(out[i] == expected++);
+    }
+    pthread_join(producer, NULL);
+
+    const double seconds = elapsed_seconds(&start);
+    assert(spu_is_empty(queue));
+
+    printf(" %.2f Mops/s", (double)SPSC_COUNT / seconds / 1e6);
+
+    spu_delete(&queue);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_concurrent_stack(void)
+{
+    printf("\n    %-30s", "test_concurrent_stack");
+
+    StackU64 stack = csu_create();
+    assert(stack._nodes != NULL && csu_is_empty(stack));
+
+    uint64_t value;
+    uint64_t* all = NULL;
+    size_t count = 0;
+    assert(csu_pop(stack, &value) == DS_ERR_EMPTY_STRUCTURE);
+    assert(csu_pop_all(stack, &all, &count) == DS_ERR_EMPTY_STRUCTURE && !all && count == 0);
+
+    for (uint64_t i = 0; i < 1000; i++)
+        assert(csu_push(stack, i) == DS_ERR_NONE);
+    assert(csu_length(stack) == 1000);
+
+    for (uint64_t i = 1000; i-- > 900;) {
+        assert(csu_pop(stack, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+
+    // the batch comes top first, and the stack is left empty
+    assert(csu_pop_all(stack, &all, &count) == DS_ERR_NONE && count == 900);
+    for (size_t i = 0; i < count; i++) assert(all[i] == 899 - i);
+    free(all);
+    assert(csu_is_empty(stack));
+
+    // detached nodes are recycled
+    const size_t bytes = csu_bytes(stack);
+    for (uint64_t i = 0; i < 1000; i++) csu_push(stack, i);
+    assert(csu_bytes(stack) == bytes);
+
+    csu_delete(&stack);
+    assert(stack._nodes == NULL);
+
+    // ownership: pop_all without an array destroys the elements
+    destroy_calls = 0;
+    StackStr strings = css_create();
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    for (int i = 0; i < 4; i++)
+        assert(css_push(strings, (char*)words[i]) == DS_ERR_NONE);
+
+    char* text = NULL;
+    assert(css_pop(strings, &text) == DS_ERR_NONE);
+    assert(strcmp(text, "delta") == 0 && text != words[3]);
+    free(text);
+
+    assert(css_pop_all(strings, NULL, &count) == DS_ERR_NONE && count == 3);
+    assert(destroy_calls == 3 && css_is_empty(strings));
+
+    css_push(strings, "kept");
+    css_delete(&strings);
+    assert(destroy_calls == 4);
+
+    printf(" [PASSED]\n");
+}
+
+enum { STACK_THREADS = 4, STACK_ITEMS = 64, STACK_ROUNDS = 50000 };
+
+static void* recycle_items(void* arg)
+{
+    StackU64* stack = arg;
+    for (int round = 0; round < STACK_ROUNDS; round++) {
+        uint64_t item;
+        if (csu_pop(*stack, &item) != DS_ERR_NONE) {
+            sched_yield();
+            continue;
+        }
+        while (csu_push(*stack, item) != DS_ERR_NONE) sched_yield();
+    }
+    return NULL;
+}
+
+typedef struct {
+    StackU64* stack;
+    uint64_t id;
+} Pusher;
+
+static void* push_items(void* arg)
+{
+    Pusher* pusher = arg;
+    for (uint64_t seq = 0; seq < PER_PRODUCER; seq++)
+        while (csu_push(*pusher->stack, pusher->id * PER_PRODUCER + seq) != DS_ERR_NONE)
+            sched_yield();
+
+    atomic_fetch_sub(&producers_left, 1);
+    return NULL;
+}
+
+static void test_concurrent_stack_threads(void)
+{
+    printf("\n    %-30s", "test_concurrent_stack_threads");
+
+    // shared free-list: items circulate between threads and none is lost or duplicated
+    StackU64 stack = csu_create();
+    for (uint64_t i = 0; i < STACK_ITEMS; i++) csu_push(stack, i);
+
+    pthread_t threads[STACK_THREADS];
+    for (int i = 0; i < STACK_THREADS; i++)
+        assert(pthread_create(&threads[i], NULL, recycle_items, &stack) == 0);
+    for (int i = 0; i < STACK_THREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    uint64_t* all = NULL;
+    size_t count = 0;
+    bool seen[STACK_ITEMS] = { false };
+    assert(csu_pop_all(stack, &all, &count) == DS_ERR_NONE && count == STACK_ITEMS);
+    for (size_t i = 0; i < count; i++) {
+        assert(all[i] < STACK_ITEMS && !seen[all[i]]);
+        seen[all[i]] = true;
+    }
+    free(all);
+
+    // batch consumer: pop_all races with the producers and still gets every value once
+    const size_t total = (size_t)PRODUCERS * PER_PRODUCER;
+    bool* received = calloc(total, sizeof(bool));
+    assert(received != NULL);
+
+    Pusher producers[PRODUCERS];
+    atomic_store(&producers_left, PRODUCERS);
+    for (int i = 0; i < PRODUCERS; i++) {
+        producers[i] = (Pusher){ .stack = &stack, .id = (uint64_t)i };
+        assert(pthread_create(&threads[i], NULL, push_items, &producers[i]) == 0);
+    }
+
+    size_t collected = 0;
+    for (;;) {
+        const bool done = atomic_load(&producers_left) == 0;
+        if (csu_pop_all(stack, &all, &count) == DS_ERR_NONE) {
+            for (size_t i = 0; i < count; i++) {
+                assert(all[i] < total && !received[all[i]]);
+                received[all[i]] = true;
+            }
+            collected += count;
+            free(all);
+        }
+        else if (done) break;
+        else sched_yield();
+    }
+    for (int i = 0; i < PRODUCERS; i++)
+        pthread_join(threads[i], NULL);
+
+    assert(collected == total);
+    free(received);
+
+    csu_delete(&stack);
+
+    printf(" [PASSED]\n");
+}
+
+enum { CACHED_THREADS = 4, CACHED_ITEMS = 2000, CACHED_ROUNDS = 20 };
+
+typedef struct {
+    ListU64* list;
+    uint64_t id;
+} Builder;
+
+static void* build_list(void* arg)
+{
+    Builder* builder = arg;
+
+    // churn through the thread magazines before leaving the final content
+    for (int round = 0; round < CACHED_ROUNDS; round++) {
+        for (uint64_t i = 0; i < CACHED_ITEMS; i++)
+            assert(lu_append(*builder->list, builder->id * CACHED_ITEMS + i) == DS_ERR_NONE);
+        if (round + 1 < CACHED_ROUNDS)
+            assert(lu_clear(*builder->list) == DS_ERR_NONE);
+    }
+    return NULL;
+}
+
+static void test_cached_lists_threads(void)
+{
+    printf("\n    %-30s", "test_cached_lists_threads");
+
+    // lists filled by worker threads are read and freed by this one
+    ListU64 l0 = lu_create_cached(), l1 = lu_create_cached();
+    ListU64 l2 = lu_create_cached(), l3 = lu_create_cached();
+    ListU64* lists[CACHED_THREADS] = { &l0, &l1, &l2, &l3 };
+
+    Builder builders[CACHED_THREADS];
+    pthread_t threads[CACHED_THREADS];
+
+    for (int i = 0; i < CACHED_THREADS; i++) {
+        builders[i] = (Builder){ .list = lists[i], .id = (uint64_t)i };
+        assert(pthread_create(&threads[i], NULL, build_list, &builders[i]) == 0);
+    }
+    for (int i = 0; i < CACHED_THREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    for (int i = 0; i < CACHED_THREADS; i++) {
+        assert(lu_length(*lists[i]) == CACHED_ITEMS);
+
+        uint64_t value;
+        for (uint64_t k = 0; k < CACHED_ITEMS; k++) {
+            assert(lu_pop_front(*lists[i], &value) == DS_ERR_NONE);
+            assert(value == (uint64_t)i * CACHED_ITEMS + k);
+        }
+        lu_delete(lists[i]);
+    }
+
+    // the magazines of the exited threads went back to the depot
+    struct ds_cache_stats before, after;
+    ListU64 list = lu_create_cached();
+    assert(lu_cache_stats(list, &before) == DS_ERR_NONE);
+
+    for (uint64_t i = 0; i < CACHED_ITEMS; i++) assert(lu_append(list, i) == DS_ERR_NONE);
+
+    assert(lu_cache_stats(list, &after) == DS_ERR_NONE);
+    assert(after.alloc_hits + after.alloc_misses - before.alloc_hits - before.alloc_misses == CACHED_ITEMS);
+    lu_delete(&list);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_concurrentdef_tests(void)
+{
+    printf("\n+------------------------------------------------------+");
+    printf("\n|               'concurrentdef' Test Suite             |");
+    printf("\n+------------------------------------------------------+");
+
+    test_concurrent_fifo();
+    test_concurrent_ownership();
+    test_concurrent_throughput();
+    test_spsc_ring();
+    test_spsc_throughput();
+    test_concurrent_stack();
+    test_concurrent_stack_threads();
+    test_cached_lists_threads();
+
+    printf("\n+------------------------------------------------------+");
+    printf("\n|                    ALL TESTS PASSED                  |");
+    printf("\n+------------------------------------------------------+\n");
+}
@@ -0,0 +1,325 @@
+/**
+ * @file    test_indexedlistdef.c
+ * @brief   Indexed list generator tests
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <assert.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIBDS_ENABLE_ERROR_PRINT 0
+#include "libds/core.h"
+
+#include "test_runner.h"
+#include "libds/indexedlistdef.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+static int copy_budget = -1;     // Copies allowed before failing (-1 = never fail)
+static int destroy_calls = 0;    // Tracks destroy function calls
+
+static bool copy_string(void* dst, const void* src)
+{
+    if (!dst || !src) return false;
+    if (copy_budget == 0) return false;
+    if (copy_budget > 0) copy_budget--;
+
+    const size_t len = strlen(*(const char**)src);
+    char* new_str = malloc(len + 1);
+    if (!new_str) return false;
+
+    memcpy(new_str, *(const char**)src, len + 1);
+    *(char**)dst = new_str;
+    return true;
+}
+
+static void destroy_string(void* data)
+{
+    if (!data) return;
+    free(*(char**)data);
+    *(char**)data = NULL;
+    destroy_calls++;
+}
+
+// ============================================================================
+// List Type Definitions (Template Instantiations)
+// ============================================================================
+
+LIBDS_DEF_INDEXED_LIST(int,         IListInt,    ili, null_copy, null_destroy)
+LIBDS_DEF_INDEXED_LIST(long double, IListLong,   ill, null_copy, null_destroy)
+LIBDS_DEF_INDEXED_LIST(char*,       IListString, ils, copy_string, destroy_string)
+
+// ============================================================================
+// Test Cases
+// ============================================================================
+
+static void test_indexed_sequential(void)
+{
+    printf("\n    %-30s", "test_indexed_sequential");
+
+    const int COUNT = 1000;
+    IListInt list = ili_create();
+    assert(list._nodes != NULL);
+    assert(ili_is_empty(list));
+
+    int value;
+    assert(ili_get_front(list, &value) == DS_ERR_EMPTY_STRUCTURE);
+    assert(ili_pop_back(list, &value) == DS_ERR_EMPTY_STRUCTURE);
+
+    for (int i = 0; i < COUNT; i++)
+        assert(ili_push_back(list, i) == DS_ERR_NONE);
+
+    assert(ili_length(list) == (size_t)COUNT);
+    for (int i = 0; i < COUNT; i++) {
+        assert(ili_get_at(list, i, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+    assert(ili_get_at(list, COUNT, &value) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+    assert(ili_push_at(list, COUNT + 1, 0) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+
+    assert(ili_get_back(list, &value) == DS_ERR_NONE && value == COUNT - 1);
+
+    assert(ili_reverse(list) == DS_ERR_NONE);
+    for (int i = 0; i < COUNT; i++) {
+        assert(ili_get_at(list, i, &value) == DS_ERR_NONE);
+        assert(value == COUNT - 1 - i);
+    }
+    assert(ili_get_back(list, &value) == DS_ERR_NONE && value == 0);
+
+    for (int i = 0; i < COUNT; i++) {
+        assert(ili_pop_back(list, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+    assert(ili_is_empty(list));
+
+    ili_delete(&list);
+    assert(list._nodes == NULL);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_indexed_middle(void)
+{
+    printf("\n    %-30s", "test_indexed_middle");
+
+    // quadratic on a linked list, each insertion here descends the levels
+    const int COUNT = 100000;
+    IListInt list = ili_create();
+
+    for (int i = 0; i < COUNT; i++)
+        assert(ili_push_at(list, ili_length(list) / 2, i) == DS_ERR_NONE);
+
+    // pushing at the middle interleaves the odd and even insertions
+    int value;
+    const size_t half = COUNT / 2;
+    for (size_t i = 0; i < half; i++) {
+        assert(ili_get_at(list, i, &value) == DS_ERR_NONE);
+        assert(value == (int)(2 * i + 1));
+        assert(ili_get_at(list, COUNT - 1 - i, &value) == DS_ERR_NONE);
+        assert(value == (int)(2 * i));
+    }
+
+    for (int i = COUNT - 1; i >= 0; i--) {
+        assert(ili_pop_at(list, (ili_length(list) - 1) / 2, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+    assert(ili_is_empty(list));
+
+    // recycled nodes serve the next round
+    const size_t bytes = ili_bytes(list);
+    for (int i = 0; i < COUNT / 2; i++)
+        assert(ili_push_front(list, i) == DS_ERR_NONE);
+    assert(ili_bytes(list) == bytes);
+
+    ili_clear(list);
+    ili_delete(&list);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_indexed_alignment(void)
+{
+    printf("\n    %-30s", "test_indexed_alignment");
+
+    struct ds_skip_list* skip = ds_sl_alloc(sizeof(long double), alignof(long double));
+    assert(skip != NULL);
+
+    void* data = NULL;
+    for (int i = 0; i < 128; i++) {
+        assert(ds_sl_push_at(skip, ds_sl_length(skip) / 2, &data) == DS_ERR_NONE);
+        assert(((uintptr_t)data % alignof(long double)) == 0);
+    }
+    ds_sl_free(&skip, NULL);
+
+    // Invalid layouts are rejected like in the node chain engine
+    assert(ds_sl_alloc(0, alignof(int)) == NULL);
+    assert(ds_sl_alloc(10, 8) == NULL);
+    assert(ds_sl_alloc((size_t)-8, 8) == NULL);
+
+    IListLong list = ill_create();
+    for (int i = 0; i < 100; i++) ill_push_front(list, (long double)i);
+
+    long double value;
+    assert(ill_get_at(list, 99, &value) == DS_ERR_NONE && value == 0.0L);
+    ill_delete(&list);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_indexed_dynamic_str(void)
+{
+    printf("\n    %-30s", "test_indexed_dynamic_str");
+
+    const char* names[] = {"Ada Lovelace", "Alan Turing", "John von Neumann", "Grace Hopper"};
+    destroy_calls = 0;
+
+    IListString list = ils_create();
+    for (int round = 0; round < 20; round++)
+        for (size_t i = 0; i < 4; i++)
+            assert(ils_push_at(list, ils_length(list) / 2, (char*)names[i]) == DS_ERR_NONE);
+
+    assert(ils_length(list) == 80);
+
+    // ownership transfer skips the destructor
+    char* out = NULL;
+    assert(ils_pop_at(list, 40, &out) == DS_ERR_NONE);
+    assert(destroy_calls == 0);
+    free(out);
+
+    assert(ils_drop_front(list) == DS_ERR_NONE);
+    assert(ils_drop_at(list, 10) == DS_ERR_NONE);
+    assert(destroy_calls == 2);
+
+    // failing copy rolls the destination back
+    IListString other = ils_create();
+    assert(ils_push_back(other, "kept") == DS_ERR_NONE);
+
+    copy_budget = 30;
+    assert(ils_copy(other, list) == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+
+    assert(ils_length(other) == 1);
+    assert(ils_get_front(other, &out) == DS_ERR_NONE && strcmp(out, "kept") == 0);
+    assert(ils_get_back(other, &out) == DS_ERR_NONE && strcmp(out, "kept") == 0);
+
+    // successful copy replaces the content
+    assert(ils_copy(other, list) == DS_ERR_NONE);
+    assert(ils_length(other) == ils_length(list));
+
+    char* a = NULL;
+    char* b = NULL;
+    for (size_t i = 0; i < ils_length(list); i++) {
+        assert(ils_get_at(list, i, &a) == DS_ERR_NONE);
+        assert(ils_get_at(other, i, &b) == DS_ERR_NONE);
+        assert(a != b && strcmp(a, b) == 0);
+    }
+    assert(ils_get_back(list, &a) == DS_ERR_NONE);
+    assert(ils_get_back(other, &b) == DS_ERR_NONE);
+    assert(strcmp(a, b) == 0);
+
+    ils_delete(&list);
+    ils_delete(&other);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_indexed_fuzz(void)
+{
+    printf("\n    %-30s", "test_indexed_fuzz");
+
+    enum { ITERATIONS = 20000, MAX_REF_SIZE = 2048 };
+
+    IListInt list = ili_create();
+    static int reference[MAX_REF_SIZE];
+    size_t ref_size = 0;
+
+    for (int it = 0; it < ITERATIONS; it++) {
+        const int operation = rand() % 8;
+        int value = rand();
+
+        if (operation <= 2 && ref_size < MAX_REF_SIZE) {
+            size_t index = operation == 0 ? 0 : operation == 1 ? ref_size : rand() % (ref_size + 1);
+            assert(ili_push_at(list, index, value) == DS_ERR_NONE);
+            memmove(reference + index + 1, reference + index, (ref_size - index) * sizeof(int));
+            reference[index] = value;
+            ref_size++;
+        }
+        else if (operation >= 3 && operation <= 5 && ref_size > 0) {
+            size_t index = operation == 3 ? 0 : operation == 4 ? ref_size - 1 : rand() % ref_size;
+            int out;
+            if (index == ref_size - 1)
+                assert(ili_pop_back(list, &out) == DS_ERR_NONE);
+            else
+                assert(ili_pop_at(list, index, &out) == DS_ERR_NONE);
+            assert(out == reference[index]);
+            memmove(reference + index, reference + index + 1, (ref_size - index - 1) * sizeof(int));
+            ref_size--;
+        }
+        else if (operation == 6 && ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(ili_set_at(list, index, value) == DS_ERR_NONE);
+            reference[index] = value;
+        }
+        else if (operation == 7 && rand() % 64 == 0) {
+            assert(ili_reverse(list) == DS_ERR_NONE);
+            for (size_t i = 0; i < ref_size / 2; i++) {
+                const int swap = reference[i];
+                reference[i] = reference[ref_size - 1 - i];
+                reference[ref_size - 1 - i] = swap;
+            }
+        }
+
+        assert(ili_length(list) == ref_size);
+        if (ref_size > 0) {
+            int back;
+            assert(ili_get_back(list, &back) == DS_ERR_NONE && back == reference[ref_size - 1]);
+        }
+    }
+
+    IListInt copied = ili_create();
+    assert(ili_copy(copied, list) == DS_ERR_NONE);
+
+    int value;
+    for (size_t i = 0; i < ref_size; i++) {
+        assert(ili_get_at(list, i, &value) == DS_ERR_NONE);
+        assert(value == reference[i]);
+        assert(ili_get_at(copied, i, &value) == DS_ERR_NONE);
+        assert(value == reference[i]);
+    }
+
+    ili_clear(list);
+    assert(ili_is_empty(list));
+    ili_delete(&list);
+    ili_delete(&copied);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_indexedlistdef_tests(void)
+{
+    printf("\n+------------------------------------------------------+");
+    printf("\n|              'indexedlistdef' Test Suite             |");
+    printf("\n+------------------------------------------------------+");
+
+    test_indexed_sequential();
+    test_indexed_middle();
+    test_indexed_alignment();
+    test_indexed_dynamic_str();
+    test_indexed_fuzz();
+
+    printf("\n+------------------------------------------------------+");
+    printf("\n|                    ALL TESTS PASSED                  |");
+    printf("\n+------------------------------------------------------+\n");
+}
@@ -12,6 +12,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 #define LIBDS_ENABLE_ERROR_PRINT 0
 #include "libds/core.h"
@@ -78,6 +79,9 @@ LIBDS_DEF_LIST(int,     ListInt,     li, null_copy, null_destroy)
 LIBDS_DEF_LIST(User,    ListUser,    lu, null_copy, null_destroy)
 LIBDS_DEF_LIST(char*,   ListString,  ls, copy_string, destroy_string)
 
+LIBDS_DEF_DLIST(int,    DListInt,    dli, null_copy, null_destroy)
+LIBDS_DEF_DLIST(char*,  DListString, dls, copy_string, destroy_string)
+
 // ============================================================================
 // Test Helpers - Test Data Generators
 // ============================================================================
@@ -437,6 +441,55 @@ static void test_list_copy_failure(void)
 // Test Cases: Fuzz Testing
 // ============================================================================
 
+static void test_list_copy_bitwise(void)
+{
+    printf("\n    %-30s", "test_list_copy_bitwise");
+
+    // a source mixing adjacent runs and scattered nodes
+    DListInt src = dli_create();
+    for (int i = 0; i < 3000; i++) assert(dli_append(src, i) == DS_ERR_NONE);
+    for (int i = 0; i < 500; i++) assert(dli_push_front(src, -1 - i) == DS_ERR_NONE);
+    for (size_t i = 100; i < 3000; i += 7) assert(dli_drop_at(src, i) == DS_ERR_NONE);
+    assert(dli_push_at(src, 1000, 12345) == DS_ERR_NONE);
+
+    // the destination reuses some recycled nodes before carving new ones
+    DListInt dst = dli_create();
+    for (int i = 0; i < 40; i++) assert(dli_append(dst, i) == DS_ERR_NONE);
+    for (int i = 0; i < 20; i++) assert(dli_drop_at(dst, (size_t)i) == DS_ERR_NONE);
+
+    assert(dli_copy(dst, src) == DS_ERR_NONE);
+    assert(dli_length(dst) == dli_length(src));
+
+    // same order forwards, and the `prev` links walk it backwards
+    int expected, value;
+    for (size_t i = 0; i < dli_length(src); i++) {
+        assert(dli_get_at(src, i, &expected) == DS_ERR_NONE);
+        assert(dli_get_at(dst, i, &value) == DS_ERR_NONE && value == expected);
+    }
+    while (!dli_is_empty(dst)) {
+        assert(dli_pop_back(src, &expected) == DS_ERR_NONE);
+        assert(dli_pop_back(dst, &value) == DS_ERR_NONE && value == expected);
+    }
+
+    // the copy is a list of its own
+    ListInt list = li_create();
+    ListInt copy = li_create();
+    for (int i = 0; i < 100; i++) assert(li_append(list, i) == DS_ERR_NONE);
+    assert(li_copy(copy, list) == DS_ERR_NONE);
+    assert(li_set_at(copy, 50, -50) == DS_ERR_NONE);
+    assert(li_append(copy, 100) == DS_ERR_NONE);
+    assert(li_get_at(list, 50, &value) == DS_ERR_NONE && value == 50);
+    assert(li_get_back(copy, &value) == DS_ERR_NONE && value == 100);
+    assert(li_length(list) == 100 && li_length(copy) == 101);
+
+    li_delete(&list);
+    li_delete(&copy);
+    dli_delete(&src);
+    dli_delete(&dst);
+
+    printf(" [PASSED]\n");
+}
+
 static void test_fuzz(void)
 {
     printf("\n    %-30s", "test_fuzz");
@@ -475,6 +528,1586 @@ static void test_fuzz(void)
     printf(" [PASSED]\n");
 }
 
+// ============================================================================
+// Test Cases: Doubly-Linked Lists
+// ============================================================================
+
+static void test_dlist_parity(void)
+{
+    printf("\n    %-30s", "test_dlist_parity");
+
+    ListInt singly = li_create();
+    DListInt doubly = dli_create();
+
+    for (int it = 0; it < 5000; it++) {
+        const size_t len = li_length(singly);
+        const size_t index = len ? (size_t)rand() % len : 0;
+        int a = 0, b = 0;
+
+        switch (rand() % 8) {
+            case 0: case 1: {
+                int value = rand();
+                assert(li_push_back(singly, value) == dli_push_back(doubly, value));
+                break;
+            }
+            case 2: {
+                int value = rand();
+                assert(li_push_at(singly, index, value) == dli_push_at(doubly, index, value));
+                break;
+            }
+            case 3:
+                assert(li_pop_back(singly, &a) == dli_pop_back(doubly, &b));
+                break;
+            case 4:
+                assert(li_pop_at(singly, index, &a) == dli_pop_at(doubly, index, &b));
+                break;
+            case 5:
+                assert(li_pop_front(singly, &a) == dli_pop_front(doubly, &b));
+                break;
+            case 6:
+                assert(li_push_front(singly, it) == dli_push_front(doubly, it));
+                break;
+            case 7:
+                if (rand() % 50 == 0) assert(li_reverse(singly) == dli_reverse(doubly));
+                break;
+        }
+        assert(a == b);
+        assert(li_length(singly) == dli_length(doubly));
+    }
+
+    // walk both ends of the doubly-linked list after all the relinking
+    const size_t len = li_length(singly);
+    for (size_t i = 0; i < len; i++) {
+        int a, b;
+        assert(li_get_at(singly, i, &a) == DS_ERR_NONE);
+        assert(dli_get_at(doubly, i, &b) == DS_ERR_NONE);
+        assert(a == b);
+    }
+
+    DListInt copy = dli_create();
+    assert(dli_copy(copy, doubly) == DS_ERR_NONE);
+    for (size_t i = len; i-- > 0;) {
+        int a, b;
+        assert(li_pop_back(singly, &a) == DS_ERR_NONE);
+        assert(dli_pop_back(copy, &b) == DS_ERR_NONE);
+        assert(a == b);
+    }
+    assert(dli_is_empty(copy));
+
+    li_delete(&singly);
+    dli_delete(&doubly);
+    dli_delete(&copy);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_dlist_refs(void)
+{
+    printf("\n    %-30s", "test_dlist_refs");
+
+    const int COUNT = 100;
+    DListInt list = dli_create();
+    int *refs[100];
+
+    for (int i = 0; i < COUNT; i++) {
+        assert(dli_push_back(list, i) == DS_ERR_NONE);
+        assert(dli_ref_at(list, i, &refs[i]) == DS_ERR_NONE);
+        assert(*refs[i] == i);
+    }
+
+    // references survive insertions around them
+    assert(dli_push_front(list, -1) == DS_ERR_NONE);
+    assert(*refs[0] == 0 && *refs[COUNT - 1] == COUNT - 1);
+
+    // remove the odd values through their references: head, middle and tail
+    int out;
+    assert(dli_pop_ref(list, refs[1], &out) == DS_ERR_NONE && out == 1);
+    for (int i = 3; i < COUNT; i += 2)
+        assert(dli_drop_ref(list, refs[i]) == DS_ERR_NONE);
+    assert(dli_drop_front(list) == DS_ERR_NONE);
+
+    assert(dli_length(list) == (size_t)COUNT / 2);
+    assert(dli_get_back(list, &out) == DS_ERR_NONE && out == COUNT - 2);
+    for (int i = 0; i < COUNT / 2; i++) {
+        assert(dli_get_at(list, i, &out) == DS_ERR_NONE);
+        assert(out == i * 2);
+    }
+
+    // draining from both ends keeps the links consistent
+    assert(dli_pop_back(list, &out) == DS_ERR_NONE && out == COUNT - 2);
+    assert(dli_drop_ref(list, refs[0]) == DS_ERR_NONE);
+    assert(dli_pop_ref(list, refs[COUNT - 4], NULL) == DS_ERR_NONE);
+    assert(dli_length(list) == (size_t)COUNT / 2 - 3);
+    assert(dli_get_front(list, &out) == DS_ERR_NONE && out == 2);
+    assert(dli_get_back(list, &out) == DS_ERR_NONE && out == COUNT - 6);
+
+    dli_delete(&list);
+
+    // singly-linked lists find the predecessor, and reject foreign references
+    ListInt singly = li_create();
+    int *ref, foreign = 0;
+    for (int i = 0; i < 10; i++) li_push_back(singly, i);
+    assert(li_ref_at(singly, 9, &ref) == DS_ERR_NONE);
+    assert(li_drop_ref(singly, ref) == DS_ERR_NONE);
+    assert(li_get_back(singly, &out) == DS_ERR_NONE && out == 8);
+    assert(li_drop_ref(singly, &foreign) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+    assert(li_length(singly) == 9);
+    li_delete(&singly);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_dlist_ownership(void)
+{
+    printf("\n    %-30s", "test_dlist_ownership");
+
+    destroy_calls = 0;
+    DListString list = dls_create();
+
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    for (int i = 0; i < 4; i++)
+        assert(dls_push_back(list, (char*)words[i]) == DS_ERR_NONE);
+
+    char **ref;
+    assert(dls_ref_at(list, 2, &ref) == DS_ERR_NONE);
+    assert(strcmp(*ref, "gamma") == 0);
+
+    char* out = NULL;
+    assert(dls_pop_ref(list, ref, &out) == DS_ERR_NONE);
+    assert(strcmp(out, "gamma") == 0 && destroy_calls == 0);
+    free(out);
+
+    assert(dls_drop_back(list) == DS_ERR_NONE);
+    assert(destroy_calls == 1);
+
+    assert(dls_pop_back(list, &out) == DS_ERR_NONE);
+    assert(strcmp(out, "beta") == 0);
+    free(out);
+
+    dls_delete(&list);
+    assert(destroy_calls == 2);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Cases: Bulk Operations
+// ============================================================================
+
+static void test_list_bulk(void)
+{
+    printf("\n    %-30s", "test_list_bulk");
+
+    enum { COUNT = 1000 };
+    int values[COUNT];
+    for (int i = 0; i < COUNT; i++) values[i] = i;
+
+    // fresh slots of a bulk insertion are laid out in ascending order
+    DListInt list = dli_create();
+    assert(dli_push_back_array(list, values, COUNT) == DS_ERR_NONE);
+    assert(dli_length(list) == COUNT);
+
+    int *first, *last;
+    assert(dli_ref_at(list, 0, &first) == DS_ERR_NONE);
+    assert(dli_ref_at(list, COUNT - 1, &last) == DS_ERR_NONE);
+    assert(last > first);
+
+    // recycled slots are used before allocating
+    const size_t bytes = dli_bytes(list);
+    for (int i = 0; i < COUNT / 2; i++) assert(dli_drop_back(list) == DS_ERR_NONE);
+    assert(dli_push_back_array(list, values, COUNT / 2) == DS_ERR_NONE);
+    assert(dli_bytes(list) == bytes);
+
+    int out;
+    for (int i = 0; i < COUNT; i++) {
+        assert(dli_get_at(list, i, &out) == DS_ERR_NONE);
+        assert(out == i % (COUNT / 2));
+    }
+    assert(dli_pop_back(list, &out) == DS_ERR_NONE && out == COUNT / 2 - 1);
+    assert(dli_push_back_array(list, values, 0) == DS_ERR_NONE);
+
+    dli_delete(&list);
+
+    // a failing copy rolls the whole batch back
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    ListString strings = ls_create();
+    ls_append(strings, "kept");
+    destroy_calls = 0;
+
+    fail_after = 2;
+    alloc_count = 0;
+    assert(ls_push_back_array(strings, (char**)words, 4) == DS_ERR_COPY_FAILED);
+    fail_after = -1;
+    assert(ls_length(strings) == 1 && destroy_calls == 2);
+
+    char* back;
+    assert(ls_get_back(strings, &back) == DS_ERR_NONE && strcmp(back, "kept") == 0);
+    assert(ls_push_back_array(strings, (char**)words, 4) == DS_ERR_NONE);
+    assert(ls_get_back(strings, &back) == DS_ERR_NONE && strcmp(back, "delta") == 0);
+
+    ls_delete(&strings);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Cases: Thread Cache
+// ============================================================================
+
+static void test_cached_list(void)
+{
+    printf("\n    %-30s", "test_cached_list");
+
+    enum { COUNT = 1000, WARM = 100 };
+    int values[COUNT];
+    for (int i = 0; i < COUNT; i++) values[i] = i;
+
+    // same contract as a regular list
+    ListInt list = li_create_cached();
+    for (int i = 0; i < COUNT / 2; i++) assert(li_append(list, i) == DS_ERR_NONE);
+    assert(li_push_back_array(list, values + COUNT / 2, COUNT / 2) == DS_ERR_NONE);
+
+    int out;
+    for (int i = 0; i < COUNT; i++) {
+        assert(li_get_at(list, i, &out) == DS_ERR_NONE);
+        assert(out == i);
+    }
+    assert(li_clear(list) == DS_ERR_NONE && li_is_empty(list));
+    assert(li_deep_clear(list) == DS_ERR_NONE);
+    li_delete(&list);
+
+    // nodes released by a cached list are warm for the next one
+    struct ds_cache_stats before, after;
+    ListInt warm = li_create_cached();
+    assert(li_cache_stats(warm, &before) == DS_ERR_NONE);
+
+    for (int i = 0; i < WARM; i++) assert(li_append(warm, i) == DS_ERR_NONE);
+    for (int i = 0; i < WARM; i++) assert(li_drop_front(warm) == DS_ERR_NONE);
+
+    assert(li_cache_stats(warm, &after) == DS_ERR_NONE);
+    const size_t hits = after.alloc_hits - before.alloc_hits;
+    const size_t misses = after.alloc_misses - before.alloc_misses;
+    assert(hits + misses == WARM);
+    assert(misses <= WARM / LIBDS_NC_MAGAZINE_SIZE + 1);
+    assert(after.free_hits - before.free_hits + after.free_misses - before.free_misses == WARM);
+    li_delete(&warm);
+
+    // regular lists do not touch the cache
+    ListInt plain = li_create();
+    assert(li_cache_stats(plain, &after) == DS_ERR_NONE);
+    assert(after.alloc_hits == 0 && after.alloc_misses == 0);
+    li_delete(&plain);
+
+    // doubly-linked variant keeps ownership semantics
+    DListString strings = dls_create_cached();
+    dls_append(strings, "first");
+    dls_append(strings, "second");
+    destroy_calls = 0;
+    assert(dls_drop_back(strings) == DS_ERR_NONE && destroy_calls == 1);
+
+    char* front;
+    assert(dls_get_front(strings, &front) == DS_ERR_NONE && strcmp(front, "first") == 0);
+    dls_delete(&strings);
+    assert(destroy_calls == 2);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Cases: Shared Node Pool
+// ============================================================================
+
+static void test_list_pool(void)
+{
+    printf("\n    %-30s", "test_list_pool");
+
+    struct ds_node_pool* pool = li_create_pool();
+    assert(pool != NULL);
+
+    // nodes flow from one list to another
+    ListInt first = li_create_in(pool);
+    ListInt second = li_create_in(pool);
+
+    for (int i = 0; i < 100; i++) li_append(first, i);
+    const size_t bytes = ds_nc_pool_bytes(pool);
+    li_deep_clear(first);
+    for (int i = 0; i < 100; i++) li_append(second, i);
+    assert(ds_nc_pool_bytes(pool) == bytes);
+
+    // the pool outlives its creator reference while lists are attached
+    assert(li_delete_pool(&pool) == DS_ERR_NONE && pool == NULL);
+    li_append(first, 7);
+    li_delete(&first);
+    li_delete(&second);
+
+    // a doubly-linked list cannot draw from a pool with smaller slots
+    pool = li_create_pool();
+    DListInt dlist = dli_create_in(pool);
+    assert(dlist._nodes == NULL);
+    li_delete_pool(&pool);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Cases: Custom Allocator
+// ============================================================================
+
+typedef struct {
+    size_t live_bytes;
+    size_t allocs;
+    size_t frees;
+} Accounting;
+
+static void* accounting_alloc(void* context, const size_t size)
+{
+    Accounting* stats = context;
+    void* ptr = malloc(size);
+    if (ptr) {
+        stats->live_bytes += size;
+        stats->allocs++;
+    }
+    return ptr;
+}
+
+static void accounting_free(void* context, void* ptr, const size_t size)
+{
+    Accounting* stats = context;
+    stats->live_bytes -= size;
+    stats->frees++;
+    free(ptr);
+}
+
+static void test_list_allocator(void)
+{
+    printf("\n    %-30s", "test_list_allocator");
+
+    Accounting stats = { 0 };
+    const struct ds_allocator accounting = {
+        .alloc = accounting_alloc, .realloc = NULL, .free = accounting_free, .context = &stats
+    };
+
+    // per-list allocator: every chunk, and the chain itself, goes through it
+    ListInt list = li_create_with_allocator(&accounting);
+    assert(list._nodes != NULL && stats.allocs == 1);
+
+    for (int i = 0; i < 1000; i++) assert(li_append(list, i) == DS_ERR_NONE);
+    assert(stats.allocs > 1 && stats.live_bytes == li_bytes(list));
+
+    assert(li_deep_clear(list) == DS_ERR_NONE);
+    assert(stats.live_bytes == li_bytes(list));
+    li_delete(&list);
+    assert(stats.live_bytes == 0 && stats.frees == stats.allocs);
+
+    // the default allocator is captured at creation
+    const struct ds_allocator incomplete = { .alloc = accounting_alloc, .context = &stats };
+    assert(ds_set_allocator(&incomplete) == DS_ERR_NULL_POINTER);
+    assert(ds_set_allocator(&accounting) == DS_ERR_NONE);
+
+    DListInt dlist = dli_create();
+    ListInt other = li_create_with_allocator(NULL);
+    assert(ds_set_allocator(NULL) == DS_ERR_NONE);
+
+    for (int i = 0; i < 100; i++) {
+        assert(dli_append(dlist, i) == DS_ERR_NONE);
+        assert(li_append(other, i) == DS_ERR_NONE);
+    }
+    assert(stats.live_bytes == dli_bytes(dlist) + li_bytes(other));
+
+    dli_delete(&dlist);
+    li_delete(&other);
+    assert(stats.live_bytes == 0 && stats.frees == stats.allocs);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_compact(void)
+{
+    printf("\n    %-30s", "test_list_compact");
+
+    enum { COUNT = 4096 };
+    ListInt list = li_create();
+    DListInt dlist = dli_create();
+
+    for (int i = 0; i < COUNT; i++) {
+        li_append(list, i);
+        dli_append(dlist, i);
+    }
+
+    // churn: random moves recycle the slots in LIFO order, all over the chunks
+    srand(7);
+    for (int i = 0; i < 4 * COUNT; i++) {
+        const size_t from = (size_t)rand() % COUNT;
+        const size_t to = (size_t)rand() % COUNT;
+        int value;
+        assert(li_pop_at(list, from, &value) == DS_ERR_NONE);
+        assert(li_push_at(list, to, value) == DS_ERR_NONE);
+        assert(dli_pop_at(dlist, from, &value) == DS_ERR_NONE);
+        assert(dli_push_at(dlist, to, value) == DS_ERR_NONE);
+    }
+
+    int expected[COUNT];
+    for (size_t i = 0; i < COUNT; i++) assert(li_get_at(list, i, &expected[i]) == DS_ERR_NONE);
+
+    const double before = li_link_distance(list);
+    const double dbefore = dli_link_distance(dlist);
+    const size_t bytes = li_bytes(list);
+    assert(li_compact(list) == DS_ERR_NONE);
+    assert(dli_compact(dlist) == DS_ERR_NONE);
+
+    // one slot stride between neighbours, a single chunk
+    const double after = li_link_distance(list);
+    assert(after > 0 && after < before / 8);
+    assert(dli_link_distance(dlist) < dbefore / 8);
+    assert(li_bytes(list) < bytes);
+
+    for (size_t i = 0; i < COUNT; i++) {
+        int value;
+        assert(li_get_at(list, i, &value) == DS_ERR_NONE && value == expected[i]);
+        assert(dli_get_at(dlist, i, &value) == DS_ERR_NONE && value == expected[i]);
+    }
+
+    // the prev links follow the new slots
+    int value;
+    assert(dli_pop_back(dlist, &value) == DS_ERR_NONE);
+    assert(dli_reverse(dlist) == DS_ERR_NONE);
+    assert(dli_length(dlist) == COUNT -1);
+
+    // still growing normally afterwards
+    for (int i = 0; i < 100; i++) assert(li_push_front(list, i) == DS_ERR_NONE);
+    assert(li_pop_back(list, &value) == DS_ERR_NONE && value == expected[COUNT -1]);
+
+    li_deep_clear(list);
+    assert(li_compact(list) == DS_ERR_NONE);
+
+    // refused when the slots are not the list's own, or a snapshot reads them
+    ListInt cached = li_create_cached();
+    assert(li_append(cached, 1) == DS_ERR_NONE);
+    assert(li_compact(cached) == DS_ERR_UNSUPPORTED);
+    li_delete(&cached);
+
+    struct ds_nc_snapshot* view = NULL;
+    assert(li_append(list, 1) == DS_ERR_NONE);
+    assert(li_snapshot(list, &view) == DS_ERR_NONE);
+    assert(li_compact(list) == DS_ERR_UNSUPPORTED);
+    assert(li_snapshot_release(&view) == DS_ERR_NONE);
+    assert(li_compact(list) == DS_ERR_NONE);
+
+    li_delete(&list);
+    dli_delete(&dlist);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_reserve(void)
+{
+    printf("\n    %-30s", "test_list_reserve");
+
+    enum { COUNT = 20000 };
+    ListInt list = li_create();
+    assert(li_capacity(list) == 0);
+
+    assert(li_reserve(list, COUNT) == DS_ERR_NONE);
+    assert(li_capacity(list) == COUNT && li_length(list) == 0);
+    const size_t bytes = li_bytes(list);
+
+    // already large enough: no-op
+    assert(li_reserve(list, COUNT / 2) == DS_ERR_NONE);
+    assert(li_bytes(list) == bytes);
+
+    // the fill takes no other chunk, and walks the reserved one in order
+    for (int i = 0; i < COUNT; i++) assert(li_append(list, i) == DS_ERR_NONE);
+    assert(li_bytes(list) == bytes && li_capacity(list) == COUNT);
+
+    const double distance = li_link_distance(list);
+    assert(li_compact(list) == DS_ERR_NONE);
+    assert(li_link_distance(list) == distance);
+
+    // growth past the reservation is geometric again
+    assert(li_append(list, COUNT) == DS_ERR_NONE);
+    assert(li_capacity(list) > COUNT + 1);
+
+    li_delete(&list);
+
+    // pooled lists draw the reserved slots from their pool
+    struct ds_node_pool* pool = li_create_pool();
+    ListInt pooled = li_create_in(pool);
+    assert(li_reserve(pooled, 100) == DS_ERR_NONE && li_capacity(pooled) == 100);
+    for (int i = 0; i < 100; i++) assert(li_append(pooled, i) == DS_ERR_NONE);
+    assert(li_capacity(pooled) == 100);
+    li_delete(&pooled);
+    li_delete_pool(&pool);
+
+    printf(" [PASSED]\n");
+}
+
+static void sum_values(const int* value, void* context)
+{
+    *(long*)context += *value;
+}
+
+static void test_list_cursor(void)
+{
+    printf("\n    %-30s", "test_list_cursor");
+
+    enum { COUNT = 1000 };
+    ListInt list = li_create();
+    DListInt dlist = dli_create();
+
+    for (int i = 0; i < COUNT; i++) {
+        li_append(list, i);
+        dli_append(dlist, i);
+    }
+
+    // in-place update through the cursor of the loop macro
+    const int* value;
+    LIBDS_LIST_FOREACH(li, it, value, list) *li_cursor_ref(&it) *= 2;
+    LIBDS_LIST_FOREACH(dli, it, value, dlist) *dli_cursor_ref(&it) *= 2;
+
+    long sum = 0;
+    li_foreach(list, sum_values, &sum);
+    assert(sum == (long)COUNT * (COUNT - 1));
+
+    // replace the successor of each multiple of 4 by its predecessor
+    struct ds_nc_cursor cursor = li_cursor(list);
+    struct ds_nc_cursor dcursor = dli_cursor(dlist);
+    while (ds_nc_cursor_valid(&cursor)) {
+        int next;
+        assert(li_erase_after(list, &cursor, &next) == DS_ERR_NONE && next % 4 == 2);
+        assert(li_insert_after(list, &cursor, next - 1) == DS_ERR_NONE);
+        assert(dli_erase_after(dlist, &dcursor, NULL) == DS_ERR_NONE);
+        assert(dli_insert_after(dlist, &dcursor, next - 1) == DS_ERR_NONE);
+
+        li_cursor_next(&cursor);
+        dli_cursor_next(&dcursor);
+
+        // the inserted successor of the last node became the tail
+        if (*li_cursor_ref(&cursor) == 2 * COUNT - 3) {
+            int back;
+            assert(li_get_back(list, &back) == DS_ERR_NONE && back == 2 * COUNT - 3);
+            assert(li_erase_after(list, &cursor, NULL) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+            assert(li_insert_after(list, &cursor, -1) == DS_ERR_NONE);
+            assert(dli_insert_after(dlist, &dcursor, -1) == DS_ERR_NONE);
+            li_cursor_next(&cursor);
+            dli_cursor_next(&dcursor);
+        }
+        li_cursor_next(&cursor);
+        dli_cursor_next(&dcursor);
+    }
+    assert(li_length(list) == COUNT + 1 && dli_length(dlist) == COUNT + 1);
+
+    int expected = 0;
+    LIBDS_LIST_FOREACH(li, it, value, list) {
+        if (*value == -1) break;
+        assert(*value == expected);
+        expected += expected % 4 == 0 ? 1 : 3;
+    }
+    assert(expected == 2 * COUNT);
+
+    // the tail and the prev links follow the insertions
+    int back;
+    assert(li_get_back(list, &back) == DS_ERR_NONE && back == -1);
+    assert(dli_pop_back(dlist, &back) == DS_ERR_NONE && back == -1);
+    assert(dli_pop_back(dlist, &back) == DS_ERR_NONE && back == 2 * COUNT - 3);
+    assert(dli_reverse(dlist) == DS_ERR_NONE);
+
+    // past the end, nothing is reachable
+    assert(!ds_nc_cursor_valid(&cursor) && li_cursor_ref(&cursor) == NULL);
+    assert(ds_nc_cursor_next(&cursor) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+    assert(ds_nc_cursor_insert_after(&cursor, (void**)&value) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+
+    // moving or freeing the nodes wholesale makes the cursors stale
+    cursor = li_cursor(list);
+    assert(li_compact(list) == DS_ERR_NONE);
+    assert(!ds_nc_cursor_valid(&cursor) && li_cursor_ref(&cursor) == NULL);
+    assert(li_cursor_get(&cursor, &back) == DS_ERR_STALE_CURSOR);
+
+    ListInt other = li_create();
+    assert(li_append(other, 7) == DS_ERR_NONE);
+    cursor = li_cursor(list);
+    struct ds_nc_cursor other_cursor = li_cursor(other);
+    assert(li_swap(list, other) == DS_ERR_NONE);
+    assert(li_insert_after(list, &cursor, 1) == DS_ERR_STALE_CURSOR);
+    assert(li_insert_after(other, &other_cursor, 1) == DS_ERR_STALE_CURSOR);
+
+    cursor = li_cursor(other);
+    assert(li_clear(other) == DS_ERR_NONE);
+    assert(li_cursor_next(&cursor) == DS_ERR_STALE_CURSOR);
+    li_delete(&other);
+
+    li_delete(&list);
+    dli_delete(&dlist);
+
+    // erasing without output destroys the element
+    ListString strings = ls_create();
+    ls_append(strings, "a");
+    ls_append(strings, "b");
+    destroy_calls = 0;
+    struct ds_nc_cursor first = ls_cursor(strings);
+    assert(ls_erase_after(strings, &first, NULL) == DS_ERR_NONE);
+    assert(destroy_calls == 1 && ls_length(strings) == 1);
+    ls_delete(&strings);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_finger(void)
+{
+    printf("\n    %-30s", "test_list_finger");
+
+    // a quadratic scan would take minutes at this size
+    enum { COUNT = 200000 };
+    ListInt list = li_create();
+    DListInt dlist = dli_create();
+    for (int i = 0; i < COUNT; i++) {
+        li_append(list, i);
+        dli_append(dlist, i);
+    }
+
+    long sum = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        int value;
+        assert(li_get_at(list, i, &value) == DS_ERR_NONE);
+        assert(li_set_at(list, i, value + 1) == DS_ERR_NONE);
+        sum += value;
+    }
+    for (size_t i = COUNT; i-- > 0;) {
+        int value;
+        assert(dli_get_at(dlist, i, &value) == DS_ERR_NONE && value == (int)i);
+    }
+    assert(sum == (long)COUNT * (COUNT - 1) / 2);
+    li_delete(&list);
+    dli_delete(&dlist);
+
+    // edits around the finger, checked against an array model
+    enum { MODEL = 512 };
+    int model[2 * MODEL];
+    size_t len = 0;
+    ListInt edited = li_create();
+    DListInt dedited = dli_create();
+
+    srand(11);
+    for (int step = 0; step < 20000; step++) {
+        const size_t index = len ? (size_t)rand() % len : 0;
+        int value = rand();
+
+        switch (len < MODEL ? rand() % 6 : 3 + rand() % 3) {
+            case 0:
+                li_push_front(edited, value);
+                dli_push_front(dedited, value);
+                memmove(model + 1, model, len++ * sizeof(int));
+                model[0] = value;
+                break;
+            case 1:
+            case 2:
+                li_push_at(edited, index, value);
+                dli_push_at(dedited, index, value);
+                memmove(model + index + 1, model + index, (len++ - index) * sizeof(int));
+                model[index] = value;
+                break;
+            case 3:
+                if (!len) break;
+                li_pop_front(edited, &value);
+                assert(dli_pop_front(dedited, &value) == DS_ERR_NONE && value == model[0]);
+                memmove(model, model + 1, --len * sizeof(int));
+                break;
+            case 4:
+                if (!len) break;
+                li_pop_at(edited, index, &value);
+                assert(dli_pop_at(dedited, index, &value) == DS_ERR_NONE && value == model[index]);
+                memmove(model + index, model + index + 1, (--len - index) * sizeof(int));
+                break;
+            default:
+                if (!len) break;
+                li_pop_back(edited, &value);
+                assert(dli_pop_back(dedited, &value) == DS_ERR_NONE && value == model[--len]);
+                break;
+        }
+
+        // a short sequential run leaves the finger somewhere in the middle
+        for (size_t i = index; i < len && i < index + 4; i++) {
+            assert(li_get_at(edited, i, &value) == DS_ERR_NONE && value == model[i]);
+            assert(dli_get_at(dedited, i, &value) == DS_ERR_NONE && value == model[i]);
+        }
+    }
+
+    li_delete(&edited);
+    dli_delete(&dedited);
+
+    printf(" [PASSED]\n");
+}
+
+static int compare_ints(const void* a, const void* b)
+{
+    const int x = *(const int*)a;
+    const int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static int compare_ages(const void* a, const void* b)
+{
+    return ((const User*)a)->age - ((const User*)b)->age;
+}
+
+static int compare_strings(const void* a, const void* b)
+{
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+static void test_list_sort(void)
+{
+    printf("\n    %-30s", "test_list_sort");
+
+    enum { COUNT = 50000 };
+    int* values = generate_random_int_array(COUNT);
+
+    Accounting stats = { 0 };
+    const struct ds_allocator accounting = {
+        .alloc = accounting_alloc, .realloc = NULL, .free = accounting_free, .context = &stats
+    };
+
+    ListInt list = li_create_with_allocator(&accounting);
+    DListInt dlist = dli_create();
+    assert(li_sort(list, compare_ints) == DS_ERR_NONE);
+    assert(li_sort(list, NULL) == DS_ERR_NULL_POINTER);
+
+    assert(li_push_back_array(list, values, COUNT) == DS_ERR_NONE);
+    for (int i = 0; i < COUNT; i++)
+        assert(dli_append(dlist, values[i]) == DS_ERR_NONE);
+
+    // the copy-to-array approach, as the reference
+    qsort(values, COUNT, sizeof(int), compare_ints);
+
+    int* first;
+    assert(li_ref_at(list, 0, &first) == DS_ERR_NONE);
+    const int first_value = *first;
+
+    // relinking only: no allocation, payloads stay where they are
+    const size_t allocs = stats.allocs;
+    assert(li_sort(list, compare_ints) == DS_ERR_NONE);
+    assert(stats.allocs == allocs);
+    assert(*first == first_value);
+
+    assert(dli_sort(dlist, compare_ints) == DS_ERR_NONE);
+
+    int value;
+    for (size_t i = 0; i < COUNT; i++) {
+        assert(li_get_at(list, i, &value) == DS_ERR_NONE && value == values[i]);
+    }
+
+    // the `prev` links follow the new order
+    for (size_t i = COUNT; i-- > 0;) {
+        assert(dli_pop_back(dlist, &value) == DS_ERR_NONE && value == values[i]);
+    }
+
+    // the tail is the new last node
+    assert(li_get_back(list, &value) == DS_ERR_NONE && value == values[COUNT - 1]);
+    assert(li_push_back(list, -1) == DS_ERR_NONE);
+    assert(li_get_at(list, COUNT, &value) == DS_ERR_NONE && value == -1);
+
+    // equal keys keep their insertion order
+    ListUser users = lu_create();
+    for (size_t id = 0; id < 1000; id++)
+        assert(lu_push_back(users, create_test_user(id)) == DS_ERR_NONE);
+    assert(lu_sort(users, compare_ages) == DS_ERR_NONE);
+
+    User prev = { 0 }, user;
+    lu_get_front(users, &prev);
+    for (size_t i = 1; i < 1000; i++) {
+        lu_get_at(users, i, &user);
+        assert(prev.age <= user.age);
+        if (prev.age == user.age)
+            assert(prev.id < user.id);
+        prev = user;
+    }
+
+    lu_delete(&users);
+    li_delete(&list);
+    dli_delete(&dlist);
+    free(values);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_parallel_sort(void)
+{
+    printf("\n    %-30s", "test_list_parallel_sort");
+
+    enum { COUNT = 100000, USERS = 20000 };
+    int* values = generate_random_int_array(COUNT);
+
+    ListInt list = li_create();
+    ListInt by_value = li_create();
+    DListInt dlist = dli_create();
+    assert(li_parallel_sort(list, NULL, 4) == DS_ERR_NULL_POINTER);
+    assert(li_parallel_sort_values(list, compare_ints, 4) == DS_ERR_NONE);
+
+    assert(li_push_back_array(list, values, COUNT) == DS_ERR_NONE);
+    assert(li_push_back_array(by_value, values, COUNT) == DS_ERR_NONE);
+    for (int i = 0; i < COUNT; i++)
+        assert(dli_append(dlist, values[i]) == DS_ERR_NONE);
+
+    qsort(values, COUNT, sizeof(int), compare_ints);
+
+    // uneven parts, and more threads than parts
+    assert(li_parallel_sort(list, compare_ints, 3) == DS_ERR_NONE);
+    assert(li_parallel_sort_values(by_value, compare_ints, 5) == DS_ERR_NONE);
+    assert(dli_parallel_sort(dlist, compare_ints, 1000) == DS_ERR_NONE);
+
+    int value;
+    for (size_t i = 0; i < COUNT; i++) {
+        assert(li_get_at(list, i, &value) == DS_ERR_NONE && value == values[i]);
+        assert(li_get_at(by_value, i, &value) == DS_ERR_NONE && value == values[i]);
+    }
+    for (size_t i = COUNT; i-- > 0;) {
+        assert(dli_pop_back(dlist, &value) == DS_ERR_NONE && value == values[i]);
+    }
+    assert(li_get_back(list, &value) == DS_ERR_NONE && value == values[COUNT - 1]);
+
+    // already sorted input, and no thread at all
+    assert(li_parallel_sort(list, compare_ints, 0) == DS_ERR_NONE);
+    assert(li_parallel_sort_values(by_value, compare_ints, 4) == DS_ERR_NONE);
+    assert(li_get_front(by_value, &value) == DS_ERR_NONE && value == values[0]);
+    assert(li_get_back(by_value, &value) == DS_ERR_NONE && value == values[COUNT - 1]);
+
+    // both variants are stable across the parts
+    ListUser relinked = lu_create();
+    ListUser moved = lu_create();
+    for (size_t id = 0; id < USERS; id++) {
+        assert(lu_push_back(relinked, create_test_user(id)) == DS_ERR_NONE);
+        assert(lu_push_back(moved, create_test_user(id)) == DS_ERR_NONE);
+    }
+    assert(lu_parallel_sort(relinked, compare_ages, 4) == DS_ERR_NONE);
+    assert(lu_parallel_sort_values(moved, compare_ages, 4) == DS_ERR_NONE);
+
+    User a = { 0 }, b = { 0 }, prev = { 0 };
+    for (size_t i = 0; i < USERS; i++) {
+        lu_get_at(relinked, i, &a);
+        lu_get_at(moved, i, &b);
+        assert(a.id == b.id && strcmp(a.username, b.username) == 0);
+        if (i > 0) assert(prev.age < a.age || (prev.age == a.age && prev.id < a.id));
+        prev = a;
+    }
+
+    // values owning memory are relinked, never moved
+    ListString names = ls_create();
+    char* name;
+    assert(ls_push_back(names, "mallory") == DS_ERR_NONE);
+    assert(ls_push_back(names, "alice") == DS_ERR_NONE);
+    char** first;
+    assert(ls_ref_at(names, 0, &first) == DS_ERR_NONE);
+    assert(ls_parallel_sort_values(names, compare_strings, 2) == DS_ERR_NONE);
+    assert(ls_get_back(names, &name) == DS_ERR_NONE && name == *first);
+
+    ls_delete(&names);
+    lu_delete(&relinked);
+    lu_delete(&moved);
+    li_delete(&list);
+    li_delete(&by_value);
+    dli_delete(&dlist);
+    free(values);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_splice(void)
+{
+    printf("\n    %-30s", "test_list_splice");
+
+    // private chains with the same allocator: the chunks change owner
+    ListInt front = li_create();
+    ListInt back = li_create();
+    for (int i = 0; i < 1000; i++) {
+        assert(li_append(front, i) == DS_ERR_NONE);
+        assert(li_append(back, 1000 + i) == DS_ERR_NONE);
+    }
+    assert(li_drop_back(back) == DS_ERR_NONE && li_append(back, 1999) == DS_ERR_NONE);
+
+    int* moved;
+    assert(li_ref_at(back, 10, &moved) == DS_ERR_NONE);
+    assert(li_concat(front, back) == DS_ERR_NONE);
+    assert(li_is_empty(back) && li_length(front) == 2000);
+    assert(li_bytes(back) < 256);
+
+    // the source can go, its nodes are not copied
+    li_delete(&back);
+    int value;
+    assert(*moved == 1010);
+    for (int i = 0; i < 2000; i++) {
+        assert(li_get_at(front, i, &value) == DS_ERR_NONE && value == i);
+    }
+    assert(li_get_back(front, &value) == DS_ERR_NONE && value == 1999);
+
+    // split keeps the head, the rest goes to the end of `tail`
+    ListInt tail = li_create();
+    assert(li_append(tail, -1) == DS_ERR_NONE);
+    assert(li_split(front, 2001, tail) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+    assert(li_split(front, 1500, tail) == DS_ERR_NONE);
+    assert(li_length(front) == 1500 && li_length(tail) == 501);
+    assert(li_get_back(front, &value) == DS_ERR_NONE && value == 1499);
+    assert(li_get_at(tail, 1, &value) == DS_ERR_NONE && value == 1500);
+    assert(li_get_back(tail, &value) == DS_ERR_NONE && value == 1999);
+    assert(li_append(front, 7) == DS_ERR_NONE);
+    assert(li_get_at(front, 1500, &value) == DS_ERR_NONE && value == 7);
+
+    // partial transfers between private chains move the payloads
+    assert(li_transfer(tail, front, 1502) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+    assert(li_transfer(tail, front, 100) == DS_ERR_NONE);
+    assert(li_length(front) == 1401 && li_length(tail) == 601);
+    assert(li_get_front(front, &value) == DS_ERR_NONE && value == 100);
+    assert(li_get_at(tail, 501, &value) == DS_ERR_NONE && value == 0);
+    assert(li_get_back(tail, &value) == DS_ERR_NONE && value == 99);
+
+    li_delete(&front);
+    li_delete(&tail);
+
+    // chains of one pool hand their nodes over, whatever the count
+    struct ds_node_pool* pool = dli_create_pool();
+    DListInt stage = dli_create_in(pool);
+    DListInt next = dli_create_in(pool);
+    for (int i = 0; i < 100; i++) assert(dli_append(stage, i) == DS_ERR_NONE);
+
+    int* kept;
+    assert(dli_ref_at(stage, 5, &kept) == DS_ERR_NONE);
+    assert(dli_transfer(next, stage, 10) == DS_ERR_NONE);
+    assert(dli_split(stage, 45, next) == DS_ERR_NONE);
+    assert(dli_length(stage) == 45 && dli_length(next) == 55);
+
+    int* found;
+    assert(dli_ref_at(next, 5, &found) == DS_ERR_NONE && found == kept);
+    for (int i = 54; i >= 10; i--) {
+        assert(dli_pop_back(next, &value) == DS_ERR_NONE && value == 45 + i);
+    }
+    for (int i = 9; i >= 0; i--) {
+        assert(dli_pop_back(next, &value) == DS_ERR_NONE && value == i);
+    }
+    assert(dli_pop_back(stage, &value) == DS_ERR_NONE && value == 54);
+    assert(dli_get_front(stage, &value) == DS_ERR_NONE && value == 10);
+
+    dli_delete(&stage);
+    dli_delete(&next);
+    dli_delete_pool(&pool);
+
+    // cached chains share the thread cache, owning values never get copied
+    DListString names = dls_create_cached();
+    DListString more = dls_create_cached();
+    DListString other = dls_create();
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    for (size_t i = 0; i < 4; i++) {
+        assert(dls_append(names, (char*)words[i]) == DS_ERR_NONE);
+        assert(dls_append(more, (char*)words[i]) == DS_ERR_NONE);
+    }
+
+    destroy_calls = 0;
+    assert(dls_concat(names, more) == DS_ERR_NONE);
+    assert(dls_transfer(other, names, 6) == DS_ERR_NONE);
+    assert(dls_length(names) == 2 && dls_length(other) == 6 && destroy_calls == 0);
+
+    char* word;
+    assert(dls_get_back(other, &word) == DS_ERR_NONE && strcmp(word, "beta") == 0);
+    assert(dls_get_front(names, &word) == DS_ERR_NONE && strcmp(word, "gamma") == 0);
+
+    dls_delete(&names);
+    dls_delete(&more);
+    dls_delete(&other);
+    assert(destroy_calls == 8);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_move_swap(void)
+{
+    printf("\n    %-30s", "test_list_move_swap");
+
+    // double buffering: the "next" list becomes the current one every tick
+    ListInt current = li_create();
+    ListInt pending = li_create_cached();
+    for (int i = 0; i < 100; i++) assert(li_append(current, i) == DS_ERR_NONE);
+    assert(li_append(pending, -1) == DS_ERR_NONE);
+
+    int* element;
+    assert(li_ref_at(current, 42, &element) == DS_ERR_NONE);
+    const size_t current_bytes = li_bytes(current);
+
+    assert(li_swap(current, pending) == DS_ERR_NONE);
+    assert(li_length(current) == 1 && li_length(pending) == 100);
+    assert(li_bytes(pending) == current_bytes);
+
+    // nodes stay in place, references follow their element
+    int value;
+    assert(li_get_at(pending, 42, &value) == DS_ERR_NONE && value == 42);
+    int* found;
+    assert(li_ref_at(pending, 42, &found) == DS_ERR_NONE && found == element);
+    assert(li_get_front(current, &value) == DS_ERR_NONE && value == -1);
+
+    // each handle keeps working with the state it received
+    assert(li_append(current, -2) == DS_ERR_NONE);
+    assert(li_append(pending, 100) == DS_ERR_NONE);
+    assert(li_get_back(current, &value) == DS_ERR_NONE && value == -2);
+    assert(li_get_back(pending, &value) == DS_ERR_NONE && value == 100);
+
+    li_delete(&current);
+    li_delete(&pending);
+
+    // move discards the destination, and empties the source
+    DListString dst = dls_create();
+    DListString src = dls_create();
+    const char* words[] = {"alpha", "beta", "gamma"};
+    assert(dls_append(dst, "old") == DS_ERR_NONE);
+    for (size_t i = 0; i < 3; i++) assert(dls_append(src, (char*)words[i]) == DS_ERR_NONE);
+
+    destroy_calls = 0;
+    assert(dls_move(dst, src) == DS_ERR_NONE);
+    assert(destroy_calls == 1);
+    assert(dls_is_empty(src) && dls_length(dst) == 3);
+    assert(dls_move(dst, dst) == DS_ERR_NONE && dls_length(dst) == 3);
+
+    char* word;
+    assert(dls_pop_back(dst, &word) == DS_ERR_NONE && strcmp(word, "gamma") == 0);
+    free(word);
+    assert(dls_get_front(dst, &word) == DS_ERR_NONE && strcmp(word, "alpha") == 0);
+
+    // the old nodes of the destination are freed, the source starts over
+    assert(dls_capacity(src) == 0);
+    assert(dls_append(src, "delta") == DS_ERR_NONE);
+    assert(dls_length(src) == 1);
+
+    dls_delete(&dst);
+    dls_delete(&src);
+    assert(destroy_calls == 4);
+
+    // the chunks take their allocator along, each handle keeps the one it is freed with
+    Accounting stats_a = { 0 };
+    Accounting stats_b = { 0 };
+    const struct ds_allocator allocator_a = {
+        .alloc = accounting_alloc, .realloc = NULL, .free = accounting_free, .context = &stats_a
+    };
+    const struct ds_allocator allocator_b = {
+        .alloc = accounting_alloc, .realloc = NULL, .free = accounting_free, .context = &stats_b
+    };
+
+    DListInt left = dli_create_with_allocator(&allocator_a);
+    DListInt right = dli_create_with_allocator(&allocator_b);
+    for (int i = 0; i < 300; i++) assert(dli_append(left, i) == DS_ERR_NONE);
+    for (int i = 0; i < 20; i++) assert(dli_append(right, -i) == DS_ERR_NONE);
+
+    assert(dli_ref_at(left, 150, &element) == DS_ERR_NONE);
+    assert(dli_swap(left, right) == DS_ERR_NONE);
+    assert(dli_length(left) == 20 && dli_length(right) == 300);
+    assert(dli_ref_at(right, 150, &found) == DS_ERR_NONE && found == element);
+    assert(stats_a.live_bytes == dli_bytes(right) && stats_b.live_bytes == dli_bytes(left));
+    for (size_t i = 0; i < 300; i++)
+        assert(dli_get_at(right, i, &value) == DS_ERR_NONE && value == (int)i);
+    for (int i = 19; i >= 0; i--)
+        assert(dli_pop_back(left, &value) == DS_ERR_NONE && value == -i);
+
+    assert(dli_move(left, right) == DS_ERR_NONE);
+    assert(dli_is_empty(right) && dli_length(left) == 300);
+    assert(dli_get_back(left, &value) == DS_ERR_NONE && value == 299);
+    assert(stats_a.live_bytes == dli_bytes(left) && stats_b.live_bytes == dli_bytes(right));
+
+    dli_delete(&left);
+    dli_delete(&right);
+    assert(stats_a.live_bytes == 0 && stats_a.frees == stats_a.allocs);
+    assert(stats_b.live_bytes == 0 && stats_b.frees == stats_b.allocs);
+
+    printf(" [PASSED]\n");
+}
+
+typedef struct {
+    struct ds_nc_snapshot* view;
+    long long expected;
+    int mismatches;
+} SnapshotReader;
+
+static void sum_snapshot(const int* value, void* context)
+{
+    *(long long*)context += *value;
+}
+
+static void* read_snapshot(void* arg)
+{
+    SnapshotReader* reader = arg;
+    for (int round = 0; round < 200; round++) {
+        long long sum = 0;
+        li_snapshot_foreach(reader->view, sum_snapshot, &sum);
+        if (sum != reader->expected) reader->mismatches++;
+    }
+
+    li_snapshot_release(&reader->view);
+    return NULL;
+}
+
+static void test_list_snapshot(void)
+{
+    printf("\n    %-30s", "test_list_snapshot");
+
+    ListInt list = li_create();
+    for (int i = 0; i < 1000; i++) assert(li_append(list, i) == DS_ERR_NONE);
+
+    struct ds_nc_snapshot* view = NULL;
+    assert(li_snapshot(list, &view) == DS_ERR_NONE);
+    assert(li_snapshot_length(view) == 1000);
+
+    // taken again before any change, the same view is shared
+    struct ds_nc_snapshot* same = NULL;
+    assert(li_snapshot(list, &same) == DS_ERR_NONE && same == view);
+    assert(li_snapshot_release(&same) == DS_ERR_NONE && same == NULL);
+
+    // a reader walks the view while the list keeps changing
+    SnapshotReader reader = { .view = view, .expected = 999 * 1000 / 2, .mismatches = 0 };
+    assert(li_snapshot_retain(view) == DS_ERR_NONE);
+
+    pthread_t thread;
+    assert(pthread_create(&thread, NULL, read_snapshot, &reader) == 0);
+
+    // pushing at either end keeps sharing the nodes, then the first pop diverges
+    assert(li_push_front(list, -1) == DS_ERR_NONE);
+    assert(li_append(list, 1000) == DS_ERR_NONE);
+    assert(li_pop_back(list, NULL) == DS_ERR_NONE);
+    assert(li_pop_front(list, NULL) == DS_ERR_NONE);
+    assert(li_pop_front(list, NULL) == DS_ERR_NONE);
+    assert(li_set_at(list, 10, -10) == DS_ERR_NONE);
+    assert(li_reverse(list) == DS_ERR_NONE);
+    assert(li_sort(list, compare_ints) == DS_ERR_NONE);
+
+    assert(pthread_join(thread, NULL) == 0);
+    assert(reader.mismatches == 0 && reader.view == NULL);
+
+    int value;
+    assert(li_length(list) == 999);
+    assert(li_get_front(list, &value) == DS_ERR_NONE && value == -10);
+    assert(li_snapshot_get_at(view, 0, &value) == DS_ERR_NONE && value == 0);
+    assert(li_snapshot_get_at(view, 11, &value) == DS_ERR_NONE && value == 11);
+    assert(li_snapshot_get_at(view, 999, &value) == DS_ERR_NONE && value == 999);
+    assert(li_snapshot_get_at(view, 1000, &value) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+    assert(li_snapshot_release(&view) == DS_ERR_NONE);
+    assert(li_snapshot_release(&view) == DS_ERR_NULL_POINTER);
+
+    // a view nobody reads anymore costs nothing on the next change
+    assert(li_snapshot(list, &view) == DS_ERR_NONE);
+    assert(li_snapshot_release(&view) == DS_ERR_NONE);
+    assert(li_pop_front(list, NULL) == DS_ERR_NONE);
+
+    // deleting the list hands its nodes over, values included
+    assert(li_snapshot(list, &view) == DS_ERR_NONE);
+    li_delete(&list);
+    long long sum = 0;
+    li_snapshot_foreach(view, sum_snapshot, &sum);
+    assert(li_snapshot_length(view) == 998 && sum == 999 * 1000 / 2 - 1 - 10);
+    assert(li_snapshot_release(&view) == DS_ERR_NONE);
+
+    // a change copies the values up to it only, the view destroys the originals
+    ListString words = ls_create();
+    const char* names[] = {"alpha", "beta", "gamma", "delta", "epsilon"};
+    for (size_t i = 0; i < 5; i++) assert(ls_append(words, (char*)names[i]) == DS_ERR_NONE);
+
+    struct ds_nc_snapshot* page = NULL;
+    assert(ls_snapshot(words, &page) == DS_ERR_NONE);
+    assert(ls_append(words, "zeta") == DS_ERR_NONE);
+
+    destroy_calls = 0;
+    char* word;
+    assert(ls_pop_front(words, &word) == DS_ERR_NONE && strcmp(word, "alpha") == 0);
+    free(word);
+    assert(destroy_calls == 0);
+
+    assert(ls_get_front(words, &word) == DS_ERR_NONE && strcmp(word, "beta") == 0);
+    assert(ls_snapshot_get_at(page, 0, &word) == DS_ERR_NONE && strcmp(word, "alpha") == 0);
+    assert(ls_snapshot_length(page) == 5);
+
+    // the shared values were never copied, the view takes them over with the rest
+    ls_delete(&words);
+    assert(destroy_calls == 0);
+    assert(ls_snapshot_release(&page) == DS_ERR_NONE);
+    assert(destroy_calls == 6);
+
+    // an older view keeps the nodes alive through the newer one
+    DListInt dlist = dli_create();
+    for (int i = 0; i < 10; i++) assert(dli_append(dlist, i) == DS_ERR_NONE);
+
+    struct ds_nc_snapshot* older = NULL;
+    struct ds_nc_snapshot* newer = NULL;
+    assert(dli_snapshot(dlist, &older) == DS_ERR_NONE);
+    assert(dli_push_front(dlist, -1) == DS_ERR_NONE);
+    assert(dli_snapshot(dlist, &newer) == DS_ERR_NONE && newer != older);
+
+    assert(dli_clear(dlist) == DS_ERR_NONE && dli_is_empty(dlist));
+    assert(dli_snapshot_release(&newer) == DS_ERR_NONE);
+
+    sum = 0;
+    dli_snapshot_foreach(older, sum_snapshot, &sum);
+    assert(dli_snapshot_length(older) == 10 && sum == 45);
+    assert(dli_snapshot_release(&older) == DS_ERR_NONE);
+
+    assert(dli_append(dlist, 7) == DS_ERR_NONE);
+    dli_delete(&dlist);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_snapshot_sharing(void)
+{
+    printf("\n    %-30s", "test_list_snapshot_sharing");
+
+    char buffer[24];
+    ListString words = ls_create();
+    for (int i = 0; i < 100; i++) {
+        snprintf(buffer, sizeof(buffer), "word-%d", i);
+        assert(ls_append(words, buffer) == DS_ERR_NONE);
+    }
+
+    struct ds_nc_snapshot* view = NULL;
+    assert(ls_snapshot(words, &view) == DS_ERR_NONE);
+
+    // a change copies the values up to it only, the rest stays shared
+    fail_after = 1000;
+    alloc_count = 0;
+    char* word = NULL;
+    assert(ls_pop_at(words, 2, &word) == DS_ERR_NONE && strcmp(word, "word-2") == 0);
+    assert(alloc_count == 3);
+    free(word);
+
+    char* mine = NULL;
+    char* seen = NULL;
+    assert(ls_get_at(words, 0, &mine) == DS_ERR_NONE);
+    assert(ls_snapshot_get_at(view, 0, &seen) == DS_ERR_NONE);
+    assert(mine != seen && strcmp(mine, seen) == 0);
+    assert(ls_get_at(words, 49, &mine) == DS_ERR_NONE);
+    assert(ls_snapshot_get_at(view, 50, &seen) == DS_ERR_NONE);
+    assert(mine == seen && strcmp(mine, "word-50") == 0);
+    assert(ls_snapshot_get_at(view, 2, &seen) == DS_ERR_NONE && strcmp(seen, "word-2") == 0);
+    assert(ls_length(words) == 99 && ls_snapshot_length(view) == 100);
+
+    // the copies are rolled back if one of them fails
+    fail_after = 1;
+    alloc_count = 0;
+    destroy_calls = 0;
+    assert(ls_pop_at(words, 10, NULL) == DS_ERR_COPY_FAILED);
+    assert(destroy_calls == 1 && ls_length(words) == 99);
+    assert(ls_get_at(words, 10, &mine) == DS_ERR_NONE && strcmp(mine, "word-11") == 0);
+    fail_after = -1;
+    alloc_count = 0;
+
+    // once released, the next change gives the former nodes back to the list
+    destroy_calls = 0;
+    assert(ls_snapshot_release(&view) == DS_ERR_NONE);
+    assert(destroy_calls == 0);
+    assert(ls_pop_front(words, &word) == DS_ERR_NONE && strcmp(word, "word-0") == 0);
+    assert(destroy_calls == 3);
+    free(word);
+    ls_delete(&words);
+
+    // the `prev` links of the shared nodes follow their new predecessors
+    DListInt dlist = dli_create();
+    for (int i = 0; i < 10; i++) assert(dli_append(dlist, i) == DS_ERR_NONE);
+
+    assert(dli_snapshot(dlist, &view) == DS_ERR_NONE);
+    assert(dli_pop_at(dlist, 3, NULL) == DS_ERR_NONE);
+    assert(dli_push_at(dlist, 6, 60) == DS_ERR_NONE);
+    assert(dli_pop_back(dlist, NULL) == DS_ERR_NONE);
+
+    const int expected[] = {0, 1, 2, 4, 5, 6, 60, 7, 8};
+    int value;
+    for (size_t i = 9; i-- > 0;)
+        assert(dli_get_at(dlist, i, &value) == DS_ERR_NONE && value == expected[i]);
+
+    long long sum = 0;
+    dli_snapshot_foreach(view, sum_snapshot, &sum);
+    assert(dli_snapshot_length(view) == 10 && sum == 45);
+    assert(dli_snapshot_release(&view) == DS_ERR_NONE);
+    dli_delete(&dlist);
+
+    // the shared nodes leave the list as they are, without allocating anything
+    Accounting stats = { 0 };
+    const struct ds_allocator accounting = {
+        .alloc = accounting_alloc, .realloc = NULL, .free = accounting_free, .context = &stats
+    };
+
+    ListInt queue = li_create_with_allocator(&accounting);
+    for (int i = 0; i < 1000; i++) assert(li_append(queue, i) == DS_ERR_NONE);
+    assert(li_snapshot(queue, &view) == DS_ERR_NONE);
+
+    const size_t allocs = stats.allocs;
+    for (int i = 0; i < 500; i++)
+        assert(li_pop_front(queue, &value) == DS_ERR_NONE && value == i);
+
+    int drained[300];
+    size_t popped = 0;
+    assert(ds_nc_pop_front_n(queue._nodes, drained, 300, sizeof(int), NULL, &popped) == DS_ERR_NONE);
+    assert(popped == 300 && drained[0] == 500 && drained[299] == 799);
+
+    ListInt other = li_create_with_allocator(&accounting);
+    assert(li_append(other, 7) == DS_ERR_NONE);
+    assert(stats.allocs == allocs + 2);
+    assert(li_copy(queue, other) == DS_ERR_NONE);
+    assert(stats.allocs == allocs + 2 && li_length(queue) == 1);
+
+    sum = 0;
+    li_snapshot_foreach(view, sum_snapshot, &sum);
+    assert(li_snapshot_length(view) == 1000 && sum == 999 * 1000 / 2);
+    assert(li_snapshot_release(&view) == DS_ERR_NONE);
+    li_delete(&other);
+    li_delete(&queue);
+    assert(stats.live_bytes == 0);
+
+    // a split copies every value once, straight into the list it ends up in
+    ListString kept = ls_create();
+    for (int i = 0; i < 100; i++) {
+        snprintf(buffer, sizeof(buffer), "word-%d", i);
+        assert(ls_append(kept, buffer) == DS_ERR_NONE);
+    }
+    assert(ls_snapshot(kept, &view) == DS_ERR_NONE);
+
+    ListString rest = ls_create();
+    fail_after = 1000;
+    alloc_count = 0;
+    destroy_calls = 0;
+    assert(ls_split(kept, 60, rest) == DS_ERR_NONE);
+    assert(alloc_count == 100 && destroy_calls == 0);
+    assert(ls_length(kept) == 60 && ls_length(rest) == 40);
+    assert(ls_get_at(kept, 0, &mine) == DS_ERR_NONE);
+    assert(ls_snapshot_get_at(view, 0, &seen) == DS_ERR_NONE && mine != seen);
+    assert(ls_get_at(rest, 10, &mine) == DS_ERR_NONE && strcmp(mine, "word-70") == 0);
+    assert(ls_snapshot_get_at(view, 70, &seen) == DS_ERR_NONE);
+    assert(mine != seen && strcmp(seen, "word-70") == 0);
+    assert(ls_snapshot_length(view) == 100);
+    assert(ls_snapshot_get_at(view, 99, &seen) == DS_ERR_NONE && strcmp(seen, "word-99") == 0);
+    assert(ls_snapshot_release(&view) == DS_ERR_NONE);
+
+    // moving shared nodes is all or nothing
+    assert(ls_snapshot(kept, &view) == DS_ERR_NONE);
+    fail_after = 5;
+    alloc_count = 0;
+    destroy_calls = 0;
+    assert(ls_concat(rest, kept) == DS_ERR_COPY_FAILED);
+    assert(destroy_calls == 5 && ls_length(kept) == 60 && ls_length(rest) == 40);
+    fail_after = -1;
+    alloc_count = 0;
+
+    assert(ls_concat(rest, kept) == DS_ERR_NONE && ls_length(rest) == 100);
+    assert(ls_get_at(rest, 40, &mine) == DS_ERR_NONE && strcmp(mine, "word-0") == 0);
+    assert(ls_snapshot_get_at(view, 59, &seen) == DS_ERR_NONE && strcmp(seen, "word-59") == 0);
+    assert(ls_snapshot_release(&view) == DS_ERR_NONE);
+    ls_delete(&rest);
+    ls_delete(&kept);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_list_snapshot_cursor(void)
+{
+    printf("\n    %-30s", "test_list_snapshot_cursor");
+
+    ListInt list = li_create();
+    for (int i = 1; i <= 3; i++) assert(li_append(list, i) == DS_ERR_NONE);
+
+    // a cursor placed before a snapshot could write to the shared nodes
+    struct ds_nc_cursor cursor = li_cursor(list);
+    struct ds_nc_snapshot* view = NULL;
+    assert(li_snapshot(list, &view) == DS_ERR_NONE);
+
+    int value;
+    assert(li_insert_after(list, &cursor, 9) == DS_ERR_STALE_CURSOR);
+    assert(li_erase_after(list, &cursor, NULL) == DS_ERR_STALE_CURSOR);
+    assert(li_cursor_get(&cursor, &value) == DS_ERR_STALE_CURSOR);
+    assert(li_cursor_next(&cursor) == DS_ERR_STALE_CURSOR);
+    assert(!ds_nc_cursor_valid(&cursor) && li_cursor_ref(&cursor) == NULL);
+
+    // placed again, it edits the list only
+    cursor = li_cursor(list);
+    assert(li_insert_after(list, &cursor, 9) == DS_ERR_NONE);
+    assert(li_cursor_next(&cursor) == DS_ERR_NONE);
+    assert(li_erase_after(list, &cursor, NULL) == DS_ERR_NONE);
+
+    const int expected[] = {1, 9, 3};
+    for (size_t i = 0; i < 3; i++) {
+        assert(li_get_at(list, i, &value) == DS_ERR_NONE && value == expected[i]);
+        assert(li_snapshot_get_at(view, i, &value) == DS_ERR_NONE && value == (int)i + 1);
+    }
+    assert(li_snapshot_release(&view) == DS_ERR_NONE);
+
+    // a reference taken before a snapshot removes its element from the list only
+    DListInt dlist = dli_create();
+    for (int i = 0; i < 5; i++) assert(dli_append(dlist, i) == DS_ERR_NONE);
+
+    int* ref = NULL;
+    assert(dli_ref_at(dlist, 2, &ref) == DS_ERR_NONE);
+    assert(dli_snapshot(dlist, &view) == DS_ERR_NONE);
+    assert(dli_pop_ref(dlist, ref, &value) == DS_ERR_NONE && value == 2);
+    assert(dli_ref_at(dlist, 0, &ref) == DS_ERR_NONE);
+    assert(dli_drop_ref(dlist, ref) == DS_ERR_NONE);
+    assert(dli_drop_ref(dlist, &value) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+
+    long long sum = 0;
+    dli_snapshot_foreach(view, sum_snapshot, &sum);
+    assert(dli_snapshot_length(view) == 5 && sum == 10);
+    assert(dli_length(dlist) == 3);
+    assert(dli_get_at(dlist, 0, &value) == DS_ERR_NONE && value == 1);
+    assert(dli_get_at(dlist, 1, &value) == DS_ERR_NONE && value == 3);
+    assert(dli_snapshot_release(&view) == DS_ERR_NONE);
+
+    // reading through a cursor copies nothing, writing copies up to it only
+    char buffer[24];
+    ListString words = ls_create();
+    for (int i = 0; i < 100; i++) {
+        snprintf(buffer, sizeof(buffer), "word-%d", i);
+        assert(ls_append(words, buffer) == DS_ERR_NONE);
+    }
+
+    struct ds_nc_snapshot* page = NULL;
+    assert(ls_snapshot(words, &page) == DS_ERR_NONE);
+
+    fail_after = 1000;
+    alloc_count = 0;
+    size_t count = 0;
+    char* const* word = NULL;
+    LIBDS_LIST_FOREACH(ls, it, word, words) count++;
+    assert(count == 100 && alloc_count == 0);
+
+    cursor = ls_cursor(words);
+    for (int i = 0; i < 10; i++) assert(ls_cursor_next(&cursor) == DS_ERR_NONE);
+    assert(strcmp(*ls_cursor_peek(&cursor), "word-10") == 0 && alloc_count == 0);
+
+    // the index of the cursor is found again after a push before it
+    assert(ls_push_front(words, "first") == DS_ERR_NONE);
+    char** slot = ls_cursor_ref(&cursor);
+    assert(slot != NULL && strcmp(*slot, "word-10") == 0 && alloc_count == 12);
+
+    // the shared successor is left to the view as it is
+    destroy_calls = 0;
+    assert(ls_insert_after(words, &cursor, "new") == DS_ERR_NONE && alloc_count == 13);
+    assert(ls_erase_after(words, &cursor, NULL) == DS_ERR_NONE && destroy_calls == 1);
+    assert(ls_erase_after(words, &cursor, NULL) == DS_ERR_NONE && destroy_calls == 1);
+    assert(alloc_count == 13 && ls_length(words) == 100);
+    fail_after = -1;
+    alloc_count = 0;
+
+    char* seen = NULL;
+    assert(ls_get_at(words, 12, &seen) == DS_ERR_NONE && strcmp(seen, "word-12") == 0);
+    assert(ls_snapshot_get_at(page, 11, &seen) == DS_ERR_NONE && strcmp(seen, "word-11") == 0);
+    assert(ls_snapshot_length(page) == 100);
+    assert(ls_snapshot_release(&page) == DS_ERR_NONE);
+    ls_delete(&words);
+
+    dli_delete(&dlist);
+    li_delete(&list);
+
+    printf(" [PASSED]\n");
+}
+
+static void* release_snapshot(void* arg)
+{
+    ls_snapshot_release(arg);
+    return NULL;
+}
+
+static void test_list_snapshot_pool(void)
+{
+    printf("\n    %-30s", "test_list_snapshot_pool");
+
+    struct ds_node_pool* pool = ls_create_pool();
+    ListString words = ls_create_in(pool);
+    const char* names[] = {"alpha", "beta", "gamma", "delta", "epsilon"};
+    for (size_t i = 0; i < 5; i++) assert(ls_append(words, (char*)names[i]) == DS_ERR_NONE);
+
+    struct ds_nc_snapshot* view = NULL;
+    assert(ls_snapshot(words, &view) == DS_ERR_NONE);
+    destroy_calls = 0;
+    assert(ls_clear(words) == DS_ERR_NONE && destroy_calls == 0);
+
+    // released on another thread, the nodes wait for the thread using the pool
+    pthread_t thread;
+    assert(pthread_create(&thread, NULL, release_snapshot, &view) == 0);
+    assert(pthread_join(thread, NULL) == 0);
+    assert(view == NULL && destroy_calls == 0);
+
+    // running out of recycled slots collects them
+    for (size_t i = 0; i < 20; i++) assert(ls_append(words, (char*)names[i % 5]) == DS_ERR_NONE);
+    assert(destroy_calls == 5);
+
+    ls_delete(&words);
+    assert(destroy_calls == 25);
+
+    // the last reference may also be the one of the snapshot
+    ListString last = ls_create_in(pool);
+    for (size_t i = 0; i < 5; i++) assert(ls_append(last, (char*)names[i]) == DS_ERR_NONE);
+    assert(ls_snapshot(last, &view) == DS_ERR_NONE);
+    ls_delete(&last);
+    ls_delete_pool(&pool);
+
+    assert(pthread_create(&thread, NULL, release_snapshot, &view) == 0);
+    assert(pthread_join(thread, NULL) == 0);
+    assert(destroy_calls == 30);
+
+    printf(" [PASSED]\n");
+}
+
+static size_t batch_calls = 0;
+static size_t batch_items = 0;
+
+static void destroy_string_batch(void** items, const size_t count)
+{
+    assert(count > 0 && count <= LIBDS_NC_DESTROY_BATCH_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        free(*(char**)items[i]);
+        *(char**)items[i] = NULL;
+    }
+    batch_calls++;
+    batch_items += count;
+}
+
+static void test_list_destroy_batch(void)
+{
+    printf("\n    %-30s", "test_list_destroy_batch");
+
+    const size_t count = 1000;
+    const size_t batches = (count + LIBDS_NC_DESTROY_BATCH_SIZE - 1) / LIBDS_NC_DESTROY_BATCH_SIZE;
+    char buffer[16];
+
+    ListString strings = ls_create();
+    for (size_t i = 0; i < count; i++) {
+        snprintf(buffer, sizeof(buffer), "item-%zu", i);
+        assert(ls_append(strings, buffer) == DS_ERR_NONE);
+    }
+
+    // the batch destructor runs in place of the one of the list
+    destroy_calls = 0;
+    batch_calls = 0;
+    batch_items = 0;
+    assert(ls_clear_batch(strings, destroy_string_batch) == DS_ERR_NONE);
+    assert(ls_is_empty(strings) && destroy_calls == 0);
+    assert(batch_calls == batches && batch_items == count);
+
+    // the recycled nodes are still usable
+    for (size_t i = 0; i < 3; i++) {
+        snprintf(buffer, sizeof(buffer), "again-%zu", i);
+        assert(ls_append(strings, buffer) == DS_ERR_NONE);
+    }
+    assert(ls_length(strings) == 3);
+
+    batch_calls = 0;
+    batch_items = 0;
+    assert(ls_delete_batch(&strings, destroy_string_batch) == DS_ERR_NONE);
+    assert(strings._nodes == NULL);
+    assert(batch_calls == 1 && batch_items == 3 && destroy_calls == 0);
+
+    // an empty list never calls it
+    DListString names = dls_create();
+    batch_calls = 0;
+    assert(dls_deep_clear_batch(names, destroy_string_batch) == DS_ERR_NONE);
+    assert(dls_delete_batch(&names, destroy_string_batch) == DS_ERR_NONE);
+    assert(batch_calls == 0 && names._nodes == NULL);
+
+    // without a destructor, the values are left alone
+    ListInt ints = li_create();
+    for (int i = 0; i < 100; i++) assert(li_append(ints, i) == DS_ERR_NONE);
+    assert(li_delete_batch(&ints, NULL) == DS_ERR_NONE);
+    assert(batch_calls == 0 && destroy_calls == 0);
+
+    printf(" [PASSED]\n");
+}
+
 // ============================================================================
 // Test Suite Runner
 // ============================================================================
@@ -491,7 +2124,28 @@ void run_listdef_tests(void)
     test_ownership();
     test_memory_reuse();
     test_list_copy_failure();
+    test_list_copy_bitwise();
     test_fuzz();
+    test_dlist_parity();
+    test_dlist_refs();
+    test_dlist_ownership();
+    test_list_bulk();
+    test_cached_list();
+    test_list_pool();
+    test_list_allocator();
+    test_list_compact();
+    test_list_reserve();
+    test_list_cursor();
+    test_list_finger();
+    test_list_sort();
+    test_list_parallel_sort();
+    test_list_splice();
+    test_list_move_swap();
+    test_list_snapshot();
+    test_list_snapshot_sharing();
+    test_list_snapshot_cursor();
+    test_list_snapshot_pool();
+    test_list_destroy_batch();
 
     printf("\n+------------------------------------------------------+");
     printf("\n|                    ALL TESTS PASSED                  |");
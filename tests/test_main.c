@@ -17,6 +17,11 @@ int main(int argc, char **argv)
 
     run_nodechain_tests();
     run_listdef_tests();
+    run_unrolledlistdef_tests();
+    run_indexedlistdef_tests();
+    run_queuedef_tests();
+    run_stackdef_tests();
+    run_concurrentdef_tests();
 
     return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include <assert.h>
 #include <stdalign.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
@@ -170,6 +171,48 @@ test_pop_operations(void)
     printf(" [PASSED]\n");
 }
 
+static bool
+failing_copy(void* dst, const void* src)
+{
+    (void)dst;
+    (void)src;
+    return false;
+}
+
+static void
+test_pop_front_n(void)
+{
+    printf("\n    %-30s", "test_pop_front_n");
+
+    NodeChain* chain = ds_nc_alloc(sizeof(int), alignof(int));
+    void* data_ptr = NULL;
+    for (int i = 0; i < 10; i++) {
+        assert(ds_nc_push_back(chain, &data_ptr) == DS_ERR_NONE);
+        *(int*)data_ptr = i;
+    }
+
+    int out[4];
+    size_t popped = 0;
+    assert(ds_nc_pop_front_n(chain, out, 4, sizeof(int), NULL, &popped) == DS_ERR_NONE);
+    assert(popped == 4 && out[0] == 0 && out[3] == 3 && ds_nc_length(chain) == 6);
+
+    // nothing is reported as popped when the run cannot be detached from a snapshot
+    struct ds_nc_snapshot* snapshot = NULL;
+    assert(ds_nc_snapshot(chain, sizeof(int), failing_copy, NULL, &snapshot) == DS_ERR_NONE);
+
+    popped = 99;
+    assert(ds_nc_pop_front_n(chain, out, 4, sizeof(int), NULL, &popped) == DS_ERR_COPY_FAILED);
+    assert(popped == 0 && ds_nc_length(chain) == 6);
+
+    assert(ds_nc_snapshot_release(&snapshot) == DS_ERR_NONE);
+    assert(ds_nc_pop_front_n(chain, out, 4, sizeof(int), NULL, &popped) == DS_ERR_NONE);
+    assert(popped == 4 && out[0] == 4 && ds_nc_length(chain) == 2);
+
+    ds_nc_free(&chain, NULL);
+
+    printf(" [PASSED]\n");
+}
+
 static void
 test_clear_operation(void)
 {
@@ -189,6 +232,57 @@ test_clear_operation(void)
     printf(" [PASSED]\n");
 }
 
+static void
+test_shared_pool(void)
+{
+    printf("\n    %-30s", "test_shared_pool");
+
+    enum { CHAINS = 1000, ITEMS = 3 };
+    NodeChain* chains[CHAINS];
+    void* data_ptr = NULL;
+
+    // reference: a private chain carves a whole minimum batch for a few nodes
+    NodeChain* private_chain = ds_nc_alloc(sizeof(int), alignof(int));
+    for (int k = 0; k < ITEMS; k++) assert(ds_nc_push_back(private_chain, &data_ptr) == DS_ERR_NONE);
+    const size_t private_bytes = ds_nc_bytes(private_chain);
+    ds_nc_free(&private_chain, NULL);
+
+    struct ds_node_pool* pool = ds_nc_alloc_pool(sizeof(int), alignof(int));
+    assert(pool != NULL);
+
+    size_t bytes = 0;
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < CHAINS; i++) {
+            chains[i] = ds_nc_alloc_with_pool(sizeof(int), alignof(int), pool);
+            assert(chains[i] != NULL);
+            for (int k = 0; k < ITEMS; k++) {
+                assert(ds_nc_push_back(chains[i], &data_ptr) == DS_ERR_NONE);
+                *(int*)data_ptr = i * ITEMS + k;
+            }
+        }
+
+        // chunks grow with the nodes in use, not once per chain
+        if (round == 0) bytes = ds_nc_pool_bytes(pool);
+        assert(ds_nc_pool_bytes(pool) == bytes);
+        assert(bytes < CHAINS * private_bytes / 2);
+
+        for (int i = 0; i < CHAINS; i++) {
+            assert(ds_nc_get_back(chains[i], &data_ptr) == DS_ERR_NONE);
+            assert(*(int*)data_ptr == i * ITEMS + ITEMS - 1);
+            assert(ds_nc_free(&chains[i], NULL) == DS_ERR_NONE);
+        }
+    }
+
+    // layouts must match, NULL pools are rejected
+    assert(ds_nc_alloc_doubly_with_pool(sizeof(int), alignof(int), pool) == NULL);
+    assert(ds_nc_alloc_with_pool(sizeof(int), alignof(int), NULL) == NULL);
+
+    assert(ds_nc_free_pool(&pool) == DS_ERR_NONE && pool == NULL);
+    assert(ds_nc_free_pool(&pool) == DS_ERR_NULL_POINTER);
+
+    printf(" [PASSED]\n");
+}
+
 // ============================================================================
 // Test Suite Runner
 // ============================================================================
@@ -204,7 +298,9 @@ void run_nodechain_tests(void)
     test_bad_types();
     test_push_operations();
     test_pop_operations();
+    test_pop_front_n();
     test_clear_operation();
+    test_shared_pool();
 
     printf("\n+------------------------------------------------------+");
     printf("\n|                    ALL TESTS PASSED                  |");
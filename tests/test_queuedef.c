@@ -0,0 +1,494 @@
+/**
+ * @file    test_queuedef.c
+ * @brief   Queue generator tests
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <assert.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIBDS_ENABLE_ERROR_PRINT 0
+#include "libds/core.h"
+
+#include "test_runner.h"
+#include "libds/queuedef.h"
+
+// ============================================================================
+// Test Fixture Types
+// ============================================================================
+
+typedef struct {
+    long long id;
+    double payload[3];
+} Record;
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+static int copy_budget = -1;     // Copies allowed before failing (-1 = never fail)
+static int destroy_calls = 0;    // Tracks destroy function calls
+
+static bool copy_string(void* dst, const void* src)
+{
+    if (!dst || !src) return false;
+    if (copy_budget == 0) return false;
+    if (copy_budget > 0) copy_budget--;
+
+    const size_t len = strlen(*(const char**)src);
+    char* new_str = malloc(len + 1);
+    if (!new_str) return false;
+
+    memcpy(new_str, *(const char**)src, len + 1);
+    *(char**)dst = new_str;
+    return true;
+}
+
+static void destroy_string(void* data)
+{
+    if (!data) return;
+    free(*(char**)data);
+    *(char**)data = NULL;
+    destroy_calls++;
+}
+
+// ============================================================================
+// Queue Type Definitions (Template Instantiations)
+// ============================================================================
+
+LIBDS_DEF_QUEUE(int, QueueInt, qi, null_copy, null_destroy)
+
+LIBDS_DEF_RING_QUEUE(int,    RingInt,    rqi, null_copy, null_destroy)
+LIBDS_DEF_RING_QUEUE(Record, RingRecord, rqr, null_copy, null_destroy)
+LIBDS_DEF_RING_QUEUE(char*,  RingString, rqs, copy_string, destroy_string)
+
+// ============================================================================
+// Test Cases
+// ============================================================================
+
+static void test_ring_fifo(void)
+{
+    printf("\n    %-30s", "test_ring_fifo");
+
+    const int COUNT = 1000;
+    RingInt queue = rqi_create();
+    assert(queue._nodes != NULL);
+    assert(rqi_is_empty(queue));
+    assert(rqi_capacity(queue) == 0);
+
+    const size_t empty_bytes = rqi_bytes(queue);
+
+    int value;
+    assert(rqi_dequeue(queue, &value) == DS_ERR_EMPTY_STRUCTURE);
+
+    // interleave to force wrap-around before every growth
+    int next_in = 0, next_out = 0;
+    while (next_in < COUNT) {
+        for (int i = 0; i < 3 && next_in < COUNT; i++)
+            assert(rqi_enqueue(queue, next_in++) == DS_ERR_NONE);
+
+        assert(rqi_dequeue(queue, &value) == DS_ERR_NONE);
+        assert(value == next_out++);
+    }
+
+    const size_t length = rqi_length(queue);
+    assert(length == (size_t)(next_in - next_out));
+    assert(rqi_capacity(queue) >= length);
+
+    assert(rqi_get_front(queue, &value) == DS_ERR_NONE && value == next_out);
+    assert(rqi_get_back(queue, &value) == DS_ERR_NONE && value == COUNT - 1);
+    for (size_t i = 0; i < length; i++) {
+        assert(rqi_get_at(queue, i, &value) == DS_ERR_NONE);
+        assert(value == next_out + (int)i);
+    }
+
+    while (!rqi_is_empty(queue)) {
+        assert(rqi_dequeue(queue, &value) == DS_ERR_NONE);
+        assert(value == next_out++);
+    }
+    assert(next_out == COUNT);
+
+    assert(rqi_deep_clear(queue) == DS_ERR_NONE);
+    assert(rqi_bytes(queue) == empty_bytes);
+
+    rqi_delete(&queue);
+    assert(queue._nodes == NULL);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_ring_fixed(void)
+{
+    printf("\n    %-30s", "test_ring_fixed");
+
+    RingRecord queue = rqr_create_fixed(100);
+    assert(queue._nodes != NULL);
+    assert(rqr_capacity(queue) == 100);
+
+    const size_t bytes = rqr_bytes(queue);
+
+    for (long long round = 0; round < 5; round++) {
+        for (long long i = 0; i < 100; i++)
+            assert(rqr_enqueue(queue, (Record){ .id = round * 100 + i }) == DS_ERR_NONE);
+
+        assert(rqr_enqueue(queue, (Record){ .id = -1 }) == DS_ERR_FULL_STRUCTURE);
+        assert(rqr_length(queue) == 100);
+
+        Record out;
+        for (long long i = 0; i < 60; i++) {
+            assert(rqr_dequeue(queue, &out) == DS_ERR_NONE);
+            assert(out.id == round * 100 + i);
+        }
+        for (long long i = 60; i < 100; i++)
+            assert(rqr_dequeue(queue, NULL) == DS_ERR_NONE);
+    }
+
+    // fixed buffers never grow nor release their array
+    assert(rqr_bytes(queue) == bytes);
+    assert(rqr_deep_clear(queue) == DS_ERR_NONE);
+    assert(rqr_bytes(queue) == bytes);
+
+    // a fixed destination refuses sources that do not fit
+    RingRecord small = rqr_create_fixed(10);
+    RingRecord big = rqr_create();
+    for (int i = 0; i < 11; i++) rqr_enqueue(big, (Record){ .id = i });
+    assert(rqr_copy(small, big) == DS_ERR_FULL_STRUCTURE);
+    rqr_dequeue(big, NULL);
+    assert(rqr_copy(small, big) == DS_ERR_NONE);
+    assert(rqr_length(small) == 10);
+
+    rqr_delete(&small);
+    rqr_delete(&big);
+    rqr_delete(&queue);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_ring_ownership(void)
+{
+    printf("\n    %-30s", "test_ring_ownership");
+
+    destroy_calls = 0;
+    RingString queue = rqs_create();
+
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    for (int i = 0; i < 40; i++)
+        assert(rqs_enqueue(queue, (char*)words[i % 4]) == DS_ERR_NONE);
+
+    char* out = NULL;
+    assert(rqs_dequeue(queue, &out) == DS_ERR_NONE);
+    assert(strcmp(out, "alpha") == 0 && destroy_calls == 0);
+    free(out);
+
+    assert(rqs_dequeue(queue, NULL) == DS_ERR_NONE);
+    assert(destroy_calls == 1);
+
+    // failing copies leave the queue untouched
+    copy_budget = 0;
+    assert(rqs_enqueue(queue, "epsilon") == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+    assert(rqs_length(queue) == 38);
+
+    RingString other = rqs_create();
+    rqs_enqueue(other, "kept");
+    copy_budget = 20;
+    assert(rqs_copy(other, queue) == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+    assert(rqs_length(other) == 1);
+
+    assert(rqs_copy(other, queue) == DS_ERR_NONE);
+    assert(rqs_length(other) == 38);
+    assert(rqs_get_front(other, &out) == DS_ERR_NONE && strcmp(out, "gamma") == 0);
+
+    rqs_delete(&queue);
+    rqs_delete(&other);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_queue_parity(void)
+{
+    printf("\n    %-30s", "test_queue_parity");
+
+    QueueInt linked = qi_create();
+    RingInt ring = rqi_create();
+
+    for (int it = 0; it < 5000; it++) {
+        if (rand() % 3) {
+            int value = rand();
+            assert(qi_enqueue(linked, value) == rqi_enqueue(ring, value));
+        }
+        else {
+            int a = 0, b = 0;
+            assert(qi_dequeue(linked, &a) == rqi_dequeue(ring, &b));
+            assert(a == b);
+        }
+        assert(qi_length(linked) == rqi_length(ring));
+    }
+
+    qi_delete(&linked);
+    rqi_delete(&ring);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_queue_bulk(void)
+{
+    printf("\n    %-30s", "test_queue_bulk");
+
+    enum { COUNT = 1000 };
+    int values[COUNT], out[COUNT];
+    for (int i = 0; i < COUNT; i++) values[i] = i;
+
+    QueueInt linked = qi_create();
+    RingInt ring = rqi_create();
+
+    // wrap the ring around before the bulk calls
+    for (int i = 0; i < 5; i++) {
+        assert(qi_enqueue(linked, -1) == DS_ERR_NONE);
+        assert(rqi_enqueue(ring, -1) == DS_ERR_NONE);
+    }
+    assert(qi_dequeue_n(linked, NULL, 5, NULL) == DS_ERR_NONE);
+    assert(rqi_dequeue_n(ring, NULL, 5, NULL) == DS_ERR_NONE);
+
+    assert(qi_enqueue_n(linked, values, COUNT) == DS_ERR_NONE);
+    assert(rqi_enqueue_n(ring, values, COUNT) == DS_ERR_NONE);
+    assert(qi_enqueue(linked, COUNT) == DS_ERR_NONE);
+    assert(rqi_enqueue(ring, COUNT) == DS_ERR_NONE);
+
+    size_t popped = 0;
+    assert(qi_dequeue_n(linked, out, 600, &popped) == DS_ERR_NONE && popped == 600);
+    for (int i = 0; i < 600; i++) assert(out[i] == i);
+    assert(rqi_dequeue_n(ring, out, 600, &popped) == DS_ERR_NONE && popped == 600);
+    for (int i = 0; i < 600; i++) assert(out[i] == i);
+
+    // asking for more than stored drains the queue
+    assert(qi_dequeue_n(linked, out, COUNT, &popped) == DS_ERR_NONE && popped == 401);
+    assert(out[0] == 600 && out[400] == COUNT);
+    assert(rqi_dequeue_n(ring, out, COUNT, &popped) == DS_ERR_NONE && popped == 401);
+    assert(out[0] == 600 && out[400] == COUNT);
+
+    assert(qi_dequeue_n(linked, out, 1, &popped) == DS_ERR_EMPTY_STRUCTURE);
+    assert(rqi_dequeue_n(ring, out, 1, &popped) == DS_ERR_EMPTY_STRUCTURE);
+    assert(qi_dequeue_n(linked, out, 0, &popped) == DS_ERR_NONE && popped == 0);
+    assert(rqi_dequeue_n(ring, out, 0, &popped) == DS_ERR_NONE && popped == 0);
+    assert(qi_is_empty(linked) && rqi_is_empty(ring));
+
+    // fixed queues refuse batches that do not fit, all or nothing
+    RingInt fixed = rqi_create_fixed(10);
+    assert(rqi_enqueue_n(fixed, values, 11) == DS_ERR_FULL_STRUCTURE);
+    assert(rqi_is_empty(fixed));
+    assert(rqi_enqueue_n(fixed, values, 10) == DS_ERR_NONE);
+
+    qi_delete(&linked);
+    rqi_delete(&ring);
+    rqi_delete(&fixed);
+
+    // failing copies leave the queue untouched
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    RingString strings = rqs_create();
+    destroy_calls = 0;
+
+    copy_budget = 2;
+    assert(rqs_enqueue_n(strings, (char**)words, 4) == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+    assert(rqs_is_empty(strings) && destroy_calls == 2);
+
+    assert(rqs_enqueue_n(strings, (char**)words, 4) == DS_ERR_NONE);
+    assert(rqs_dequeue_n(strings, NULL, 3, NULL) == DS_ERR_NONE);
+    assert(destroy_calls == 5);
+
+    rqs_delete(&strings);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_queue_pages(void)
+{
+    printf("\n    %-30s", "test_queue_pages");
+
+    enum { COUNT = 400000 };
+    const unsigned modes[] = { DS_PAGES_DEFAULT, DS_PAGES_POPULATE, DS_PAGES_HUGE | DS_PAGES_POPULATE };
+
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        const struct ds_allocator pages = ds_page_allocator(modes[m]);
+        QueueInt queue = qi_create_with_allocator(&pages);
+        assert(queue._nodes != NULL);
+
+        // large enough for the last chunks to take the huge page path
+        for (int round = 0; round < 2; round++) {
+            for (int i = 0; i < COUNT; i++) assert(qi_enqueue(queue, i) == DS_ERR_NONE);
+
+            int out;
+            for (int i = 0; i < COUNT / 2; i++) {
+                assert(qi_dequeue(queue, &out) == DS_ERR_NONE && out == i);
+            }
+            assert(qi_length(queue) == COUNT - COUNT / 2);
+
+            // deep clear unmaps every chunk, the next round maps them again
+            assert(qi_deep_clear(queue) == DS_ERR_NONE);
+        }
+        qi_delete(&queue);
+    }
+
+    printf(" [PASSED]\n");
+}
+
+static size_t live_bytes = 0;  // Tracks the memory handed out by the test allocator
+static size_t alloc_calls = 0; // Counts the allocations of the test allocator
+
+static void* tracking_alloc(void* context, const size_t size)
+{
+    (void)context;
+    live_bytes += size;
+    alloc_calls++;
+    return malloc(size);
+}
+
+static void tracking_free(void* context, void* ptr, const size_t size)
+{
+    (void)context;
+    live_bytes -= size;
+    free(ptr);
+}
+
+static void test_ring_allocator(void)
+{
+    printf("\n    %-30s", "test_ring_allocator");
+
+    // without `realloc`, growth falls back to alloc + copy + free
+    const struct ds_allocator tracking = { .alloc = tracking_alloc, .free = tracking_free };
+    assert(ds_set_allocator(&tracking) == DS_ERR_NONE);
+    RingInt queue = rqi_create();
+    assert(ds_set_allocator(NULL) == DS_ERR_NONE);
+
+    for (int i = 0; i < 1000; i++) {
+        assert(rqi_enqueue(queue, i) == DS_ERR_NONE);
+        if (i % 3 == 0) {
+            int out;
+            assert(rqi_dequeue(queue, &out) == DS_ERR_NONE && out == i / 3);
+        }
+    }
+    assert(live_bytes == rqi_bytes(queue));
+
+    int out;
+    for (int i = 334; i < 1000; i++) {
+        assert(rqi_dequeue(queue, &out) == DS_ERR_NONE && out == i);
+    }
+
+    rqi_delete(&queue);
+    assert(live_bytes == 0);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_queue_trim(void)
+{
+    printf("\n    %-30s", "test_queue_trim");
+
+    enum { COUNT = 100000, KEPT = 10 };
+    const struct ds_allocator tracking = { .alloc = tracking_alloc, .free = tracking_free };
+    QueueInt queue = qi_create_with_allocator(&tracking);
+    assert(queue._nodes != NULL);
+
+    // a burst leaves the early chunks idle, the last ones hold the survivors
+    int out;
+    for (int i = 0; i < COUNT; i++) assert(qi_enqueue(queue, i) == DS_ERR_NONE);
+    for (int i = 0; i < COUNT - KEPT; i++) assert(qi_dequeue(queue, &out) == DS_ERR_NONE);
+
+    const size_t peak = live_bytes;
+    assert(qi_trim(queue, peak) == DS_ERR_NONE);
+    assert(live_bytes == peak);
+
+    // trimming needs no scratch memory
+    const size_t calls = alloc_calls;
+    assert(qi_shrink_to_fit(queue) == DS_ERR_NONE);
+    assert(alloc_calls == calls);
+    assert(live_bytes < peak / 2);
+    assert(live_bytes == qi_bytes(queue));
+
+    for (int i = COUNT - KEPT; i < COUNT; i++) {
+        assert(qi_dequeue(queue, &out) == DS_ERR_NONE && out == i);
+    }
+
+    // automatic mode: draining the burst releases chunks along the way
+    assert(qi_deep_clear(queue) == DS_ERR_NONE);
+    assert(qi_set_auto_trim(queue, 0.5f) == DS_ERR_NONE);
+    for (int i = 0; i < COUNT; i++) assert(qi_enqueue(queue, i) == DS_ERR_NONE);
+
+    const size_t burst = live_bytes;
+    const size_t burst_calls = alloc_calls;
+    for (int i = 0; i < COUNT; i++) {
+        assert(qi_dequeue(queue, &out) == DS_ERR_NONE && out == i);
+    }
+    assert(live_bytes < burst / 2);
+    assert(alloc_calls == burst_calls);
+    assert(live_bytes == qi_bytes(queue));
+
+    qi_delete(&queue);
+    assert(live_bytes == 0);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_queue_transfer(void)
+{
+    printf("\n    %-30s", "test_queue_transfer");
+
+    // work handed between pipeline stages in batches
+    QueueInt input = qi_create();
+    QueueInt output = qi_create();
+    for (int i = 0; i < 1000; i++) assert(qi_enqueue(input, i) == DS_ERR_NONE);
+
+    assert(qi_transfer(output, input, 1001) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+    assert(qi_transfer(output, input, 0) == DS_ERR_NONE);
+    for (int batch = 0; batch < 10; batch++)
+        assert(qi_transfer(output, input, 90) == DS_ERR_NONE);
+    assert(qi_length(input) == 100 && qi_length(output) == 900);
+
+    assert(qi_concat(output, input) == DS_ERR_NONE);
+    assert(qi_is_empty(input));
+    assert(qi_enqueue(input, -1) == DS_ERR_NONE);
+
+    int value;
+    for (int i = 0; i < 1000; i++) {
+        assert(qi_dequeue(output, &value) == DS_ERR_NONE && value == i);
+    }
+    assert(qi_dequeue(input, &value) == DS_ERR_NONE && value == -1);
+
+    qi_delete(&input);
+    qi_delete(&output);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_queuedef_tests(void)
+{
+    printf("\n+------------------------------------------------------+");
+    printf("\n|                  'queuedef' Test Suite               |");
+    printf("\n+------------------------------------------------------+");
+
+    test_ring_fifo();
+    test_ring_fixed();
+    test_ring_ownership();
+    test_queue_parity();
+    test_queue_bulk();
+    test_ring_allocator();
+    test_queue_trim();
+    test_queue_transfer();
+    test_queue_pages();
+
+    printf("\n+------------------------------------------------------+");
+    printf("\n|                    ALL TESTS PASSED                  |");
+    printf("\n+------------------------------------------------------+\n");
+}
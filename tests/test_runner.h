@@ -14,6 +14,9 @@
 #include "libds/listdef.h"
 #include "libds/stackdef.h"
 #include "libds/queuedef.h"
+#include "libds/unrolledlistdef.h"
+#include "libds/indexedlistdef.h"
+#include "libds/concurrentdef.h"
 
 
 
@@ -22,5 +25,10 @@ static ds_copier_fn null_copy = NULL;
 
 void run_nodechain_tests(void);
 void run_listdef_tests(void);
+void run_unrolledlistdef_tests(void);
+void run_indexedlistdef_tests(void);
+void run_queuedef_tests(void);
+void run_stackdef_tests(void);
+void run_concurrentdef_tests(void);
 
 #endif //LIBDS_TEST_RUNNER_H
\ No newline at end of file
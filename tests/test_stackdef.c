@@ -0,0 +1,332 @@
+/**
+ * @file    test_stackdef.c
+ * @brief   Stack generator tests
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <assert.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIBDS_ENABLE_ERROR_PRINT 0
+#include "libds/core.h"
+
+#include "test_runner.h"
+#include "libds/stackdef.h"
+
+// ============================================================================
+// Test Fixture Types
+// ============================================================================
+
+typedef struct {
+    long long id;
+    double payload[3];
+} Record;
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+static int copy_budget = -1;     // Copies allowed before failing (-1 = never fail)
+static int destroy_calls = 0;    // Tracks destroy function calls
+
+static bool copy_string(void* dst, const void* src)
+{
+    if (!dst || !src) return false;
+    if (copy_budget == 0) return false;
+    if (copy_budget > 0) copy_budget--;
+
+    const size_t len = strlen(*(const char**)src);
+    char* new_str = malloc(len + 1);
+    if (!new_str) return false;
+
+    memcpy(new_str, *(const char**)src, len + 1);
+    *(char**)dst = new_str;
+    return true;
+}
+
+static void destroy_string(void* data)
+{
+    if (!data) return;
+    free(*(char**)data);
+    *(char**)data = NULL;
+    destroy_calls++;
+}
+
+// ============================================================================
+// Stack Type Definitions (Template Instantiations)
+// ============================================================================
+
+LIBDS_DEF_STACK(int, StackInt, si, null_copy, null_destroy)
+
+LIBDS_DEF_SEGMENTED_STACK(int,    SegInt,    ssi, null_copy, null_destroy)
+LIBDS_DEF_SEGMENTED_STACK(Record, SegRecord, ssr, null_copy, null_destroy)
+LIBDS_DEF_SEGMENTED_STACK(char*,  SegString, sss, copy_string, destroy_string)
+
+// ============================================================================
+// Test Cases
+// ============================================================================
+
+static void test_segmented_lifo(void)
+{
+    printf("\n    %-30s", "test_segmented_lifo");
+
+    const int COUNT = 1000;
+    SegInt stack = ssi_create();
+    assert(stack._nodes != NULL);
+    assert(ssi_is_empty(stack));
+    assert(ssi_capacity(stack) == 0);
+
+    int value;
+    assert(ssi_pop(stack, &value) == DS_ERR_EMPTY_STRUCTURE);
+    assert(ssi_get_front(stack, &value) == DS_ERR_EMPTY_STRUCTURE);
+
+    for (int i = 0; i < COUNT; i++)
+        assert(ssi_push(stack, i) == DS_ERR_NONE);
+
+    assert(ssi_length(stack) == (size_t)COUNT);
+    assert(ssi_capacity(stack) >= (size_t)COUNT);
+    assert(ssi_get_front(stack, &value) == DS_ERR_NONE && value == COUNT - 1);
+    assert(ssi_get_back(stack, &value) == DS_ERR_NONE && value == 0);
+    for (int i = 0; i < COUNT; i++) {
+        assert(ssi_get_at(stack, i, &value) == DS_ERR_NONE);
+        assert(value == COUNT - 1 - i);
+    }
+    assert(ssi_get_at(stack, COUNT, &value) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+
+    // pop across segment boundaries, then grow again into the kept segments
+    const size_t capacity = ssi_capacity(stack);
+    for (int i = COUNT - 1; i >= COUNT / 3; i--) {
+        assert(ssi_pop(stack, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+    for (int i = COUNT / 3; i < COUNT; i++)
+        assert(ssi_push(stack, i) == DS_ERR_NONE);
+    assert(ssi_capacity(stack) == capacity);
+
+    for (int i = COUNT - 1; i >= 0; i--) {
+        assert(ssi_pop(stack, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+    assert(ssi_is_empty(stack));
+
+    assert(ssi_deep_clear(stack) == DS_ERR_NONE);
+    assert(ssi_capacity(stack) == 0);
+
+    ssi_delete(&stack);
+    assert(stack._nodes == NULL);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_segmented_reserve(void)
+{
+    printf("\n    %-30s", "test_segmented_reserve");
+
+    SegRecord stack = ssr_create();
+    assert(ssr_reserve(stack, 500) == DS_ERR_NONE);
+    assert(ssr_capacity(stack) == 500);
+
+    const size_t bytes = ssr_bytes(stack);
+
+    // pointers stay valid while growing past the reserved room
+    Record *first = NULL;
+    assert(ssr_push(stack, (Record){ .id = 0 }) == DS_ERR_NONE);
+    assert(ds_ss_get_front(stack._nodes, (void **)&first) == DS_ERR_NONE);
+
+    for (long long i = 1; i < 500; i++)
+        assert(ssr_push(stack, (Record){ .id = i }) == DS_ERR_NONE);
+    assert(ssr_bytes(stack) == bytes);
+
+    // consecutive pushes are contiguous inside a segment
+    Record *top = NULL;
+    assert(ds_ss_get_front(stack._nodes, (void **)&top) == DS_ERR_NONE);
+    assert(top == first + 499);
+
+    for (long long i = 500; i < 5000; i++)
+        assert(ssr_push(stack, (Record){ .id = i }) == DS_ERR_NONE);
+    assert(first->id == 0);
+
+    // reserving below the capacity is a no-op
+    const size_t capacity = ssr_capacity(stack);
+    assert(ssr_reserve(stack, 10) == DS_ERR_NONE);
+    assert(ssr_capacity(stack) == capacity);
+
+    ssr_clear(stack);
+    assert(ssr_capacity(stack) == capacity);
+
+    ssr_delete(&stack);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_segmented_ownership(void)
+{
+    printf("\n    %-30s", "test_segmented_ownership");
+
+    destroy_calls = 0;
+    SegString stack = sss_create();
+
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    for (int i = 0; i < 40; i++)
+        assert(sss_push(stack, (char*)words[i % 4]) == DS_ERR_NONE);
+
+    char* out = NULL;
+    assert(sss_pop(stack, &out) == DS_ERR_NONE);
+    assert(strcmp(out, "delta") == 0 && destroy_calls == 0);
+    free(out);
+
+    assert(sss_pop(stack, NULL) == DS_ERR_NONE);
+    assert(destroy_calls == 1);
+
+    // failing copies leave the stack untouched
+    copy_budget = 0;
+    assert(sss_push(stack, "epsilon") == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+    assert(sss_length(stack) == 38);
+
+    SegString other = sss_create();
+    sss_push(other, "kept");
+    copy_budget = 20;
+    assert(sss_copy(other, stack) == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+    assert(sss_length(other) == 1);
+
+    assert(sss_copy(other, stack) == DS_ERR_NONE);
+    assert(sss_length(other) == 38);
+    assert(sss_get_front(other, &out) == DS_ERR_NONE && strcmp(out, "beta") == 0);
+    assert(sss_get_back(other, &out) == DS_ERR_NONE && strcmp(out, "alpha") == 0);
+
+    // the copy keeps growing normally
+    assert(sss_push(other, "zeta") == DS_ERR_NONE);
+    assert(sss_get_front(other, &out) == DS_ERR_NONE && strcmp(out, "zeta") == 0);
+
+    destroy_calls = 0;
+    sss_delete(&stack);
+    sss_delete(&other);
+    assert(destroy_calls == 38 + 39);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_stack_parity(void)
+{
+    printf("\n    %-30s", "test_stack_parity");
+
+    StackInt linked = si_create();
+    SegInt segmented = ssi_create();
+
+    for (int it = 0; it < 5000; it++) {
+        if (rand() % 3) {
+            int value = rand();
+            assert(si_push(linked, value) == ssi_push(segmented, value));
+        }
+        else {
+            int a = 0, b = 0;
+            assert(si_pop(linked, &a) == ssi_pop(segmented, &b));
+            assert(a == b);
+        }
+        assert(si_length(linked) == ssi_length(segmented));
+    }
+
+    si_delete(&linked);
+    ssi_delete(&segmented);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_stack_bulk(void)
+{
+    printf("\n    %-30s", "test_stack_bulk");
+
+    enum { COUNT = 1000 };
+    int values[COUNT], out[COUNT];
+    for (int i = 0; i < COUNT; i++) values[i] = i;
+
+    StackInt linked = si_create();
+    SegInt segmented = ssi_create();
+
+    // start the batch in the middle of a segment
+    for (int i = 0; i < 3; i++) {
+        assert(si_push(linked, -1) == DS_ERR_NONE);
+        assert(ssi_push(segmented, -1) == DS_ERR_NONE);
+    }
+
+    // same result as pushing one value at a time: the last one on top
+    assert(si_push_n(linked, values, COUNT) == DS_ERR_NONE);
+    assert(ssi_push_n(segmented, values, COUNT) == DS_ERR_NONE);
+
+    int value;
+    assert(si_get_front(linked, &value) == DS_ERR_NONE && value == COUNT - 1);
+    assert(ssi_get_front(segmented, &value) == DS_ERR_NONE && value == COUNT - 1);
+    assert(ssi_get_at(segmented, COUNT, &value) == DS_ERR_NONE && value == -1);
+
+    size_t popped = 0;
+    assert(si_pop_n(linked, out, COUNT, &popped) == DS_ERR_NONE && popped == COUNT);
+    for (int i = 0; i < COUNT; i++) assert(out[i] == COUNT - 1 - i);
+    assert(ssi_pop_n(segmented, out, COUNT, &popped) == DS_ERR_NONE && popped == COUNT);
+    for (int i = 0; i < COUNT; i++) assert(out[i] == COUNT - 1 - i);
+
+    assert(si_pop_n(linked, out, 10, &popped) == DS_ERR_NONE && popped == 3);
+    assert(ssi_pop_n(segmented, out, 10, &popped) == DS_ERR_NONE && popped == 3);
+    assert(si_pop_n(linked, out, 10, &popped) == DS_ERR_EMPTY_STRUCTURE);
+    assert(ssi_pop_n(segmented, out, 10, &popped) == DS_ERR_EMPTY_STRUCTURE);
+    assert(si_pop_n(linked, out, 0, &popped) == DS_ERR_NONE && popped == 0);
+    assert(ssi_pop_n(segmented, out, 0, &popped) == DS_ERR_NONE && popped == 0);
+
+    // refilling reuses the kept segments
+    const size_t capacity = ssi_capacity(segmented);
+    assert(ssi_push_n(segmented, values, COUNT) == DS_ERR_NONE);
+    assert(ssi_capacity(segmented) == capacity);
+
+    si_delete(&linked);
+    ssi_delete(&segmented);
+
+    // failing copies leave the stack untouched
+    const char* words[] = {"alpha", "beta", "gamma", "delta"};
+    SegString strings = sss_create();
+    destroy_calls = 0;
+
+    for (int i = 0; i < 7; i++)
+        assert(sss_push(strings, (char*)words[i % 4]) == DS_ERR_NONE);
+
+    copy_budget = 3;
+    assert(sss_push_n(strings, (char**)words, 4) == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+    assert(sss_length(strings) == 7 && destroy_calls == 3);
+
+    char* top = NULL;
+    assert(sss_get_front(strings, &top) == DS_ERR_NONE && strcmp(top, "gamma") == 0);
+    assert(sss_push_n(strings, (char**)words, 4) == DS_ERR_NONE);
+    assert(sss_get_front(strings, &top) == DS_ERR_NONE && strcmp(top, "delta") == 0);
+
+    sss_delete(&strings);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_stackdef_tests(void)
+{
+    printf("\n+------------------------------------------------------+");
+    printf("\n|                  'stackdef' Test Suite               |");
+    printf("\n+------------------------------------------------------+");
+
+    test_segmented_lifo();
+    test_segmented_reserve();
+    test_segmented_ownership();
+    test_stack_parity();
+    test_stack_bulk();
+
+    printf("\n+------------------------------------------------------+");
+    printf("\n|                    ALL TESTS PASSED                  |");
+    printf("\n+------------------------------------------------------+\n");
+}
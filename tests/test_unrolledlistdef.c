@@ -0,0 +1,305 @@
+/**
+ * @file    test_unrolledlistdef.c
+ * @brief   Unrolled list generator tests
+ *
+ * @author  Gabriel Souza
+ * @date    2026-10-18
+ */
+
+#include <assert.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIBDS_ENABLE_ERROR_PRINT 0
+#include "libds/core.h"
+
+#include "test_runner.h"
+#include "libds/listdef.h"
+#include "libds/unrolledlistdef.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+static int copy_budget = -1;     // Copies allowed before failing (-1 = never fail)
+static int destroy_calls = 0;    // Tracks destroy function calls
+
+static bool copy_string(void* dst, const void* src)
+{
+    if (!dst || !src) return false;
+    if (copy_budget == 0) return false;
+    if (copy_budget > 0) copy_budget--;
+
+    const size_t len = strlen(*(const char**)src);
+    char* new_str = malloc(len + 1);
+    if (!new_str) return false;
+
+    memcpy(new_str, *(const char**)src, len + 1);
+    *(char**)dst = new_str;
+    return true;
+}
+
+static void destroy_string(void* data)
+{
+    if (!data) return;
+    free(*(char**)data);
+    *(char**)data = NULL;
+    destroy_calls++;
+}
+
+// ============================================================================
+// List Type Definitions (Template Instantiations)
+// ============================================================================
+
+LIBDS_DEF_UNROLLED_LIST(int,         UListInt,    uli, null_copy, null_destroy)
+LIBDS_DEF_UNROLLED_LIST(long double, UListLong,   ull, null_copy, null_destroy)
+LIBDS_DEF_UNROLLED_LIST(char*,       UListString, uls, copy_string, destroy_string)
+
+LIBDS_DEF_LIST(int, SListInt, sli, null_copy, null_destroy)
+
+// ============================================================================
+// Test Cases
+// ============================================================================
+
+static void test_unrolled_sequential(void)
+{
+    printf("\n    %-30s", "test_unrolled_sequential");
+
+    const int COUNT = 1000;
+    UListInt list = uli_create();
+    assert(list._nodes != NULL);
+    assert(uli_is_empty(list));
+
+    int value;
+    assert(uli_get_front(list, &value) == DS_ERR_EMPTY_STRUCTURE);
+    assert(uli_pop_back(list, &value) == DS_ERR_EMPTY_STRUCTURE);
+
+    for (int i = 0; i < COUNT; i++)
+        assert(uli_push_back(list, i) == DS_ERR_NONE);
+
+    assert(uli_length(list) == (size_t)COUNT);
+    for (int i = 0; i < COUNT; i++) {
+        assert(uli_get_at(list, i, &value) == DS_ERR_NONE);
+        assert(value == i);
+    }
+    assert(uli_get_at(list, COUNT, &value) == DS_ERR_INDEX_OUT_OF_BOUNDS);
+
+    assert(uli_get_back(list, &value) == DS_ERR_NONE && value == COUNT - 1);
+
+    assert(uli_reverse(list) == DS_ERR_NONE);
+    for (int i = 0; i < COUNT; i++) {
+        assert(uli_pop_front(list, &value) == DS_ERR_NONE);
+        assert(value == COUNT - 1 - i);
+    }
+    assert(uli_is_empty(list));
+
+    uli_delete(&list);
+    assert(list._nodes == NULL);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_unrolled_footprint(void)
+{
+    printf("\n    %-30s", "test_unrolled_footprint");
+
+    const int COUNT = 4096;
+    UListInt unrolled = uli_create();
+    SListInt linked = sli_create();
+
+    for (int i = 0; i < COUNT; i++) {
+        uli_push_back(unrolled, i);
+        sli_push_back(linked, i);
+    }
+
+    // no per-element `next` pointer: far below the 16 bytes of a linked slot
+    assert(uli_bytes(unrolled) * 2 < sli_bytes(linked));
+
+    uli_delete(&unrolled);
+    sli_delete(&linked);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_unrolled_alignment(void)
+{
+    printf("\n    %-30s", "test_unrolled_alignment");
+
+    struct ds_unrolled_chain* chain = ds_uc_alloc(sizeof(long double), alignof(long double));
+    assert(chain != NULL);
+
+    void* data = NULL;
+    for (int i = 0; i < 128; i++) {
+        assert(ds_uc_push_at(chain, ds_uc_length(chain) / 2, &data) == DS_ERR_NONE);
+        assert(((uintptr_t)data % alignof(long double)) == 0);
+    }
+    ds_uc_free(&chain, NULL);
+
+    // every node starts on a cache line, so their first elements share an offset in it
+    chain = ds_uc_alloc(sizeof(int), alignof(int));
+    for (int i = 0; i < 1000; i++) assert(ds_uc_push_at(chain, ds_uc_length(chain), &data) == DS_ERR_NONE);
+
+    uintptr_t previous = 0;
+    uintptr_t first_offset = 0;
+    for (size_t i = 0; i < 1000; i++) {
+        assert(ds_uc_get_at(chain, i, &data) == DS_ERR_NONE);
+        const uintptr_t address = (uintptr_t)data;
+        if (i == 0) first_offset = address % LIBDS_CACHE_LINE_SIZE;
+        else if (address != previous + sizeof(int)) assert(address % LIBDS_CACHE_LINE_SIZE == first_offset);
+        previous = address;
+    }
+
+    // past the node link and the element count only
+    assert(first_offset == sizeof(void*) + sizeof(size_t));
+    ds_uc_free(&chain, NULL);
+
+    // Invalid layouts are rejected like in the node chain engine
+    assert(ds_uc_alloc(0, alignof(int)) == NULL);
+    assert(ds_uc_alloc(10, 8) == NULL);
+    assert(ds_uc_alloc((size_t)-8, 8) == NULL);
+
+    UListLong list = ull_create();
+    for (int i = 0; i < 100; i++) ull_push_front(list, (long double)i);
+
+    long double value;
+    assert(ull_get_at(list, 99, &value) == DS_ERR_NONE && value == 0.0L);
+    ull_delete(&list);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_unrolled_dynamic_str(void)
+{
+    printf("\n    %-30s", "test_unrolled_dynamic_str");
+
+    const char* names[] = {"Ada Lovelace", "Alan Turing", "John von Neumann", "Grace Hopper"};
+    destroy_calls = 0;
+
+    UListString list = uls_create();
+    for (int round = 0; round < 20; round++)
+        for (size_t i = 0; i < 4; i++)
+            assert(uls_push_at(list, uls_length(list) / 2, (char*)names[i]) == DS_ERR_NONE);
+
+    assert(uls_length(list) == 80);
+
+    // ownership transfer skips the destructor
+    char* out = NULL;
+    assert(uls_pop_at(list, 40, &out) == DS_ERR_NONE);
+    assert(destroy_calls == 0);
+    free(out);
+
+    assert(uls_drop_front(list) == DS_ERR_NONE);
+    assert(uls_drop_at(list, 10) == DS_ERR_NONE);
+    assert(destroy_calls == 2);
+
+    // failing copy rolls the destination back
+    UListString other = uls_create();
+    assert(uls_push_back(other, "kept") == DS_ERR_NONE);
+
+    copy_budget = 30;
+    assert(uls_copy(other, list) == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+
+    assert(uls_length(other) == 1);
+    assert(uls_get_front(other, &out) == DS_ERR_NONE && strcmp(out, "kept") == 0);
+
+    copy_budget = 0;
+    assert(uls_push_back(other, "lost") == DS_ERR_COPY_FAILED);
+    copy_budget = -1;
+    assert(uls_length(other) == 1);
+
+    // successful copy replaces the content
+    assert(uls_copy(other, list) == DS_ERR_NONE);
+    assert(uls_length(other) == uls_length(list));
+
+    char* a = NULL;
+    char* b = NULL;
+    for (size_t i = 0; i < uls_length(list); i++) {
+        assert(uls_get_at(list, i, &a) == DS_ERR_NONE);
+        assert(uls_get_at(other, i, &b) == DS_ERR_NONE);
+        assert(a != b && strcmp(a, b) == 0);
+    }
+
+    uls_delete(&list);
+    uls_delete(&other);
+
+    printf(" [PASSED]\n");
+}
+
+static void test_unrolled_fuzz(void)
+{
+    printf("\n    %-30s", "test_unrolled_fuzz");
+
+    enum { ITERATIONS = 20000, MAX_REF_SIZE = 2048 };
+
+    UListInt list = uli_create();
+    static int reference[MAX_REF_SIZE];
+    size_t ref_size = 0;
+
+    for (int it = 0; it < ITERATIONS; it++) {
+        const int operation = rand() % 7;
+        int value = rand();
+
+        if (operation <= 2 && ref_size < MAX_REF_SIZE) {
+            size_t index = operation == 0 ? 0 : operation == 1 ? ref_size : rand() % (ref_size + 1);
+            assert(uli_push_at(list, index, value) == DS_ERR_NONE);
+            memmove(reference + index + 1, reference + index, (ref_size - index) * sizeof(int));
+            reference[index] = value;
+            ref_size++;
+        }
+        else if (operation >= 3 && operation <= 5 && ref_size > 0) {
+            size_t index = operation == 3 ? 0 : operation == 4 ? ref_size - 1 : rand() % ref_size;
+            int out;
+            if (index == ref_size - 1)
+                assert(uli_pop_back(list, &out) == DS_ERR_NONE);
+            else
+                assert(uli_pop_at(list, index, &out) == DS_ERR_NONE);
+            assert(out == reference[index]);
+            memmove(reference + index, reference + index + 1, (ref_size - index - 1) * sizeof(int));
+            ref_size--;
+        }
+        else if (operation == 6 && ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(uli_set_at(list, index, value) == DS_ERR_NONE);
+            reference[index] = value;
+        }
+
+        assert(uli_length(list) == ref_size);
+    }
+
+    int value;
+    for (size_t i = 0; i < ref_size; i++) {
+        assert(uli_get_at(list, i, &value) == DS_ERR_NONE);
+        assert(value == reference[i]);
+    }
+
+    uli_clear(list);
+    assert(uli_is_empty(list));
+    uli_delete(&list);
+
+    printf(" [PASSED]\n");
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_unrolledlistdef_tests(void)
+{
+    printf("\n+------------------------------------------------------+");
+    printf("\n|              'unrolledlistdef' Test Suite            |");
+    printf("\n+------------------------------------------------------+");
+
+    test_unrolled_sequential();
+    test_unrolled_footprint();
+    test_unrolled_alignment();
+    test_unrolled_dynamic_str();
+    test_unrolled_fuzz();
+
+    printf("\n+------------------------------------------------------+");
+    printf("\n|                    ALL TESTS PASSED                  |");
+    printf("\n+------------------------------------------------------+\n");
+}